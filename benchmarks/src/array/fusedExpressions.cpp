@@ -0,0 +1,63 @@
+#include <cstdio>
+#include <vector>
+
+#include <occa.hpp>
+
+namespace linalg = occa::linalg;
+
+// Computing [a = b + 2*c - d] with one array operation per term and
+//   with a single fused expression kernel
+int main(const int argc, const char **argv) {
+  const int entries    = (argc > 1) ? atoi(argv[1]) : (1 << 22);
+  const int iterations = (argc > 2) ? atoi(argv[2]) : 50;
+
+  occa::device device("mode: 'Serial'");
+
+  std::vector<double> values(entries);
+  for (int i = 0; i < entries; ++i) {
+    values[i] = 1.0 / (1 + (i % 100));
+  }
+
+  occa::array<double> a(device, entries);
+  occa::array<double> b(device, entries, &(values[0]));
+  occa::array<double> c(device, entries, &(values[0]));
+  occa::array<double> d(device, entries, &(values[0]));
+
+  // Warm up and build the kernels
+  a.memory().copyFrom(b.memory());
+  linalg::axpy<double, double, double>(2.0, c.memory(), a.memory());
+  a -= d;
+  a = b + 2*c - d;
+
+  double start = occa::sys::currentTime();
+  for (int it = 0; it < iterations; ++it) {
+    a.memory().copyFrom(b.memory());
+    linalg::axpy<double, double, double>(2.0, c.memory(), a.memory());
+    a -= d;
+  }
+  device.finish();
+  const double separateTime = (occa::sys::currentTime() - start) / iterations;
+
+  start = occa::sys::currentTime();
+  for (int it = 0; it < iterations; ++it) {
+    a = b + 2*c - d;
+  }
+  device.finish();
+  const double fusedTime = (occa::sys::currentTime() - start) / iterations;
+
+  // Each pass reads b, c and d and writes a
+  const double gb = (4.0 * entries * sizeof(double)) / 1e9;
+
+  printf("%d entries\n", entries);
+  printf("%-16s %12s %12s\n", "assignment", "ms", "GB/s");
+  printf("%-16s %12.3f %12.2f\n", "separate", 1e3 * separateTime, gb / separateTime);
+  printf("%-16s %12.3f %12.2f\n", "fused", 1e3 * fusedTime, gb / fusedTime);
+  printf("%-16s %11.2fx\n", "speedup", separateTime / fusedTime);
+
+  a.free();
+  b.free();
+  c.free();
+  d.free();
+
+  return 0;
+}
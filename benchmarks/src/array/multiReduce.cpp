@@ -0,0 +1,69 @@
+#include <cstdio>
+#include <vector>
+
+#include <occa.hpp>
+#include <occa/array/linalg.hpp>
+
+namespace linalg = occa::linalg;
+namespace reductionType = occa::linalg::reductionType;
+
+// The reductions of a Krylov iteration, dot(r, r), dot(p, Ap) and
+//   l2Norm(x), computed with separate linalg calls and with one
+//   multiReduce pass
+int main(const int argc, const char **argv) {
+  const int entries    = (argc > 1) ? atoi(argv[1]) : (1 << 22);
+  const int iterations = (argc > 2) ? atoi(argv[2]) : 50;
+
+  occa::device device("mode: 'Serial'");
+
+  std::vector<double> values(entries);
+  for (int i = 0; i < entries; ++i) {
+    values[i] = 1.0 / (1 + (i % 100));
+  }
+
+  // r, p, Ap, x
+  std::vector<occa::memory> vecs;
+  for (int i = 0; i < 4; ++i) {
+    vecs.push_back(device.malloc<double>(entries, &(values[0])));
+  }
+
+  linalg::reductionVector reductions;
+  reductions.push_back(linalg::reduction_t(reductionType::dot, 0, 0));
+  reductions.push_back(linalg::reduction_t(reductionType::dot, 1, 2));
+  reductions.push_back(linalg::reduction_t(reductionType::l2Norm, 3));
+
+  // Warm up and build the kernels
+  double rr = linalg::dot<double, double, double>(vecs[0], vecs[0]);
+  double pAp = linalg::dot<double, double, double>(vecs[1], vecs[2]);
+  double xNorm = linalg::l2Norm<double, double>(vecs[3]);
+  linalg::multiReduce<double, double>(reductions, vecs).getAll();
+
+  double start = occa::sys::currentTime();
+  for (int it = 0; it < iterations; ++it) {
+    rr = linalg::dot<double, double, double>(vecs[0], vecs[0]);
+    pAp = linalg::dot<double, double, double>(vecs[1], vecs[2]);
+    xNorm = linalg::l2Norm<double, double>(vecs[3]);
+  }
+  const double separateTime = (occa::sys::currentTime() - start) / iterations;
+
+  std::vector<double> results;
+  start = occa::sys::currentTime();
+  for (int it = 0; it < iterations; ++it) {
+    results = linalg::multiReduce<double, double>(reductions, vecs).getAll();
+  }
+  const double fusedTime = (occa::sys::currentTime() - start) / iterations;
+
+  printf("%d entries\n", entries);
+  printf("%-16s %12s\n", "reductions", "ms");
+  printf("%-16s %12.3f\n", "separate", 1e3 * separateTime);
+  printf("%-16s %12.3f\n", "multiReduce", 1e3 * fusedTime);
+  printf("%-16s %11.2fx\n", "speedup", separateTime / fusedTime);
+  printf("Difference: %g %g %g\n",
+         results[0] - rr, results[1] - pAp, results[2] - xNorm);
+
+  for (int i = 0; i < 4; ++i) {
+    vecs[i].free();
+  }
+
+  return 0;
+}
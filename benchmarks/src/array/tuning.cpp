@@ -0,0 +1,109 @@
+#include <cstdio>
+#include <vector>
+
+#include <occa.hpp>
+#include <occa/core/tuning.hpp>
+
+namespace linalg = occa::linalg;
+
+double timeKernel(occa::device &device,
+                  occa::kernel kernel,
+                  const std::vector<occa::kernelArg> &args,
+                  const int iterations) {
+  kernel.clearArgs();
+  for (int i = 0; i < (int) args.size(); ++i) {
+    kernel.pushArg(args[i]);
+  }
+  kernel.run();
+  device.finish();
+
+  const double start = occa::sys::currentTime();
+  for (int it = 0; it < iterations; ++it) {
+    kernel.run();
+  }
+  device.finish();
+  return (occa::sys::currentTime() - start) / iterations;
+}
+
+void compare(occa::device &device,
+             const std::string &name,
+             occa::kernelBuilder builder,
+             const std::vector<occa::kernelArg> &args,
+             const int iterations) {
+  // Building with explicit properties skips the tuned variant
+  occa::kernel defaultKernel = builder.build(device, builder.defaultProperties());
+  occa::kernel tunedKernel = builder.build(device);
+
+  const double defaultTime = timeKernel(device, defaultKernel, args, iterations);
+  const double tunedTime = timeKernel(device, tunedKernel, args, iterations);
+
+  const occa::json &defines = tunedKernel.properties()["defines"];
+  printf("%-10s %12.3f %12.3f %9.2fx   CPU_DOT_OUTER: %d, TILESIZE: %d\n",
+         name.c_str(),
+         1e3 * defaultTime,
+         1e3 * tunedTime,
+         defaultTime / tunedTime,
+         (int) defines.get("CPU_DOT_OUTER", 0),
+         (int) defines.get("TILESIZE", 0));
+}
+
+// Tunes the linalg kernels on the current machine and compares the
+//   tuned variants with the hardcoded defaults
+int main(const int argc, const char **argv) {
+  const int entries    = (argc > 1) ? atoi(argv[1]) : (1 << 22);
+  const int iterations = (argc > 2) ? atoi(argv[2]) : 50;
+  const char *mode     = (argc > 3) ? argv[3] : "Serial";
+
+  occa::device device(std::string("mode: '") + mode + "'");
+
+  double start = occa::sys::currentTime();
+  linalg::tune<double, double>(device, entries);
+  const double tuneTime = occa::sys::currentTime() - start;
+
+  occa::memory x = device.malloc<double>(entries);
+  occa::memory y = device.malloc<double>(entries);
+  occa::memory buffer = device.malloc<double>(linalg::tunedDotOuters[linalg::tunedDotOuterCount - 1]);
+  linalg::operator_eq<double>(x, 1);
+  linalg::operator_eq<double>(y, 1);
+
+  const int indexType = linalg::getIndexType(entries);
+  const occa::kernelArg entriesArg = linalg::indexArg(entries);
+
+  printf("%d entries, %s mode, tuned in %.1f s\n", entries, mode, tuneTime);
+  printf("Database: %s\n", occa::tuning::filename(device).c_str());
+  printf("%-10s %12s %12s %10s\n", "kernel", "default ms", "tuned ms", "speedup");
+
+  std::vector<occa::kernelArg> args;
+  args.push_back(entriesArg);
+  args.push_back(x);
+  args.push_back(buffer);
+  compare(device, "l2Norm",
+          linalg::makeLinalgBuilder<double, double>("l2Norm", indexType),
+          args, iterations);
+  compare(device, "vecMax",
+          linalg::makeLinalgBuilder<double, double>("vecMax", indexType),
+          args, iterations);
+
+  args.clear();
+  args.push_back(entriesArg);
+  args.push_back(x);
+  args.push_back(y);
+  args.push_back(buffer);
+  compare(device, "dot",
+          linalg::makeLinalgBuilder<double, double, double>("dot", indexType),
+          args, iterations);
+
+  args.clear();
+  args.push_back(entriesArg);
+  args.push_back(x);
+  args.push_back(y);
+  compare(device, "plus_eq",
+          linalg::makeAssignmentBuilder<double, double>("plus_eq", 128, indexType),
+          args, iterations);
+
+  x.free();
+  y.free();
+  buffer.free();
+
+  return 0;
+}
@@ -0,0 +1,57 @@
+#include <cstdio>
+
+#include <occa.hpp>
+
+// Launch latency of an empty kernel through kernel::operator()
+//   compared to a pre-bound occa::kernelArgPack
+const std::string emptyKernelSource = (
+  "@kernel void emptyKernel(const int N,"
+  "                         const float alpha,"
+  "                         const float *x,"
+  "                         const float *y,"
+  "                         float *z) {"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {}"
+  "}"
+);
+
+int main(const int argc, const char **argv) {
+  const int iterations = (argc > 1) ? atoi(argv[1]) : 1000000;
+  const int entries = 16;
+
+  occa::kernel emptyKernel = occa::buildKernelFromString(emptyKernelSource,
+                                                         "emptyKernel");
+
+  occa::memory o_x = occa::malloc(entries * sizeof(float));
+  occa::memory o_y = occa::malloc(entries * sizeof(float));
+  occa::memory o_z = occa::malloc(entries * sizeof(float));
+
+  // Warm up
+  for (int i = 0; i < 1000; ++i) {
+    emptyKernel(0, 1.0f, o_x, o_y, o_z);
+  }
+
+  double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    emptyKernel(0, (float) i, o_x, o_y, o_z);
+  }
+  const double operatorTime = (occa::sys::currentTime() - start) / iterations;
+
+  occa::kernelArgPack pack = emptyKernel.bind(0, 1.0f, o_x, o_y, o_z);
+  start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    pack.set(1, (float) i);
+    pack.run();
+  }
+  const double packTime = (occa::sys::currentTime() - start) / iterations;
+
+  printf("%-24s %12s\n", "launch", "ns/launch");
+  printf("%-24s %12.1f\n", "kernel::operator()", 1e9 * operatorTime);
+  printf("%-24s %12.1f\n", "kernelArgPack::run()", 1e9 * packTime);
+  printf("%-24s %12.2fx\n", "speedup", operatorTime / packTime);
+
+  o_x.free();
+  o_y.free();
+  o_z.free();
+
+  return 0;
+}
@@ -0,0 +1,68 @@
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <occa.hpp>
+
+// Allocating, filling and freeing short-lived temporaries, as done by
+//   iterative solvers, with and without the device memory pool
+// Fresh host allocations also pay for page faults when first written
+double runAllocations(occa::device &device,
+                      const int iterations,
+                      const int temporaries,
+                      const occa::udim_t maxBytes,
+                      const occa::properties &props) {
+  std::vector<occa::memory> mems(temporaries);
+
+  const double start = occa::sys::currentTime();
+  for (int it = 0; it < iterations; ++it) {
+    for (int i = 0; i < temporaries; ++i) {
+      // Varying sizes to exercise the size classes
+      const occa::udim_t bytes = maxBytes - ((it * 7 + i * 13) % 64) * (maxBytes / 256);
+      mems[i] = device.malloc(bytes, NULL, props);
+      ::memset(mems[i].ptr(), 0, bytes);
+    }
+    for (int i = 0; i < temporaries; ++i) {
+      mems[i].free();
+    }
+  }
+  return (occa::sys::currentTime() - start) / (iterations * temporaries);
+}
+
+int main(const int argc, const char **argv) {
+  const int iterations  = (argc > 1) ? atoi(argv[1]) : 1000;
+  const int temporaries = (argc > 2) ? atoi(argv[2]) : 8;
+
+  const char *modes[2] = {"mode: 'Serial'", "mode: 'Emulated'"};
+  const occa::udim_t sizes[3] = {1 << 10, 1 << 20, 16 << 20};
+
+  printf("%-10s %10s %14s %14s %10s\n",
+         "mode", "bytes", "malloc us", "pooled us", "speedup");
+  for (int m = 0; m < 2; ++m) {
+    occa::device device(modes[m]);
+    for (int s = 0; s < 3; ++s) {
+      const double mallocTime = runAllocations(device,
+                                               iterations, temporaries, sizes[s],
+                                               occa::properties());
+      const double poolTime = runAllocations(device,
+                                             iterations, temporaries, sizes[s],
+                                             "pool: true");
+      printf("%-10s %10llu %14.3f %14.3f %9.2fx\n",
+             device.mode().c_str(),
+             (unsigned long long) sizes[s],
+             1e6 * mallocTime,
+             1e6 * poolTime,
+             mallocTime / poolTime);
+
+      device.trimMemoryPool();
+    }
+    printf("%-10s peak pool reserved: %llu bytes, %llu hits, %llu misses\n",
+           device.mode().c_str(),
+           (unsigned long long) device.memoryPoolPeak(),
+           (unsigned long long) device.memoryPoolHits(),
+           (unsigned long long) device.memoryPoolMisses());
+    device.free();
+  }
+
+  return 0;
+}
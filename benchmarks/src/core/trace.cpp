@@ -0,0 +1,67 @@
+#include <cstdio>
+
+#include <occa.hpp>
+
+// Cost of tracing on the launch and copy paths, with tracing
+//   disabled and enabled
+const std::string emptyKernelSource = (
+  "@kernel void emptyKernel(const int N, float *a) {"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {}"
+  "}"
+);
+
+double timeLaunches(occa::kernel &emptyKernel,
+                    occa::memory &o_a,
+                    const int iterations) {
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    emptyKernel(0, o_a);
+  }
+  return (occa::sys::currentTime() - start) / iterations;
+}
+
+double timeCopies(occa::memory &o_a,
+                  float *a,
+                  const int iterations) {
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    o_a.copyFrom(a);
+  }
+  return (occa::sys::currentTime() - start) / iterations;
+}
+
+int main(const int argc, const char **argv) {
+  const int iterations = (argc > 1) ? atoi(argv[1]) : 1000000;
+  const int entries = 16;
+
+  occa::device device("mode: 'Serial'");
+  occa::kernel emptyKernel = device.buildKernelFromString(emptyKernelSource,
+                                                          "emptyKernel");
+  occa::memory o_a = device.malloc<float>(entries);
+  float a[entries] = {0};
+
+  // Warm up
+  timeLaunches(emptyKernel, o_a, 1000);
+
+  occa::trace::disable();
+  const double launchTime = timeLaunches(emptyKernel, o_a, iterations);
+  const double copyTime   = timeCopies(o_a, a, iterations);
+
+  occa::trace::enable();
+  const double tracedLaunchTime = timeLaunches(emptyKernel, o_a, iterations);
+  const double tracedCopyTime   = timeCopies(o_a, a, iterations);
+  const int events = (int) occa::trace::getEvents().size();
+  occa::trace::disable();
+  occa::trace::clear();
+
+  printf("%-16s %14s %14s\n", "ns/op", "disabled", "enabled");
+  printf("%-16s %14.1f %14.1f\n", "kernel launch", 1e9 * launchTime, 1e9 * tracedLaunchTime);
+  printf("%-16s %14.1f %14.1f\n", "copyFrom", 1e9 * copyTime, 1e9 * tracedCopyTime);
+  printf("Recorded %d events\n", events);
+
+  o_a.free();
+  emptyKernel.free();
+  device.free();
+
+  return 0;
+}
@@ -0,0 +1,95 @@
+#include <cstdio>
+
+#include <occa.hpp>
+#include <occa/modes/emulated.hpp>
+
+// Host-to-device traffic of a managed buffer where the host updates
+//   a few entries between kernel launches, comparing whole-buffer
+//   syncs with page-granular dirty tracking
+const std::string touchKernelSource = (
+  "@kernel void touch(const int N, const int stride, float *a) {"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {"
+  "    a[i * stride] += 1;"
+  "  }"
+  "}"
+);
+
+double runSyncs(occa::device &device,
+                occa::kernel &touch,
+                const int entries,
+                const int iterations,
+                const int hostWrites,
+                const occa::properties &props) {
+  float *a = device.umalloc<float>(entries, props);
+  for (int i = 0; i < entries; ++i) {
+    a[i] = 0;
+  }
+  // The first launch always copies the whole buffer
+  touch(entries / 4096, 4096, a);
+  device.finish();
+
+  occa::resetDirtyPageStats();
+  occa::emulated::resetTransferStats(device);
+
+  const int writeStride = entries / hostWrites;
+  const double start = occa::sys::currentTime();
+  for (int it = 0; it < iterations; ++it) {
+    for (int i = 0; i < hostWrites; ++i) {
+      a[(i * writeStride + it) % entries] += 1;
+    }
+    touch(entries / 4096, 4096, a);
+    device.finish();
+  }
+  const double time = (occa::sys::currentTime() - start) / iterations;
+
+  occa::freeUvaPtr(a);
+  return time;
+}
+
+void printStats(const char *name,
+                const double time,
+                occa::device &device,
+                const int iterations) {
+  occa::emulated::transferStats_t transfers = occa::emulated::getTransferStats(device);
+  occa::dirtyPageStats_t pages = occa::getDirtyPageStats();
+
+  printf("%-16s %12.3f %16.1f %10llu %10llu\n",
+         name,
+         1e3 * time,
+         (double) transfers.hostToDeviceBytes / (1 << 20) / iterations,
+         (unsigned long long) pages.faults,
+         (unsigned long long) pages.partialSyncs);
+}
+
+int main(const int argc, const char **argv) {
+  const int megabytes  = (argc > 1) ? atoi(argv[1]) : 256;
+  const int hostWrites = (argc > 2) ? atoi(argv[2]) : 16;
+  const int iterations = (argc > 3) ? atoi(argv[3]) : 10;
+  const int entries = (int) (((occa::udim_t) megabytes << 20) / sizeof(float));
+
+  occa::device device("mode: 'Emulated'");
+  occa::kernel touch = device.buildKernelFromString(touchKernelSource,
+                                                    "touch");
+
+  printf("%d MB managed buffer, %d host writes between launches\n",
+         megabytes, hostWrites);
+  printf("%-16s %12s %16s %10s %10s\n",
+         "sync", "ms/launch", "MB to device", "faults", "partial");
+
+  const double fullTime = runSyncs(device, touch,
+                                   entries, iterations, hostWrites,
+                                   occa::properties());
+  printStats("full buffer", fullTime, device, iterations);
+
+  const double pageTime = runSyncs(device, touch,
+                                   entries, iterations, hostWrites,
+                                   "dirty_pages: true");
+  printStats("dirty pages", pageTime, device, iterations);
+
+  printf("%-16s %12.2fx\n", "speedup", fullTime / pageTime);
+
+  touch.free();
+  device.free();
+
+  return 0;
+}
@@ -0,0 +1,155 @@
+#include <cstdio>
+#include <map>
+#include <vector>
+
+#include <pthread.h>
+
+#include <occa.hpp>
+
+// UVA pointer lookups with many live allocations
+//   - std::map with an overlap comparator (the previous index)
+//   - occa::uvaToMemory on the same pointers
+//   - Kernel launches taking raw UVA pointers
+//   - Lookups from several threads while another thread allocates
+const std::string pointerKernelSource = (
+  "@kernel void pointerKernel(const int N, float *a) {"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {}"
+  "}"
+);
+
+typedef std::map<occa::ptrRange, occa::modeMemory_t*> ptrRangeMap;
+
+class lookupThreadData_t {
+public:
+  std::vector<float*> *ptrs;
+  int lookups;
+  int misses;
+};
+
+// Stride through the allocations to defeat the last-hit cache
+inline int nextIndex(const int index, const int allocations) {
+  return (index + 7919) % allocations;
+}
+
+void* runLookups(void *dataPtr) {
+  lookupThreadData_t &data = *((lookupThreadData_t*) dataPtr);
+  std::vector<float*> &ptrs = *(data.ptrs);
+  const int allocations = (int) ptrs.size();
+
+  int index = 0;
+  for (int i = 0; i < data.lookups; ++i) {
+    if (!occa::uvaToMemory(ptrs[index] + 1)) {
+      ++data.misses;
+    }
+    index = nextIndex(index, allocations);
+  }
+  return NULL;
+}
+
+void* runAllocations(void *stopPtr) {
+  volatile bool &stop = *((volatile bool*) stopPtr);
+  while (!stop) {
+    float *ptr = occa::umalloc<float>(16);
+    occa::freeUvaPtr(ptr);
+  }
+  return NULL;
+}
+
+int main(const int argc, const char **argv) {
+  const int allocations = (argc > 1) ? atoi(argv[1]) : 10000;
+  const int lookups     = (argc > 2) ? atoi(argv[2]) : 1000000;
+  const int threads     = (argc > 3) ? atoi(argv[3]) : 4;
+
+  occa::kernel pointerKernel = occa::buildKernelFromString(pointerKernelSource,
+                                                           "pointerKernel");
+
+  std::vector<float*> ptrs(allocations);
+  ptrRangeMap rangeMap;
+  for (int i = 0; i < allocations; ++i) {
+    ptrs[i] = occa::umalloc<float>(16);
+    rangeMap[occa::ptrRange(ptrs[i], 16 * sizeof(float))] = occa::uvaToMemory(ptrs[i]);
+  }
+
+  printf("%d live allocations\n", allocations);
+  printf("%-28s %12s\n", "lookup", "ns/lookup");
+
+  int misses = 0;
+  int index = 0;
+  double start = occa::sys::currentTime();
+  for (int i = 0; i < lookups; ++i) {
+    misses += (rangeMap.find(ptrs[index] + 1) == rangeMap.end());
+    index = nextIndex(index, allocations);
+  }
+  printf("%-28s %12.1f\n", "std::map",
+         1e9 * (occa::sys::currentTime() - start) / lookups);
+
+  start = occa::sys::currentTime();
+  for (int i = 0; i < lookups; ++i) {
+    misses += !occa::uvaToMemory(ptrs[index] + 1);
+    index = nextIndex(index, allocations);
+  }
+  printf("%-28s %12.1f\n", "uvaToMemory",
+         1e9 * (occa::sys::currentTime() - start) / lookups);
+
+  start = occa::sys::currentTime();
+  for (int i = 0; i < lookups; ++i) {
+    misses += !occa::uvaToMemory(ptrs[0] + (i % 16));
+  }
+  printf("%-28s %12.1f\n", "uvaToMemory (same buffer)",
+         1e9 * (occa::sys::currentTime() - start) / lookups);
+
+  const int launches = lookups / 10;
+  start = occa::sys::currentTime();
+  for (int i = 0; i < launches; ++i) {
+    pointerKernel(0, ptrs[index]);
+    index = nextIndex(index, allocations);
+  }
+  printf("%-28s %12.1f\n", "kernel launch",
+         1e9 * (occa::sys::currentTime() - start) / launches);
+
+  start = occa::sys::currentTime();
+  for (int i = 0; i < launches; ++i) {
+    pointerKernel(0, ptrs[0]);
+  }
+  printf("%-28s %12.1f\n", "kernel launch (same buffer)",
+         1e9 * (occa::sys::currentTime() - start) / launches);
+
+  // Concurrent lookups while another thread allocates and frees
+  volatile bool stop = false;
+  pthread_t allocThread;
+  pthread_create(&allocThread, NULL, runAllocations, (void*) &stop);
+
+  std::vector<pthread_t> lookupThreads(threads);
+  std::vector<lookupThreadData_t> data(threads);
+  start = occa::sys::currentTime();
+  for (int t = 0; t < threads; ++t) {
+    data[t].ptrs = &ptrs;
+    data[t].lookups = lookups;
+    data[t].misses = 0;
+    pthread_create(&lookupThreads[t], NULL, runLookups, &data[t]);
+  }
+  for (int t = 0; t < threads; ++t) {
+    pthread_join(lookupThreads[t], NULL);
+    misses += data[t].misses;
+  }
+  const double threadTime = occa::sys::currentTime() - start;
+  stop = true;
+  pthread_join(allocThread, NULL);
+
+  // Wall time over all lookups, so this drops with more cores
+  char name[64];
+  snprintf(name, sizeof(name), "uvaToMemory (%d threads)", threads);
+  printf("%-28s %12.1f\n", name,
+         1e9 * threadTime / (threads * (double) lookups));
+
+  if (misses) {
+    printf("Missed %d lookups\n", misses);
+  }
+
+  for (int i = 0; i < allocations; ++i) {
+    occa::freeUvaPtr(ptrs[i]);
+  }
+  pointerKernel.free();
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include <occa.hpp>
+
+// A pipeline where the host prepares each chunk of input while the
+//   previous chunk is processed, comparing the synchronous initial
+//   stream with an async stream
+//
+// Overlap needs at least 2 cores, one for the host and one for the
+//   stream's worker
+const std::string processSource = (
+  "@kernel void process(const int N, const int work, const float *in, float *out) {"
+  "  for (int i = 0; i < N; ++i; @tile(64, @outer, @inner)) {"
+  "    float v = in[i];"
+  "    for (int w = 0; w < work; ++w) {"
+  "      v = sqrt(v + w);"
+  "    }"
+  "    out[i] = v;"
+  "  }"
+  "}"
+);
+
+// Stands in for reading and decoding input on the host
+void prepareChunk(std::vector<float> &chunk,
+                  const int chunkIndex,
+                  const int work) {
+  const int entries = (int) chunk.size();
+  for (int i = 0; i < entries; ++i) {
+    float v = (float) (chunkIndex + i);
+    for (int w = 0; w < work; ++w) {
+      v = std::sqrt(v + w);
+    }
+    chunk[i] = v;
+  }
+}
+
+double runPipeline(occa::device &device,
+                   occa::kernel &process,
+                   const int chunks,
+                   const int entries,
+                   const int work,
+                   const bool async) {
+  // Double-buffered so the host can fill one buffer while the
+  //   other is still being copied
+  std::vector<float> hostChunks[2] = {
+    std::vector<float>(entries),
+    std::vector<float>(entries)
+  };
+  occa::memory o_in[2] = {
+    device.malloc<float>(entries),
+    device.malloc<float>(entries)
+  };
+  occa::memory o_out = device.malloc<float>(entries);
+
+  occa::stream initialStream = device.getStream();
+  if (async) {
+    device.setStream(device.createStream());
+  }
+  const occa::properties copyProps = async ? "async: true" : "";
+
+  occa::streamTag chunkTags[2];
+  const double start = occa::sys::currentTime();
+  for (int c = 0; c < chunks; ++c) {
+    const int b = c % 2;
+    // Wait until the buffer's previous copy finished before reusing it
+    if (chunkTags[b].isInitialized()) {
+      device.waitFor(chunkTags[b]);
+    }
+    prepareChunk(hostChunks[b], c, work);
+
+    o_in[b].copyFrom(&(hostChunks[b][0]), copyProps);
+    chunkTags[b] = device.tagStream();
+    process(entries, work, o_in[b], o_out);
+  }
+  device.finish();
+  const double time = occa::sys::currentTime() - start;
+
+  device.setStream(initialStream);
+  o_in[0].free();
+  o_in[1].free();
+  o_out.free();
+  return time;
+}
+
+int main(const int argc, const char **argv) {
+  const int chunks  = (argc > 1) ? atoi(argv[1]) : 32;
+  const int entries = (argc > 2) ? atoi(argv[2]) : (1 << 14);
+  const int work    = (argc > 3) ? atoi(argv[3]) : 64;
+
+  occa::device device("mode: 'Serial'");
+  occa::kernel process = device.buildKernelFromString(processSource,
+                                                      "process");
+
+  const double syncTime  = runPipeline(device, process, chunks, entries, work, false);
+  const double asyncTime = runPipeline(device, process, chunks, entries, work, true);
+
+  printf("%d chunks of %d entries\n", chunks, entries);
+  printf("%-16s %12s\n", "stream", "ms");
+  printf("%-16s %12.2f\n", "synchronous", 1e3 * syncTime);
+  printf("%-16s %12.2f\n", "async", 1e3 * asyncTime);
+  printf("%-16s %11.2fx\n", "speedup", syncTime / asyncTime);
+
+  process.free();
+  device.free();
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+#include <cstdio>
+#include <vector>
+
+#include <occa.hpp>
+#include <occa/modes/openmp.hpp>
+
+// STREAM kernels on the OpenMP device, comparing buffers initialized
+//   from one thread with NUMA placement policies
+const std::string streamKernelSource = (
+  "@kernel void copy(const int N, const double *a, double *c) {"
+  "  for (int i = 0; i < N; ++i; @tile(1024, @outer, @inner)) {"
+  "    c[i] = a[i];"
+  "  }"
+  "}"
+  "@kernel void scale(const int N, const double s, const double *c, double *b) {"
+  "  for (int i = 0; i < N; ++i; @tile(1024, @outer, @inner)) {"
+  "    b[i] = s * c[i];"
+  "  }"
+  "}"
+  "@kernel void add(const int N, const double *a, const double *b, double *c) {"
+  "  for (int i = 0; i < N; ++i; @tile(1024, @outer, @inner)) {"
+  "    c[i] = a[i] + b[i];"
+  "  }"
+  "}"
+  "@kernel void triad(const int N, const double s, const double *b, const double *c, double *a) {"
+  "  for (int i = 0; i < N; ++i; @tile(1024, @outer, @inner)) {"
+  "    a[i] = b[i] + s * c[i];"
+  "  }"
+  "}"
+);
+
+// Best GB/s of [iterations] runs for each kernel
+void runStream(occa::device &device,
+               const int entries,
+               const int iterations,
+               const char *name,
+               const occa::properties &props) {
+  std::vector<double> init(entries, 1.0);
+  occa::memory a = device.malloc<double>(entries, &init[0], props);
+  occa::memory b = device.malloc<double>(entries, &init[0], props);
+  occa::memory c = device.malloc<double>(entries, &init[0], props);
+
+  occa::kernel copy  = device.buildKernelFromString(streamKernelSource, "copy");
+  occa::kernel scale = device.buildKernelFromString(streamKernelSource, "scale");
+  occa::kernel add   = device.buildKernelFromString(streamKernelSource, "add");
+  occa::kernel triad = device.buildKernelFromString(streamKernelSource, "triad");
+
+  const double s = 3.0;
+  const double bytes = sizeof(double) * (double) entries;
+  double best[4] = {0, 0, 0, 0};
+
+  for (int it = 0; it < iterations; ++it) {
+    double times[4];
+
+    double start = occa::sys::currentTime();
+    copy(entries, a, c);
+    device.finish();
+    times[0] = occa::sys::currentTime() - start;
+
+    start = occa::sys::currentTime();
+    scale(entries, s, c, b);
+    device.finish();
+    times[1] = occa::sys::currentTime() - start;
+
+    start = occa::sys::currentTime();
+    add(entries, a, b, c);
+    device.finish();
+    times[2] = occa::sys::currentTime() - start;
+
+    start = occa::sys::currentTime();
+    triad(entries, s, b, c, a);
+    device.finish();
+    times[3] = occa::sys::currentTime() - start;
+
+    // Copy and scale move 2 arrays, add and triad move 3
+    const double moved[4] = {2 * bytes, 2 * bytes, 3 * bytes, 3 * bytes};
+    for (int k = 0; k < 4; ++k) {
+      const double rate = moved[k] / times[k] / 1e9;
+      if (best[k] < rate) {
+        best[k] = rate;
+      }
+    }
+  }
+
+  printf("%-14s %10.2f %10.2f %10.2f %10.2f\n",
+         name, best[0], best[1], best[2], best[3]);
+}
+
+int main(const int argc, const char **argv) {
+  const int megabytes  = (argc > 1) ? atoi(argv[1]) : 512;
+  const int iterations = (argc > 2) ? atoi(argv[2]) : 10;
+  const int entries = (int) (((occa::udim_t) megabytes << 20) / sizeof(double));
+
+  if (!occa::modeIsEnabled("OpenMP")) {
+    printf("OpenMP mode is not enabled\n");
+    return 0;
+  }
+  occa::device device("mode: 'OpenMP'");
+
+  const occa::openmp::numaTopology_t topology = occa::openmp::getNumaTopology(device);
+  printf("%d NUMA nodes, memory policies %s\n",
+         topology.nodeCount(),
+         topology.policiesSupported ? "supported" : "unsupported");
+  for (int i = 0; i < topology.nodeCount(); ++i) {
+    printf("  node %d: %d CPUs, %.1f GB\n",
+           topology.nodes[i].id,
+           (int) topology.nodes[i].cpus.size(),
+           topology.nodes[i].memoryBytes / 1e9);
+  }
+
+  printf("3 x %d MB arrays, GB/s\n", megabytes);
+  printf("%-14s %10s %10s %10s %10s\n",
+         "placement", "copy", "scale", "add", "triad");
+  runStream(device, entries, iterations,
+            "serial init", occa::properties());
+  runStream(device, entries, iterations,
+            "first touch", "numa: 'first_touch'");
+  runStream(device, entries, iterations,
+            "interleave", "numa: 'interleave'");
+
+  device.free();
+
+  return 0;
+}
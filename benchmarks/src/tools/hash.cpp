@@ -0,0 +1,82 @@
+#include <cstdio>
+#include <vector>
+
+#include <occa.hpp>
+
+// Byte-at-a-time hash used before occa::hasher_t, kept for comparison
+occa::hash_t legacyHash(const void *ptr, occa::udim_t bytes) {
+  const char *c = (char*) ptr;
+
+  occa::hash_t hash;
+  int *h = hash.h;
+
+  const int p[8] = {
+    102679, 102701, 102761, 102763,
+    102769, 102793, 102797, 102811
+  };
+
+  for (occa::udim_t i = 0; i < bytes; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      h[j] = (h[j] * p[j]) ^ c[i];
+    }
+  }
+  hash.initialized = true;
+
+  return hash;
+}
+
+template <class hashFunction>
+double timeHash(hashFunction func,
+                const std::string &content,
+                const int iterations) {
+  int checksum = 0;
+  const double start = occa::sys::currentTime();
+  for (int i = 0; i < iterations; ++i) {
+    checksum ^= func(content.c_str(), content.size()).h[0];
+  }
+  const double end = occa::sys::currentTime();
+  // Keep the loop from being optimized away
+  if (checksum == 0x12345678) {
+    printf("\n");
+  }
+  return (end - start) / iterations;
+}
+
+occa::hash_t newHash(const void *ptr, occa::udim_t bytes) {
+  return occa::hash(ptr, bytes);
+}
+
+int main(const int argc, const char **argv) {
+  const int sizes[] = {64, 1024, 16 * 1024, 256 * 1024, 4 * 1024 * 1024};
+  const int sizeCount = (int) (sizeof(sizes) / sizeof(int));
+
+  printf("%12s %16s %16s %10s\n",
+         "bytes", "legacy (GB/s)", "hasher_t (GB/s)", "speedup");
+
+  for (int i = 0; i < sizeCount; ++i) {
+    const int bytes = sizes[i];
+    std::string content(bytes, ' ');
+    for (int j = 0; j < bytes; ++j) {
+      content[j] = (char) (33 + ((j * 7919) % 94));
+    }
+
+    // Roughly 64MB processed per measurement
+    int iterations = (64 * 1024 * 1024) / bytes;
+    const int legacyIterations = (iterations > 16) ? (iterations / 16) : 1;
+
+    // Warm up
+    timeHash(legacyHash, content, 1);
+    timeHash(newHash, content, 1);
+
+    const double legacyTime = timeHash(legacyHash, content, legacyIterations);
+    const double newTime = timeHash(newHash, content, iterations);
+
+    printf("%12d %16.3f %16.3f %9.1fx\n",
+           bytes,
+           bytes / legacyTime / 1e9,
+           bytes / newTime / 1e9,
+           legacyTime / newTime);
+  }
+
+  return 0;
+}
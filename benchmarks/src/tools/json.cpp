@@ -0,0 +1,127 @@
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include <occa.hpp>
+
+// Count heap allocations made while building and merging properties
+static long allocationCount = 0;
+
+void* operator new(size_t bytes) {
+  ++allocationCount;
+  void *ptr = ::malloc(bytes ? bytes : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) throw() {
+  ::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) throw() {
+  ::free(ptr);
+}
+
+// Roughly what a device carries around for kernel builds
+occa::properties deviceProperties() {
+  occa::properties props;
+  props["mode"] = "Serial";
+  props["kernel/compiler"] = "g++";
+  props["kernel/compiler_flags"] = "-O3 -march=native -fopenmp";
+  props["kernel/compiler_env_script"] = "";
+  props["kernel/vendor"] = 1;
+  props["kernel/verbose"] = false;
+  for (int i = 0; i < 16; ++i) {
+    props["kernel/defines/DEFINE_" + occa::toString(i)] = i;
+  }
+  for (int i = 0; i < 8; ++i) {
+    props["kernel/includes"].asArray() += "/usr/include/path_" + occa::toString(i);
+  }
+  props["memory/use_host_pointer"] = false;
+  props["stream/async"] = false;
+  return props;
+}
+
+occa::properties kernelProperties() {
+  occa::properties props;
+  props["defines/BLOCK_SIZE"] = 256;
+  props["defines/TILE"] = 16;
+  props["okl"] = true;
+  return props;
+}
+
+template <class benchFunction>
+void bench(const char *name,
+           benchFunction func,
+           const int iterations) {
+  // Warm up
+  func();
+
+  const long startAllocations = allocationCount;
+  const double start = occa::sys::currentTime();
+  int checksum = 0;
+  for (int i = 0; i < iterations; ++i) {
+    checksum += func();
+  }
+  const double end = occa::sys::currentTime();
+  const long allocations = allocationCount - startAllocations;
+
+  // Keep the loop from being optimized away
+  if (checksum == 0x12345678) {
+    printf("\n");
+  }
+
+  printf("%-28s %12.3f %16.1f\n",
+         name,
+         1e6 * (end - start) / iterations,
+         ((double) allocations) / iterations);
+}
+
+int main(const int argc, const char **argv) {
+  const occa::properties device = deviceProperties();
+  const occa::properties kernel = kernelProperties();
+  const int iterations = 20000;
+
+  printf("%-28s %12s %16s\n",
+         "", "time (us)", "allocations");
+
+  bench("copy", [&]() {
+    occa::properties copy = device;
+    return copy.size();
+  }, iterations);
+
+  bench("device + kernel", [&]() {
+    occa::properties sum = device + kernel;
+    return sum.size();
+  }, iterations);
+
+  bench("device[kernel] + kernel", [&]() {
+    occa::properties sum = (
+      ((const occa::properties&) device["kernel"]) + kernel
+    );
+    return sum.size();
+  }, iterations);
+
+  bench("merge + read", [&]() {
+    occa::properties sum = device + kernel;
+    return (int) sum["kernel/defines/BLOCK_SIZE"];
+  }, iterations);
+
+  bench("merge + write", [&]() {
+    occa::properties sum = device + kernel;
+    sum["kernel/defines/BLOCK_SIZE"] = 128;
+    return sum.size();
+  }, iterations);
+
+  bench("hash", [&]() {
+    return device.hash().h[0];
+  }, iterations / 10);
+
+  printf("%-28s %12d\n",
+         "sizeof(occa::json)",
+         (int) sizeof(occa::json));
+
+  return 0;
+}
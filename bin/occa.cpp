@@ -3,6 +3,7 @@
 #include <occa.hpp>
 #include <occa/lang/modes/serial.hpp>
 #include <occa/lang/modes/openmp.hpp>
+#include <occa/lang/modes/threads.hpp>
 #include <occa/lang/modes/cuda.hpp>
 #include <occa/lang/modes/hip.hpp>
 #include <occa/lang/modes/opencl.hpp>
@@ -155,6 +156,8 @@ bool runTranslate(const json &args) {
     parser = new lang::okl::serialParser(kernelProps);
   } else if (mode == "OpenMP") {
     parser = new lang::okl::openmpParser(kernelProps);
+  } else if (mode == "Threads") {
+    parser = new lang::okl::threadsParser(kernelProps);
   } else if (mode == "CUDA") {
     parser = new lang::okl::cudaParser(kernelProps);
   } else if (mode == "HIP") {
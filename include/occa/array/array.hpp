@@ -5,6 +5,7 @@
 #include <occa/core/base.hpp>
 #include <occa/tools/misc.hpp>
 #include <occa/array/linalg.hpp>
+#include <occa/array/expression.hpp>
 
 namespace occa {
   static const int copyOnHost          = (1 << 0);
@@ -22,7 +23,7 @@ namespace occa {
 
     TM *ptr_;
 
-    int ks_[6];     // Passed to the kernel, not a problem for 32-bit
+    udim_t ks_[6];  // Sizes, 64-bit to support arrays past 2^31 entries
     udim_t s_[6];   // Strides
 
     int idxCount;
@@ -344,7 +345,12 @@ namespace occa {
     //==================================
 
     //---[ Subarray ]-------------------
-    array operator + (const udim_t offset);
+    array offset(const udim_t offset) const;
+
+    // Integer constants still offset the array for existing callers,
+    //   floating-point constants are added elementwise
+    OCCA_DEPRECATED("Use array::offset() to offset arrays")
+    array operator + (const udim_t offset) const;
     //==================================
 
     //---[ Assignment Operators ]-------
@@ -377,6 +383,32 @@ namespace occa {
     array& operator /= (const array<TM2,idxType2> &vec);
     //==================================
 
+    //---[ Expressions ]----------------
+    // Expressions such as [a = b + 2*c - d] run as a single fused
+    //   kernel instead of one kernel per operation
+    template <class EXPR>
+    array& operator = (const arrayExpr<EXPR> &expr);
+
+    template <class EXPR>
+    array& operator += (const arrayExpr<EXPR> &expr);
+
+    template <class EXPR>
+    array& operator -= (const arrayExpr<EXPR> &expr);
+
+    template <class EXPR>
+    array& operator *= (const arrayExpr<EXPR> &expr);
+
+    template <class EXPR>
+    array& operator /= (const arrayExpr<EXPR> &expr);
+
+  private:
+    template <class EXPR>
+    void runExpr(const std::string &op,
+                 const arrayExpr<EXPR> &expr);
+
+  public:
+    //==================================
+
     //---[ Linear Algebra ]-------------
     TM l1Norm();
     template <class RETTYPE>
@@ -1009,7 +1009,7 @@ namespace occa {
 
   //---[ Subarray ]---------------------
   template <class TM, const int idxType>
-  inline array<TM,idxType> array<TM,idxType>::operator + (const udim_t offset) {
+  inline array<TM,idxType> array<TM,idxType>::offset(const udim_t offset) const {
     array<TM,idxType> ret = *this;
     udim_t byteOffset = offset * sizeof(TM);
     ret.memory_ += byteOffset;
@@ -1017,6 +1017,11 @@ namespace occa {
     ret.reshape(size() - offset);
     return ret;
   }
+
+  template <class TM, const int idxType>
+  inline array<TM,idxType> array<TM,idxType>::operator + (const udim_t offset_) const {
+    return offset(offset_);
+  }
   //====================================
 
   //---[ Assignment Operators ]-------
@@ -1091,6 +1096,54 @@ namespace occa {
   }
   //====================================
 
+  //---[ Expressions ]------------------
+  template <class TM, const int idxType>
+  template <class EXPR>
+  array<TM,idxType>& array<TM,idxType>::operator = (const arrayExpr<EXPR> &expr) {
+    runExpr("=", expr);
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class EXPR>
+  array<TM,idxType>& array<TM,idxType>::operator += (const arrayExpr<EXPR> &expr) {
+    runExpr("+=", expr);
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class EXPR>
+  array<TM,idxType>& array<TM,idxType>::operator -= (const arrayExpr<EXPR> &expr) {
+    runExpr("-=", expr);
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class EXPR>
+  array<TM,idxType>& array<TM,idxType>::operator *= (const arrayExpr<EXPR> &expr) {
+    runExpr("*=", expr);
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class EXPR>
+  array<TM,idxType>& array<TM,idxType>::operator /= (const arrayExpr<EXPR> &expr) {
+    runExpr("/=", expr);
+    return *this;
+  }
+
+  template <class TM, const int idxType>
+  template <class EXPR>
+  void array<TM,idxType>::runExpr(const std::string &op,
+                                  const arrayExpr<EXPR> &expr) {
+    arrayExprBuilder builder(memory_,
+                             memory_.size() / sizeof(TM),
+                             primitiveinfo<TM>::name);
+    const std::string source = expr.self().build(builder);
+    builder.run(op, source);
+  }
+  //====================================
+
   //---[ Linear Algebra ]---------------
   template <class TM, const int idxType>
   TM array<TM,idxType>::l1Norm() {
@@ -0,0 +1,209 @@
+#ifndef OCCA_ARRAY_EXPRESSION_HEADER
+#define OCCA_ARRAY_EXPRESSION_HEADER
+
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/core/base.hpp>
+#include <occa/types.hpp>
+
+namespace occa {
+  template <class TM, const int idxType>
+  class array;
+
+  //---[ Expression Builder ]-----------
+  // Collects the vectors and constants of an expression tree and
+  //   runs it as a single fused kernel:
+  //
+  //   a = b + 2*c - d;
+  //
+  // generates
+  //
+  //   v0[i] = ((v1[i] + (c0 * v2[i])) - v3[i]);
+  //
+  // Kernels are cached by the formula, which encodes the expression
+  //   shape, and the vector/constant types
+  class arrayExprBuilder {
+  private:
+    udim_t entries;
+    std::vector<occa::memory> vectors;
+    strVector vectorTypes;
+    std::vector<occa::kernelArg> constants;
+    strVector constantTypes;
+
+  public:
+    arrayExprBuilder(occa::memory output,
+                     const udim_t entries_,
+                     const std::string &outputType);
+
+    // Returns the vector's source, reusing the index of vectors
+    //   already in the expression (including the output)
+    std::string addVector(occa::memory vec,
+                          const udim_t vecEntries,
+                          const std::string &type);
+
+    std::string addConstant(const occa::kernelArg &value,
+                            const std::string &type);
+
+    // Runs [v0[i] <op> source] in one kernel
+    void run(const std::string &op,
+             const std::string &source,
+             const int tileSize = 128);
+  };
+  //====================================
+
+  //---[ Expression Nodes ]-------------
+  template <class EXPR>
+  class arrayExpr {
+  public:
+    inline const EXPR& self() const {
+      return static_cast<const EXPR&>(*this);
+    }
+  };
+
+  template <class TM>
+  class arrayExprVector : public arrayExpr<arrayExprVector<TM> > {
+  public:
+    occa::memory vec;
+
+    template <const int idxType>
+    arrayExprVector(const array<TM,idxType> &array_);
+
+    std::string build(arrayExprBuilder &builder) const;
+  };
+
+  template <class TM>
+  class arrayExprConstant : public arrayExpr<arrayExprConstant<TM> > {
+  public:
+    TM value;
+
+    arrayExprConstant(const TM &value_);
+
+    std::string build(arrayExprBuilder &builder) const;
+  };
+
+  template <class LHS, class RHS>
+  class arrayExprBinary : public arrayExpr<arrayExprBinary<LHS,RHS> > {
+  public:
+    // Subexpressions are stored by value so expressions can outlive
+    //   the temporaries they were built from
+    LHS lhs;
+    RHS rhs;
+    char op;
+
+    arrayExprBinary(const LHS &lhs_,
+                    const RHS &rhs_,
+                    const char op_);
+
+    std::string build(arrayExprBuilder &builder) const;
+  };
+
+  template <class EXPR>
+  class arrayExprNegate : public arrayExpr<arrayExprNegate<EXPR> > {
+  public:
+    EXPR expr;
+
+    arrayExprNegate(const EXPR &expr_);
+
+    std::string build(arrayExprBuilder &builder) const;
+  };
+  //====================================
+
+  //---[ Scalars ]----------------------
+  // Restricts constants to types that can be passed as kernel
+  //   arguments, which also keeps expressions from matching them
+  template <class TM>
+  class arrayExprScalar {};
+
+#define OCCA_ARRAY_EXPR_SCALAR(TYPE)            \
+  template <>                                   \
+  class arrayExprScalar<TYPE> {                 \
+  public:                                       \
+    typedef arrayExprConstant<TYPE> node_t;     \
+  }
+
+  OCCA_ARRAY_EXPR_SCALAR(int);
+  OCCA_ARRAY_EXPR_SCALAR(unsigned int);
+  OCCA_ARRAY_EXPR_SCALAR(long);
+  OCCA_ARRAY_EXPR_SCALAR(unsigned long);
+  OCCA_ARRAY_EXPR_SCALAR(float);
+  OCCA_ARRAY_EXPR_SCALAR(double);
+
+  // array + integer still offsets the array, so only floating-point
+  //   constants are added to arrays elementwise
+  template <class TM>
+  class arrayExprFloatScalar {};
+
+  template <>
+  class arrayExprFloatScalar<float> : public arrayExprScalar<float> {};
+
+  template <>
+  class arrayExprFloatScalar<double> : public arrayExprScalar<double> {};
+  //====================================
+
+  //---[ Operators ]--------------------
+#define OCCA_ARRAY_EXPR_OPERATOR(OP)                                      \
+  template <class LHS, class RHS>                                         \
+  arrayExprBinary<LHS, RHS>                                               \
+  operator OP (const arrayExpr<LHS> &lhs,                                 \
+               const arrayExpr<RHS> &rhs);                                \
+                                                                          \
+  template <class LHS, class TM, const int idxType>                       \
+  arrayExprBinary<LHS, arrayExprVector<TM> >                              \
+  operator OP (const arrayExpr<LHS> &lhs,                                 \
+               const array<TM,idxType> &rhs);                             \
+                                                                          \
+  template <class TM, const int idxType, class RHS>                       \
+  arrayExprBinary<arrayExprVector<TM>, RHS>                               \
+  operator OP (const array<TM,idxType> &lhs,                              \
+               const arrayExpr<RHS> &rhs);                                \
+                                                                          \
+  template <class TM, const int idxType, class TM2, const int idxType2>   \
+  arrayExprBinary<arrayExprVector<TM>, arrayExprVector<TM2> >             \
+  operator OP (const array<TM,idxType> &lhs,                              \
+               const array<TM2,idxType2> &rhs);                           \
+                                                                          \
+  template <class LHS, class TM>                                          \
+  arrayExprBinary<LHS, typename arrayExprScalar<TM>::node_t>              \
+  operator OP (const arrayExpr<LHS> &lhs,                                 \
+               const TM &rhs);                                            \
+                                                                          \
+  template <class TM, class RHS>                                          \
+  arrayExprBinary<typename arrayExprScalar<TM>::node_t, RHS>              \
+  operator OP (const TM &lhs,                                             \
+               const arrayExpr<RHS> &rhs);                                \
+                                                                          \
+  template <class TM, class TM2, const int idxType2>                      \
+  arrayExprBinary<typename arrayExprScalar<TM>::node_t,                   \
+                  arrayExprVector<TM2> >                                  \
+  operator OP (const TM &lhs,                                             \
+               const array<TM2,idxType2> &rhs)
+
+#define OCCA_ARRAY_EXPR_SCALAR_OPERATOR(OP, SCALAR)                       \
+  template <class TM, const int idxType, class TM2>                       \
+  arrayExprBinary<arrayExprVector<TM>,                                    \
+                  typename SCALAR<TM2>::node_t>                           \
+  operator OP (const array<TM,idxType> &lhs,                              \
+               const TM2 &rhs)
+
+  OCCA_ARRAY_EXPR_OPERATOR(+);
+  OCCA_ARRAY_EXPR_OPERATOR(-);
+  OCCA_ARRAY_EXPR_OPERATOR(*);
+  OCCA_ARRAY_EXPR_OPERATOR(/);
+
+  OCCA_ARRAY_EXPR_SCALAR_OPERATOR(+, arrayExprFloatScalar);
+  OCCA_ARRAY_EXPR_SCALAR_OPERATOR(-, arrayExprScalar);
+  OCCA_ARRAY_EXPR_SCALAR_OPERATOR(*, arrayExprScalar);
+  OCCA_ARRAY_EXPR_SCALAR_OPERATOR(/, arrayExprScalar);
+
+  template <class EXPR>
+  arrayExprNegate<EXPR> operator - (const arrayExpr<EXPR> &expr);
+
+  template <class TM, const int idxType>
+  arrayExprNegate<arrayExprVector<TM> > operator - (const array<TM,idxType> &vec);
+  //====================================
+}
+
+#include "expression.tpp"
+
+#endif
@@ -0,0 +1,146 @@
+namespace occa {
+  //---[ Expression Nodes ]-------------
+  template <class TM>
+  template <const int idxType>
+  arrayExprVector<TM>::arrayExprVector(const array<TM,idxType> &array_) :
+    vec(array_.memory()) {}
+
+  template <class TM>
+  std::string arrayExprVector<TM>::build(arrayExprBuilder &builder) const {
+    return builder.addVector(vec,
+                             vec.size() / sizeof(TM),
+                             primitiveinfo<TM>::name);
+  }
+
+  template <class TM>
+  arrayExprConstant<TM>::arrayExprConstant(const TM &value_) :
+    value(value_) {}
+
+  template <class TM>
+  std::string arrayExprConstant<TM>::build(arrayExprBuilder &builder) const {
+    return builder.addConstant(value,
+                               primitiveinfo<TM>::name);
+  }
+
+  template <class LHS, class RHS>
+  arrayExprBinary<LHS,RHS>::arrayExprBinary(const LHS &lhs_,
+                                            const RHS &rhs_,
+                                            const char op_) :
+    lhs(lhs_),
+    rhs(rhs_),
+    op(op_) {}
+
+  template <class LHS, class RHS>
+  std::string arrayExprBinary<LHS,RHS>::build(arrayExprBuilder &builder) const {
+    // Build in order to number vectors and constants from left to right
+    const std::string lhsSource = lhs.build(builder);
+    const std::string rhsSource = rhs.build(builder);
+    return "(" + lhsSource + " " + op + " " + rhsSource + ")";
+  }
+
+  template <class EXPR>
+  arrayExprNegate<EXPR>::arrayExprNegate(const EXPR &expr_) :
+    expr(expr_) {}
+
+  template <class EXPR>
+  std::string arrayExprNegate<EXPR>::build(arrayExprBuilder &builder) const {
+    return "(-" + expr.build(builder) + ")";
+  }
+  //====================================
+
+  //---[ Operators ]--------------------
+#define OCCA_ARRAY_EXPR_OPERATOR_DEFINITION(OP)                           \
+  template <class LHS, class RHS>                                         \
+  arrayExprBinary<LHS, RHS>                                               \
+  operator OP (const arrayExpr<LHS> &lhs,                                 \
+               const arrayExpr<RHS> &rhs) {                               \
+    return arrayExprBinary<LHS, RHS>(lhs.self(), rhs.self(), (#OP)[0]);   \
+  }                                                                       \
+                                                                          \
+  template <class LHS, class TM, const int idxType>                       \
+  arrayExprBinary<LHS, arrayExprVector<TM> >                              \
+  operator OP (const arrayExpr<LHS> &lhs,                                 \
+               const array<TM,idxType> &rhs) {                            \
+    return arrayExprBinary<LHS, arrayExprVector<TM> >(                    \
+      lhs.self(), rhs, (#OP)[0]                                           \
+    );                                                                    \
+  }                                                                       \
+                                                                          \
+  template <class TM, const int idxType, class RHS>                       \
+  arrayExprBinary<arrayExprVector<TM>, RHS>                               \
+  operator OP (const array<TM,idxType> &lhs,                              \
+               const arrayExpr<RHS> &rhs) {                               \
+    return arrayExprBinary<arrayExprVector<TM>, RHS>(                     \
+      lhs, rhs.self(), (#OP)[0]                                           \
+    );                                                                    \
+  }                                                                       \
+                                                                          \
+  template <class TM, const int idxType, class TM2, const int idxType2>   \
+  arrayExprBinary<arrayExprVector<TM>, arrayExprVector<TM2> >             \
+  operator OP (const array<TM,idxType> &lhs,                              \
+               const array<TM2,idxType2> &rhs) {                          \
+    return arrayExprBinary<arrayExprVector<TM>, arrayExprVector<TM2> >(   \
+      lhs, rhs, (#OP)[0]                                                  \
+    );                                                                    \
+  }                                                                       \
+                                                                          \
+  template <class LHS, class TM>                                          \
+  arrayExprBinary<LHS, typename arrayExprScalar<TM>::node_t>              \
+  operator OP (const arrayExpr<LHS> &lhs,                                 \
+               const TM &rhs) {                                           \
+    return arrayExprBinary<LHS, arrayExprConstant<TM> >(                  \
+      lhs.self(), rhs, (#OP)[0]                                           \
+    );                                                                    \
+  }                                                                       \
+                                                                          \
+  template <class TM, class RHS>                                          \
+  arrayExprBinary<typename arrayExprScalar<TM>::node_t, RHS>              \
+  operator OP (const TM &lhs,                                             \
+               const arrayExpr<RHS> &rhs) {                               \
+    return arrayExprBinary<arrayExprConstant<TM>, RHS>(                   \
+      lhs, rhs.self(), (#OP)[0]                                           \
+    );                                                                    \
+  }                                                                       \
+                                                                          \
+  template <class TM, class TM2, const int idxType2>                      \
+  arrayExprBinary<typename arrayExprScalar<TM>::node_t,                   \
+                  arrayExprVector<TM2> >                                  \
+  operator OP (const TM &lhs,                                             \
+               const array<TM2,idxType2> &rhs) {                          \
+    return arrayExprBinary<arrayExprConstant<TM>, arrayExprVector<TM2> >( \
+      lhs, rhs, (#OP)[0]                                                  \
+    );                                                                    \
+  }
+
+#define OCCA_ARRAY_EXPR_SCALAR_OPERATOR_DEFINITION(OP, SCALAR)            \
+  template <class TM, const int idxType, class TM2>                       \
+  arrayExprBinary<arrayExprVector<TM>,                                    \
+                  typename SCALAR<TM2>::node_t>                           \
+  operator OP (const array<TM,idxType> &lhs,                              \
+               const TM2 &rhs) {                                          \
+    return arrayExprBinary<arrayExprVector<TM>, arrayExprConstant<TM2> >( \
+      lhs, rhs, (#OP)[0]                                                  \
+    );                                                                    \
+  }
+
+  OCCA_ARRAY_EXPR_OPERATOR_DEFINITION(+)
+  OCCA_ARRAY_EXPR_OPERATOR_DEFINITION(-)
+  OCCA_ARRAY_EXPR_OPERATOR_DEFINITION(*)
+  OCCA_ARRAY_EXPR_OPERATOR_DEFINITION(/)
+
+  OCCA_ARRAY_EXPR_SCALAR_OPERATOR_DEFINITION(+, arrayExprFloatScalar)
+  OCCA_ARRAY_EXPR_SCALAR_OPERATOR_DEFINITION(-, arrayExprScalar)
+  OCCA_ARRAY_EXPR_SCALAR_OPERATOR_DEFINITION(*, arrayExprScalar)
+  OCCA_ARRAY_EXPR_SCALAR_OPERATOR_DEFINITION(/, arrayExprScalar)
+
+  template <class EXPR>
+  arrayExprNegate<EXPR> operator - (const arrayExpr<EXPR> &expr) {
+    return arrayExprNegate<EXPR>(expr.self());
+  }
+
+  template <class TM, const int idxType>
+  arrayExprNegate<arrayExprVector<TM> > operator - (const array<TM,idxType> &vec) {
+    return arrayExprNegate<arrayExprVector<TM> >(vec);
+  }
+  //====================================
+}
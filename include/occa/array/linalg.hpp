@@ -2,11 +2,14 @@
 #define OCCA_ARRAY_LINALG_HEADER
 
 #include <cmath>
+#include <map>
+#include <vector>
 
 #include <occa/defines.hpp>
 #include <occa/core/base.hpp>
 #include <occa/core/kernelBuilder.hpp>
 #include <occa/tools/env.hpp>
+#include <occa/tools/sys.hpp>
 
 namespace occa {
   namespace linalg {
@@ -15,30 +18,74 @@ namespace occa {
       32, 64, 128, 256, 512, 1024, 2048
     };
 
+    //---[ Index Types ]----------------
+    // Kernels are built for each index type and pick int when the
+    //   entries fit, since 32-bit indexing is faster
+    // The margin keeps loop counters stepping past the last entry,
+    //   by a tile or a grid stride, from overflowing
+    static const udim_t max32BitEntries = (((udim_t) 1 << 31)
+                                           - ((udim_t) 1 << 20));
+
+    static const int indexTypeCount = 2;
+    static const char* const indexTypes[2] = {
+      "int", "long"
+    };
+
+    inline int getIndexType(const udim_t entries) {
+      return (entries <= max32BitEntries) ? 0 : 1;
+    }
+
+    inline occa::kernelArg indexArg(const udim_t entries) {
+      if (getIndexType(entries) == 0) {
+        return (int) entries;
+      }
+      return (int64_t) entries;
+    }
+    //==================================
+
     template <class VTYPE_IN, class VTYPE_OUT>
     kernelBuilder makeAssignmentBuilder(const std::string &kernelName,
-                                        const int tileSize);
+                                        const int tileSize,
+                                        const int indexType);
 
+    // Builders for each index type and tile size
     template <class VTYPE_IN, class VTYPE_OUT>
     kernelBuilderVector makeAssignmentBuilders(const std::string &kernelName);
 
     inline occa::kernel getTiledKernel(kernelBuilderVector &builders,
                                        occa::device dev,
-                                       const int tileSize) {
+                                       const int tileSize,
+                                       const udim_t entries) {
       int i;
       for (i = 1; i < usedTileSizeCount; ++i) {
         if (usedTileSizes[i] > tileSize) {
           break;
         }
       }
-      return builders[i - 1].build(dev);
+      const int offset = getIndexType(entries) * usedTileSizeCount;
+      return builders[offset + i - 1].build(dev);
+    }
+
+    inline occa::kernel getIndexedKernel(kernelBuilderVector &builders,
+                                         occa::device dev,
+                                         const udim_t entries) {
+      return builders[getIndexType(entries)].build(dev);
     }
 
     template <class VTYPE, class RETTYPE>
-    kernelBuilder makeLinalgBuilder(const std::string &kernelName);
+    kernelBuilder makeLinalgBuilder(const std::string &kernelName,
+                                    const int indexType);
 
     template <class VTYPE1, class VTYPE2, class RETTYPE>
-    kernelBuilder makeLinalgBuilder(const std::string &kernelName);
+    kernelBuilder makeLinalgBuilder(const std::string &kernelName,
+                                    const int indexType);
+
+    // Builders for each index type
+    template <class VTYPE, class RETTYPE>
+    kernelBuilderVector makeLinalgBuilders(const std::string &kernelName);
+
+    template <class VTYPE1, class VTYPE2, class RETTYPE>
+    kernelBuilderVector makeLinalgBuilders(const std::string &kernelName);
 
     //---[ Assignment ]-----------------
     template <class VTYPE_OUT>
@@ -106,9 +153,18 @@ namespace occa {
     occa::memory deviceReductionBuffer(occa::device device,
                                        const int size);
 
+    // Modes that compile kernels with OCCA_USING_GPU
+    bool usesGpuReductions(const std::string &mode);
+
+    // Reduction kernels write one partial per outer iteration, set by
+    //   the (possibly tuned) CPU_DOT_OUTER or GPU_DOT_OUTER define
+    int getReductionPartials(occa::kernel kernel);
+
+    // Sets [bufferSize] to the number of partials returned
     template <class VTYPE, class RETTYPE>
     RETTYPE* reduce(occa::memory vec,
-                    occa::kernelBuilder &builder);
+                    kernelBuilderVector &builders,
+                    int &bufferSize);
 
     template <class VTYPE, class RETTYPE>
     RETTYPE l1Norm(occa::memory vec);
@@ -147,6 +203,105 @@ namespace occa {
                                      const std::string &formula,
                                      const occa::properties &props = occa::properties());
     //==================================
+
+    //---[ Tuning ]---------------------
+    static const int tunedDotOuterCount = 3;
+    static const int tunedDotOuters[3] = {
+      256, 1024, 4096
+    };
+
+    static const int tunedDotInnerCount = 3;
+    static const int tunedDotInners[3] = {
+      64, 128, 256
+    };
+
+    json reductionSearchSpace(const std::string &mode);
+    json tileSearchSpace();
+
+    // Tunes the reduction block sizes and the default tile size of the
+    //   assignment kernels on [device] for vectors of [entries]
+    //   - Results are stored in the device's tuning database and used
+    //     by linalg kernels built afterwards, including in later runs
+    //   - Kernels already built in this process keep their variant
+    template <class VTYPE, class RETTYPE>
+    void tune(occa::device device,
+              const udim_t entries = (1 << 22),
+              const occa::properties &tuneProps = occa::properties());
+    //==================================
+
+    //---[ Fused Reductions ]-----------
+    // Blocks reduced in the first stage, each writing one partial
+    static const int multiReduceBlocks = 1024;
+    // Threads per block in GPU modes
+    static const int multiReduceInner = 128;
+
+    namespace reductionType {
+      enum type_t {
+        sum,
+        l1Norm,
+        l2Norm,
+        lInfNorm,
+        max,
+        min,
+        dot,
+        distance
+      };
+    }
+
+    // [vec1] and [vec2] index the vectors passed to multiReduce
+    //   [vec2] is only used by dot and distance
+    class reduction_t {
+    public:
+      reductionType::type_t type;
+      int vec1, vec2;
+
+      reduction_t(const reductionType::type_t type_,
+                  const int vec1_,
+                  const int vec2_ = -1);
+
+      bool usesTwoVectors() const;
+      // max, min and lInfNorm start from the first entry
+      bool needsEntries() const;
+      std::string toString() const;
+    };
+
+    typedef std::vector<reduction_t> reductionVector;
+
+    // Results of multiReduce, left on the device until requested
+    // Keep the future alive until the reductions finished
+    template <class RETTYPE>
+    class reductionFuture {
+    private:
+      occa::memory results;
+      occa::memory partials;
+
+    public:
+      reductionFuture();
+
+      reductionFuture(occa::memory results_,
+                      occa::memory partials_);
+
+      bool isInitialized() const;
+      int size() const;
+
+      // One RETTYPE per reduction, in the order they were given
+      occa::memory getMemory() const;
+
+      // Waits for the reductions to finish
+      RETTYPE get(const int index) const;
+      std::vector<RETTYPE> getAll() const;
+    };
+
+    // Source for the two-stage kernels computing [reductions] in one pass
+    std::string multiReduceSource(const reductionVector &reductions,
+                                  const int vectorCount);
+
+    // Computes all [reductions] over [vecs] in one pass, with the final
+    //   stage on the device and without synchronizing
+    template <class VTYPE, class RETTYPE>
+    reductionFuture<RETTYPE> multiReduce(const reductionVector &reductions,
+                                         const std::vector<occa::memory> &vecs);
+    //==================================
   }
 }
 
@@ -2,54 +2,67 @@ namespace occa {
   namespace linalg {
     template <class VTYPE_IN, class VTYPE_OUT>
     kernelBuilder makeAssignmentBuilder(const std::string &kernelName,
-                                        const int tileSize) {
+                                        const int tileSize,
+                                        const int indexType) {
       return kernelBuilder::fromFile(env::OCCA_DIR + "include/occa/array/kernels/assignment.okl",
                                      kernelName,
                                      "defines: {"
-                                     "  VTYPE_IN: '"  + primitiveinfo<VTYPE_IN>::name  + "',"
-                                     "  VTYPE_OUT: '" + primitiveinfo<VTYPE_OUT>::name + "',"
-                                     "  TILESIZE: '"  + toString(tileSize) + "',"
+                                     "  VTYPE_IN: '"   + primitiveinfo<VTYPE_IN>::name  + "',"
+                                     "  VTYPE_OUT: '"  + primitiveinfo<VTYPE_OUT>::name + "',"
+                                     "  TILESIZE: '"   + toString(tileSize) + "',"
+                                     "  INDEX_TYPE: '" + indexTypes[indexType] + "',"
                                      "}");
     }
 
     template <class VTYPE_IN, class VTYPE_OUT>
     kernelBuilderVector makeAssignmentBuilders(const std::string &kernelName) {
       kernelBuilderVector builders;
-      for (int i = 0; i < usedTileSizeCount; ++i) {
-        builders.push_back(makeAssignmentBuilder<VTYPE_IN,VTYPE_OUT>(kernelName,
-                                                                     usedTileSizes[i]));
+      for (int t = 0; t < indexTypeCount; ++t) {
+        for (int i = 0; i < usedTileSizeCount; ++i) {
+          builders.push_back(makeAssignmentBuilder<VTYPE_IN,VTYPE_OUT>(kernelName,
+                                                                       usedTileSizes[i],
+                                                                       t));
+        }
       }
       return builders;
     }
 
     template <class VTYPE, class RETTYPE>
-    kernelBuilder makeLinalgBuilder(const std::string &kernelName) {
-      return kernelBuilder::fromFile(env::OCCA_DIR + "include/occa/array/kernels/linalg.okl",
-                                     kernelName,
-                                     "defines: {"
-                                     "  VTYPE: '" + primitiveinfo<VTYPE>::name + "',"
-                                     "  VTYPE2: '" + primitiveinfo<VTYPE>::name + "',"
-                                     "  RETTYPE: '" + primitiveinfo<RETTYPE>::name + "',"
-                                     "  CPU_DOT_OUTER: 1024,"
-                                     "  GPU_DOT_OUTER: 1024,"
-                                     "  GPU_DOT_INNER: 128,"
-                                     "}");
+    kernelBuilder makeLinalgBuilder(const std::string &kernelName,
+                                    const int indexType) {
+      return makeLinalgBuilder<VTYPE, VTYPE, RETTYPE>(kernelName, indexType);
     }
 
     template <class VTYPE1, class VTYPE2, class RETTYPE>
-    kernelBuilder makeLinalgBuilder(const std::string &kernelName) {
+    kernelBuilder makeLinalgBuilder(const std::string &kernelName,
+                                    const int indexType) {
       return kernelBuilder::fromFile(env::OCCA_DIR + "include/occa/array/kernels/linalg.okl",
                                      kernelName,
                                      "defines: {"
-                                     "  VTYPE: '"   + primitiveinfo<VTYPE1>::name  + "',"
-                                     "  VTYPE2: '"  + primitiveinfo<VTYPE2>::name  + "',"
-                                     "  RETTYPE: '" + primitiveinfo<RETTYPE>::name + "',"
+                                     "  VTYPE: '"      + primitiveinfo<VTYPE1>::name  + "',"
+                                     "  VTYPE2: '"     + primitiveinfo<VTYPE2>::name  + "',"
+                                     "  RETTYPE: '"    + primitiveinfo<RETTYPE>::name + "',"
+                                     "  INDEX_TYPE: '" + indexTypes[indexType] + "',"
                                      "  CPU_DOT_OUTER: 1024,"
                                      "  GPU_DOT_OUTER: 1024,"
                                      "  GPU_DOT_INNER: 128,"
                                      "}");
     }
 
+    template <class VTYPE, class RETTYPE>
+    kernelBuilderVector makeLinalgBuilders(const std::string &kernelName) {
+      return makeLinalgBuilders<VTYPE, VTYPE, RETTYPE>(kernelName);
+    }
+
+    template <class VTYPE1, class VTYPE2, class RETTYPE>
+    kernelBuilderVector makeLinalgBuilders(const std::string &kernelName) {
+      kernelBuilderVector builders;
+      for (int t = 0; t < indexTypeCount; ++t) {
+        builders.push_back(makeLinalgBuilder<VTYPE1, VTYPE2, RETTYPE>(kernelName, t));
+      }
+      return builders;
+    }
+
     //---[ Assignment ]-----------------
     template <class VTYPE_OUT>
     void operator_eq(occa::memory vec,
@@ -58,10 +71,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_OUT,VTYPE_OUT>("eq_const");
 
-      const int entries = vec.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = vec.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      vec.getDevice(),
-                     tileSize)(entries, value, vec);
+                     tileSize,
+                     entries)(indexArg(entries), value, vec);
     }
 
     template <class VTYPE_OUT>
@@ -71,10 +85,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_OUT,VTYPE_OUT>("plus_eq_const");
 
-      const int entries = vec.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = vec.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      vec.getDevice(),
-                     tileSize)(entries, value, vec);
+                     tileSize,
+                     entries)(indexArg(entries), value, vec);
     }
 
     template <class VTYPE_IN, class VTYPE_OUT>
@@ -84,10 +99,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_IN,VTYPE_OUT>("plus_eq");
 
-      const int entries = in.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = in.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      in.getDevice(),
-                     tileSize)(entries, in, out);
+                     tileSize,
+                     entries)(indexArg(entries), in, out);
     }
 
     template <class VTYPE_OUT>
@@ -97,10 +113,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_OUT,VTYPE_OUT>("sub_eq_const");
 
-      const int entries = vec.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = vec.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      vec.getDevice(),
-                     tileSize)(entries, value, vec);
+                     tileSize,
+                     entries)(indexArg(entries), value, vec);
     }
 
     template <class VTYPE_IN, class VTYPE_OUT>
@@ -110,10 +127,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_IN,VTYPE_OUT>("sub_eq");
 
-      const int entries = in.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = in.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      in.getDevice(),
-                     tileSize)(entries, in, out);
+                     tileSize,
+                     entries)(indexArg(entries), in, out);
     }
 
     template <class VTYPE_OUT>
@@ -123,10 +141,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_OUT,VTYPE_OUT>("mult_eq_const");
 
-      const int entries = vec.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = vec.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      vec.getDevice(),
-                     tileSize)(entries, value, vec);
+                     tileSize,
+                     entries)(indexArg(entries), value, vec);
     }
 
     template <class VTYPE_IN, class VTYPE_OUT>
@@ -136,10 +155,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_IN,VTYPE_OUT>("mult_eq");
 
-      const int entries = in.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = in.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      in.getDevice(),
-                     tileSize)(entries, in, out);
+                     tileSize,
+                     entries)(indexArg(entries), in, out);
     }
 
     template <class VTYPE_OUT>
@@ -149,10 +169,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_OUT,VTYPE_OUT>("div_eq_const");
 
-      const int entries = vec.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = vec.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      vec.getDevice(),
-                     tileSize)(entries, value, vec);
+                     tileSize,
+                     entries)(indexArg(entries), value, vec);
     }
 
     template <class VTYPE_IN, class VTYPE_OUT>
@@ -162,10 +183,11 @@ namespace occa {
       static kernelBuilderVector builders =
         makeAssignmentBuilders<VTYPE_IN,VTYPE_OUT>("div_eq");
 
-      const int entries = in.size() / sizeof(VTYPE_OUT);
+      const udim_t entries = in.size() / sizeof(VTYPE_OUT);
       getTiledKernel(builders,
                      in.getDevice(),
-                     tileSize)(entries, in, out);
+                     tileSize,
+                     entries)(indexArg(entries), in, out);
     }
     //==================================
 
@@ -194,28 +216,32 @@ namespace occa {
 
     template <class VTYPE, class RETTYPE>
     RETTYPE* reduce(occa::memory vec,
-                    occa::kernelBuilder &builder,
-                    const int bufferSize) {
+                    kernelBuilderVector &builders,
+                    int &bufferSize) {
 
       device dev = vec.getDevice();
+      const udim_t entries = vec.size() / sizeof(VTYPE);
+      occa::kernel kernel = getIndexedKernel(builders, dev, entries);
+      bufferSize = getReductionPartials(kernel);
+
       RETTYPE *hostBuffer = hostReductionBuffer<RETTYPE>(bufferSize);
       memory deviceBuffer = deviceReductionBuffer<RETTYPE>(dev, bufferSize);
-      const int entries = vec.size() / sizeof(VTYPE);
-      builder.build(dev)(entries,
-                         vec,
-                         deviceBuffer);
+      kernel(indexArg(entries),
+             vec,
+             deviceBuffer);
       deviceBuffer.copyTo(hostBuffer);
       return hostBuffer;
     }
 
     template <class VTYPE, class RETTYPE>
     RETTYPE l1Norm(occa::memory vec) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE, RETTYPE>("l1Norm");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE, RETTYPE>("l1Norm");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
+      int partials;
+      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builders, partials);
       RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
+      for (int i = 0; i < partials; ++i) {
         ret += partialReduction[i];
       }
       delete [] partialReduction;
@@ -224,12 +250,13 @@ namespace occa {
 
     template <class VTYPE, class RETTYPE>
     RETTYPE l2Norm(occa::memory vec) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE, RETTYPE>("l2Norm");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE, RETTYPE>("l2Norm");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
+      int partials;
+      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builders, partials);
       RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
+      for (int i = 0; i < partials; ++i) {
         ret += partialReduction[i];
       }
       delete [] partialReduction;
@@ -239,23 +266,25 @@ namespace occa {
     template <class VTYPE, class RETTYPE>
     RETTYPE lpNorm(const float p,
                    occa::memory vec) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE, RETTYPE>("lpNorm");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE, RETTYPE>("lpNorm");
 
 
       device dev = vec.getDevice();
-      const int bufferSize = 1024;
+      const udim_t entries = vec.size() / sizeof(VTYPE);
+      occa::kernel kernel = getIndexedKernel(builders, dev, entries);
+      const int bufferSize = getReductionPartials(kernel);
+
       RETTYPE *hostBuffer = hostReductionBuffer<RETTYPE>(bufferSize);
       memory deviceBuffer = deviceReductionBuffer<RETTYPE>(dev, bufferSize);
-      const int entries = vec.size() / sizeof(VTYPE);
-      builder.build(dev)(entries,
-                         p,
-                         vec,
-                         deviceBuffer);
+      kernel(indexArg(entries),
+             p,
+             vec,
+             deviceBuffer);
       dev.finish();
       deviceBuffer.copyTo(hostBuffer);
       RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
+      for (int i = 0; i < bufferSize; ++i) {
         ret += hostBuffer[i];
       }
       delete [] hostBuffer;
@@ -264,12 +293,13 @@ namespace occa {
 
     template <class VTYPE, class RETTYPE>
     RETTYPE lInfNorm(occa::memory vec) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE, RETTYPE>("lInfNorm");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE, RETTYPE>("lInfNorm");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
+      int partials;
+      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builders, partials);
       RETTYPE ret = partialReduction[0];
-      for (int i = 1; i < 1024; ++i) {
+      for (int i = 1; i < partials; ++i) {
         const RETTYPE abs_i = partialReduction[i];
         if (ret < abs_i) {
           ret = abs_i;
@@ -281,12 +311,13 @@ namespace occa {
 
     template <class VTYPE, class RETTYPE>
     RETTYPE max(occa::memory vec) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE, RETTYPE>("vecMax");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE, RETTYPE>("vecMax");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
+      int partials;
+      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builders, partials);
       RETTYPE ret = partialReduction[0];
-      for (int i = 1; i < 1024; ++i) {
+      for (int i = 1; i < partials; ++i) {
         if (ret < partialReduction[i]) {
           ret = partialReduction[i];
         }
@@ -297,12 +328,13 @@ namespace occa {
 
     template <class VTYPE, class RETTYPE>
     RETTYPE min(occa::memory vec) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE, RETTYPE>("vecMin");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE, RETTYPE>("vecMin");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
+      int partials;
+      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builders, partials);
       RETTYPE ret = partialReduction[0];
-      for (int i = 1; i < 1024; ++i) {
+      for (int i = 1; i < partials; ++i) {
         if (ret > partialReduction[i]) {
           ret = partialReduction[i];
         }
@@ -313,25 +345,27 @@ namespace occa {
 
     template <class VTYPE1, class VTYPE2, class RETTYPE>
     RETTYPE dot(occa::memory vec1, occa::memory vec2) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE1, VTYPE2, RETTYPE>("dot");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE1, VTYPE2, RETTYPE>("dot");
 
       OCCA_ERROR("Vectors must be in the same device",
                  vec1.getDevice() == vec2.getDevice());
 
       device dev = vec1.getDevice();
-      const int bufferSize = 1024;
+      const udim_t entries = vec1.size() / sizeof(VTYPE1);
+      occa::kernel kernel = getIndexedKernel(builders, dev, entries);
+      const int bufferSize = getReductionPartials(kernel);
+
       RETTYPE *hostBuffer = hostReductionBuffer<RETTYPE>(bufferSize);
       memory deviceBuffer = deviceReductionBuffer<RETTYPE>(dev, bufferSize);
-      const int entries = vec1.size() / sizeof(VTYPE1);
-      builder.build(dev)(entries,
-                         vec1,
-                         vec2,
-                         deviceBuffer);
+      kernel(indexArg(entries),
+             vec1,
+             vec2,
+             deviceBuffer);
       dev.finish();
       deviceBuffer.copyTo(hostBuffer);
       RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
+      for (int i = 0; i < bufferSize; ++i) {
         ret += hostBuffer[i];
       }
       delete [] hostBuffer;
@@ -340,25 +374,27 @@ namespace occa {
 
     template <class VTYPE1, class VTYPE2, class RETTYPE>
     RETTYPE distance(occa::memory vec1, occa::memory vec2) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE1, VTYPE2, RETTYPE>("distance");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE1, VTYPE2, RETTYPE>("distance");
 
       OCCA_ERROR("Vectors must be in the same device",
                  vec1.getDevice() == vec2.getDevice());
 
       device dev = vec1.getDevice();
-      const int bufferSize = 1024;
+      const udim_t entries = vec1.size() / sizeof(VTYPE1);
+      occa::kernel kernel = getIndexedKernel(builders, dev, entries);
+      const int bufferSize = getReductionPartials(kernel);
+
       RETTYPE *hostBuffer = hostReductionBuffer<RETTYPE>(bufferSize);
       memory deviceBuffer = deviceReductionBuffer<RETTYPE>(dev, bufferSize);
-      const int entries = vec1.size() / sizeof(VTYPE1);
-      builder.build(dev)(entries,
-                         vec1,
-                         vec2,
-                         deviceBuffer);
+      kernel(indexArg(entries),
+             vec1,
+             vec2,
+             deviceBuffer);
       dev.finish();
       deviceBuffer.copyTo(hostBuffer);
       RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
+      for (int i = 0; i < bufferSize; ++i) {
         ret += hostBuffer[i];
       }
       delete [] hostBuffer;
@@ -367,12 +403,13 @@ namespace occa {
 
     template <class VTYPE, class RETTYPE>
     RETTYPE sum(occa::memory vec) {
-      static kernelBuilder builder =
-        makeLinalgBuilder<VTYPE, RETTYPE>("sum");
+      static kernelBuilderVector builders =
+        makeLinalgBuilders<VTYPE, RETTYPE>("sum");
 
-      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builder, 1024);
+      int partials;
+      RETTYPE *partialReduction = reduce<VTYPE,RETTYPE>(vec, builders, partials);
       RETTYPE ret = 0;
-      for (int i = 0; i < 1024; ++i) {
+      for (int i = 0; i < partials; ++i) {
         ret += partialReduction[i];
       }
       delete [] partialReduction;
@@ -387,24 +424,236 @@ namespace occa {
 
       static kernelBuilderVector builders;
       if (!builders.size()) {
-        for (int i = 0; i < usedTileSizeCount; ++i) {
-          kernelBuilder kerb =
-            customLinearMethod("axpy",
-                               "v0[i] += c0 * v1[i];",
-                               "defines: {"
-                               "  CTYPE0: '" + primitiveinfo<TYPE_A>::name + "',"
-                               "  VTYPE0: '" + primitiveinfo<VTYPE_Y>::name + "',"
-                               "  VTYPE1: '" + primitiveinfo<VTYPE_X>::name + "',"
-                               "  TILESIZE: '" + toString(usedTileSizes[i]) + "',"
-                               "}");
-          builders.push_back(kerb);
+        for (int t = 0; t < indexTypeCount; ++t) {
+          for (int i = 0; i < usedTileSizeCount; ++i) {
+            kernelBuilder kerb =
+              customLinearMethod("axpy",
+                                 "v0[i] += c0 * v1[i];",
+                                 "defines: {"
+                                 "  CTYPE0: '" + primitiveinfo<TYPE_A>::name + "',"
+                                 "  VTYPE0: '" + primitiveinfo<VTYPE_Y>::name + "',"
+                                 "  VTYPE1: '" + primitiveinfo<VTYPE_X>::name + "',"
+                                 "  TILESIZE: '" + toString(usedTileSizes[i]) + "',"
+                                 "  INDEX_TYPE: '" + indexTypes[t] + "',"
+                                 "}");
+            builders.push_back(kerb);
+          }
         }
       }
 
-      const int entries = y.size() / sizeof(VTYPE_Y);
+      const udim_t entries = y.size() / sizeof(VTYPE_Y);
       getTiledKernel(builders,
                      y.getDevice(),
-                     tileSize)(entries, alpha, y, x);
+                     tileSize,
+                     entries)(indexArg(entries), alpha, y, x);
+    }
+    //==================================
+
+    //---[ Tuning ]---------------------
+    template <class VTYPE, class RETTYPE>
+    void tune(occa::device device,
+              const udim_t entries,
+              const occa::properties &tuneProps) {
+      static const int reductionCount = 6;
+      static const char *reductionNames[6] = {
+        "l1Norm", "l2Norm", "lInfNorm", "vecMax", "vecMin", "sum"
+      };
+      static const int assignmentCount = 9;
+      static const char *assignmentNames[9] = {
+        "eq_const",
+        "plus_eq", "plus_eq_const",
+        "sub_eq", "sub_eq_const",
+        "mult_eq", "mult_eq_const",
+        "div_eq", "div_eq_const"
+      };
+
+      occa::memory vec1 = device.malloc(entries * sizeof(VTYPE));
+      occa::memory vec2 = device.malloc(entries * sizeof(VTYPE));
+      occa::memory buffer = device.malloc(tunedDotOuters[tunedDotOuterCount - 1]
+                                          * sizeof(RETTYPE));
+      operator_eq<VTYPE>(vec1, 1);
+      operator_eq<VTYPE>(vec2, 1);
+
+      const int indexType = getIndexType(entries);
+      const occa::kernelArg entriesArg = indexArg(entries);
+
+      // Reductions
+      const json reductionSpace = reductionSearchSpace(device.mode());
+      std::vector<occa::kernelArg> args;
+      for (int i = 0; i < reductionCount; ++i) {
+        args.clear();
+        args.push_back(entriesArg);
+        args.push_back(vec1);
+        args.push_back(buffer);
+        makeLinalgBuilder<VTYPE, RETTYPE>(reductionNames[i], indexType)
+          .tune(device, reductionSpace, args, tuneProps);
+      }
+
+      args.clear();
+      args.push_back(entriesArg);
+      args.push_back((float) 2);
+      args.push_back(vec1);
+      args.push_back(buffer);
+      makeLinalgBuilder<VTYPE, RETTYPE>("lpNorm", indexType)
+        .tune(device, reductionSpace, args, tuneProps);
+
+      args.clear();
+      args.push_back(entriesArg);
+      args.push_back(vec1);
+      args.push_back(vec2);
+      args.push_back(buffer);
+      makeLinalgBuilder<VTYPE, VTYPE, RETTYPE>("dot", indexType)
+        .tune(device, reductionSpace, args, tuneProps);
+      makeLinalgBuilder<VTYPE, VTYPE, RETTYPE>("distance", indexType)
+        .tune(device, reductionSpace, args, tuneProps);
+
+      // Assignments use the tuned tile size for the default tile size
+      const json tileSpace = tileSearchSpace();
+      const int defaultTileSize = 128;
+      for (int i = 0; i < assignmentCount; ++i) {
+        const std::string name = assignmentNames[i];
+        args.clear();
+        args.push_back(entriesArg);
+        if (endsWith(name, "_const")) {
+          args.push_back((VTYPE) 1);
+        } else {
+          args.push_back(vec2);
+        }
+        args.push_back(vec1);
+        makeAssignmentBuilder<VTYPE, VTYPE>(name, defaultTileSize, indexType)
+          .tune(device, tileSpace, args, tuneProps);
+      }
+
+      vec1.free();
+      vec2.free();
+      buffer.free();
+    }
+    //==================================
+
+    //---[ Fused Reductions ]-----------
+    template <class RETTYPE>
+    reductionFuture<RETTYPE>::reductionFuture() {}
+
+    template <class RETTYPE>
+    reductionFuture<RETTYPE>::reductionFuture(occa::memory results_,
+                                              occa::memory partials_) :
+      results(results_),
+      partials(partials_) {}
+
+    template <class RETTYPE>
+    bool reductionFuture<RETTYPE>::isInitialized() const {
+      return results.isInitialized();
+    }
+
+    template <class RETTYPE>
+    int reductionFuture<RETTYPE>::size() const {
+      return (int) (results.size() / sizeof(RETTYPE));
+    }
+
+    template <class RETTYPE>
+    occa::memory reductionFuture<RETTYPE>::getMemory() const {
+      return results;
+    }
+
+    template <class RETTYPE>
+    RETTYPE reductionFuture<RETTYPE>::get(const int index) const {
+      OCCA_ERROR("Reduction index [" << index << "] is out of bounds,"
+                 << " there are only " << size() << " reductions",
+                 (0 <= index) && (index < size()));
+      RETTYPE value;
+      results.copyTo(&value, sizeof(RETTYPE), index * sizeof(RETTYPE));
+      return value;
+    }
+
+    template <class RETTYPE>
+    std::vector<RETTYPE> reductionFuture<RETTYPE>::getAll() const {
+      std::vector<RETTYPE> values(size());
+      if (values.size()) {
+        results.copyTo(&(values[0]));
+      }
+      return values;
+    }
+
+    template <class VTYPE, class RETTYPE>
+    reductionFuture<RETTYPE> multiReduce(const reductionVector &reductions,
+                                         const std::vector<occa::memory> &vecs) {
+      // Kernels are generated for each set of reductions
+      static std::map<std::string, kernelBuilderVector> buildersMap;
+      static occa::mutex buildersMutex;
+
+      const int vectorCount = (int) vecs.size();
+      const int reductionCount = (int) reductions.size();
+      OCCA_ERROR("At least one vector is required",
+                 vectorCount > 0);
+
+      device dev = vecs[0].getDevice();
+      const udim_t entries = vecs[0].size() / sizeof(VTYPE);
+      for (int i = 1; i < vectorCount; ++i) {
+        OCCA_ERROR("Vectors must be in the same device",
+                   vecs[i].getDevice() == dev);
+        OCCA_ERROR("Vectors must have the same size",
+                   (vecs[i].size() / sizeof(VTYPE)) == entries);
+      }
+      for (int r = 0; r < reductionCount; ++r) {
+        OCCA_ERROR("Reduction [" << r << "] needs at least one entry",
+                   entries || !reductions[r].needsEntries());
+      }
+
+      const int indexType = getIndexType(entries);
+      std::string key = indexTypes[indexType];
+      key += ',';
+      key += toString(vectorCount);
+      for (int r = 0; r < reductionCount; ++r) {
+        key += ',';
+        key += reductions[r].toString();
+      }
+
+      occa::memory partials, results;
+
+      // The builders and their kernels' arguments are shared between
+      //   threads, keep them locked until the launches are queued
+      buildersMutex.lock();
+      try {
+        kernelBuilderVector &builders = buildersMap[key];
+        if (!builders.size()) {
+          const std::string source = multiReduceSource(reductions, vectorCount);
+          const occa::properties props = (
+            "defines: {"
+            "  VTYPE: '" + primitiveinfo<VTYPE>::name + "',"
+            "  RETTYPE: '" + primitiveinfo<RETTYPE>::name + "',"
+            "  INDEX_TYPE: '" + indexTypes[indexType] + "',"
+            "}"
+          );
+          builders.push_back(kernelBuilder::fromString(source, "multiReduce", props));
+          builders.push_back(kernelBuilder::fromString(source, "multiReduceFinalize", props));
+        }
+
+        // Pooled since reductions are short-lived and frequent
+        const occa::properties bufferProps("pool: true");
+        partials = dev.malloc(reductionCount * multiReduceBlocks * sizeof(RETTYPE),
+                              NULL,
+                              bufferProps);
+        results = dev.malloc(reductionCount * sizeof(RETTYPE),
+                             NULL,
+                             bufferProps);
+
+        occa::kernel reduceKernel = builders[0].build(dev);
+        reduceKernel.clearArgs();
+        reduceKernel.pushArg(indexArg(entries));
+        for (int i = 0; i < vectorCount; ++i) {
+          reduceKernel.pushArg(vecs[i]);
+        }
+        reduceKernel.pushArg(partials);
+        reduceKernel.run();
+
+        builders[1].build(dev)(partials, results);
+      } catch (...) {
+        buildersMutex.unlock();
+        throw;
+      }
+      buildersMutex.unlock();
+
+      return reductionFuture<RETTYPE>(results, partials);
     }
     //==================================
   }
@@ -5,6 +5,7 @@
 #include <sstream>
 
 #include <occa/core/kernel.hpp>
+#include <occa/core/kernelFuture.hpp>
 #include <occa/core/memory.hpp>
 #include <occa/core/stream.hpp>
 #include <occa/defines.hpp>
@@ -18,6 +19,7 @@ namespace occa {
   class modeDevice_t; class device;
   class modeStreamTag_t; class streamTag;
   class deviceInfo;
+  class memoryPool_t;
 
   typedef std::map<std::string, kernel>   cachedKernelMap;
   typedef cachedKernelMap::iterator       cachedKernelMapIterator;
@@ -36,15 +38,26 @@ namespace occa {
     gc::ring_t<modeStream_t> streamRing;
     gc::ring_t<modeStreamTag_t> streamTagRing;
 
-    ptrRangeMap uvaMap;
+    uvaIndex_t uvaMap;
     memoryVector uvaStaleMemory;
 
     stream currentStream;
     std::vector<modeStream_t*> streams;
 
     udim_t bytesAllocated;
+    // Created on the first [pool: true] allocation
+    memoryPool_t *memoryPool;
 
+    // Guards kernelRing, cachedKernels and kernelBuilds
+    //   since kernels can be built in other threads
+    occa::mutex kernelMutex;
     cachedKernelMap cachedKernels;
+    kernelBuildJobMap kernelBuilds;
+    int pendingKernelBuilds;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    // Signaled when [pendingKernelBuilds] drops to 0
+    pthread_cond_t kernelBuildsCondition;
+#endif
 
     modeDevice_t(const occa::properties &properties_);
 
@@ -60,6 +73,8 @@ namespace occa {
     // Must be called before ~modeDevice_t()!
     void freeResources();
 
+    memoryPool_t& getMemoryPool();
+
     void dontUseRefs();
     void addDeviceRef(device *dev);
     void removeDeviceRef(device *dev);
@@ -111,11 +126,30 @@ namespace occa {
 
     std::string getKernelHash(modeKernel_t *kernel);
 
-    kernel& getCachedKernel(const hash_t &kernelHash,
+    kernel getCachedKernel(const hash_t &kernelHash,
+                           const std::string &kernelName);
+
+    void setCachedKernel(const hash_t &kernelHash,
+                         const std::string &kernelName,
+                         const kernel &kernel_);
+
+    void removeCachedKernel(const hash_t &kernelHash,
                             const std::string &kernelName);
 
     void removeCachedKernel(modeKernel_t *kernel);
 
+    kernel buildHashedKernel(const std::string &filename,
+                             const std::string &kernelName,
+                             const hash_t &kernelHash,
+                             const occa::properties &kernelProps);
+
+    void addPendingKernelBuild();
+    void removePendingKernelBuild();
+    void waitForKernelBuilds();
+
+    // Whether buildKernel() can be called from multiple threads
+    virtual bool hasThreadSafeKernelBuilds() const;
+
     virtual modeKernel_t* buildKernel(const std::string &filename,
                                       const std::string &kernelName,
                                       const hash_t hash,
@@ -192,6 +226,16 @@ namespace occa {
     udim_t memorySize() const;
     udim_t memoryAllocated() const;
 
+    // Bytes held by the memory pool, in use or cached
+    udim_t memoryPoolReserved() const;
+    // Bytes in freed blocks the pool kept for reuse
+    udim_t memoryPoolCached() const;
+    udim_t memoryPoolPeak() const;
+    udim_t memoryPoolHits() const;
+    udim_t memoryPoolMisses() const;
+    // Frees cached blocks until the pool holds at most [bytes]
+    void trimMemoryPool(const udim_t bytes = 0);
+
     void finish();
 
     bool hasSeparateMemorySpace();
@@ -228,6 +272,12 @@ namespace occa {
                                        const std::string &kernelName,
                                        const occa::properties &props = occa::properties()) const;
 
+    // Builds kernels in parallel, returning as soon as the builds are queued
+    // Properties:
+    //   threads : Maximum number of build threads (default and limit: core count)
+    kernelFutureVector buildKernelsAsync(const kernelBuildRequestVector &requests,
+                                         const occa::properties &props = occa::properties()) const;
+
     void loadKernels(const std::string &library = "");
     //  |===============================
 
@@ -17,6 +17,7 @@ namespace occa {
   class modeMemory_t; class memory;
   class modeDevice_t; class device;
   class kernelBuilder;
+  class kernelArgPack;
 
   namespace lang {
     class parser_t;
@@ -59,7 +60,7 @@ namespace occa {
     void removeKernelRef(kernel *ker);
     bool needsFree() const;
 
-    void assertArgumentLimit() const;
+    void assertArgumentLimit(const int argc) const;
     void assertArgInDevice(const kernelArgData &arg) const;
 
     void setArguments(kernelArg *args,
@@ -68,8 +69,17 @@ namespace occa {
 
     void setSourceMetadata(lang::parser_t &parser);
 
+    bool validatesArgumentTypes() const;
+    void assertArgumentCount(const int argc) const;
+    // Returns whether the argument is const
+    bool assertArgumentType(const int index,
+                            const kernelArgData &arg) const;
+
     void setupRun();
 
+    // Records a trace event for a launch that began at [start]
+    void recordLaunch(const double start) const;
+
     //---[ Virtual Methods ]------------
     virtual ~modeKernel_t() = 0;
 
@@ -77,6 +87,9 @@ namespace occa {
     virtual dim maxOuterDims() const = 0;
     virtual dim maxInnerDims() const = 0;
 
+    // Negative values mean there is no argument limit
+    virtual int maxArgs() const;
+
     virtual const lang::kernelMetadata_t& getMetadata() const = 0;
 
     virtual void run() const = 0;
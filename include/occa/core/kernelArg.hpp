@@ -10,6 +10,7 @@ namespace occa {
   class modeMemory_t; class memory;
   class modeDevice_t; class device;
   class kernelArgData;
+  class dirtyPageTracker_t;
 
   typedef std::vector<kernelArgData> kArgVector;
 
@@ -64,7 +65,10 @@ namespace occa {
 
     bool isNull() const;
 
-    void setupForKernelCall(const bool isConst) const;
+    // Trackers of UVA buffers synced to the device are added to
+    //   [syncedPages] to be restarted once every argument is set up
+    void setupForKernelCall(const bool isConst,
+                            std::vector<dirtyPageTracker_t*> &syncedPages) const;
   };
 
   class kernelArg {
@@ -0,0 +1,75 @@
+#ifndef OCCA_CORE_KERNELARGPACK_HEADER
+#define OCCA_CORE_KERNELARGPACK_HEADER
+
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/dtype.hpp>
+#include <occa/core/kernel.hpp>
+#include <occa/core/kernelArg.hpp>
+
+namespace occa {
+  //---[ kernelArgPack ]----------------
+  // Arguments bound to a kernel once and validated at bind time
+  //   so repeated launches skip building and checking arguments
+  // Bound memory objects must outlive the pack
+  class kernelArgPack {
+  private:
+    occa::kernel kernel_;
+    mutable kArgVector arguments;
+
+    // Per-argument const-ness from the kernel metadata
+    std::vector<bool> constArguments;
+    // Scalar argument types from the kernel metadata, NULL when unknown
+    std::vector<const dtype_t*> scalarTypes;
+    // Arguments that need UVA syncing before each launch
+    std::vector<int> uvaArguments;
+
+  public:
+    kernelArgPack();
+
+    kernelArgPack(const occa::kernel &kernel__,
+                  const kernelArg *args,
+                  const int count);
+
+    kernelArgPack(const kernelArgPack &other);
+    kernelArgPack& operator = (const kernelArgPack &other);
+
+  private:
+    void assertInitialized() const;
+    void bindArgument(const int index);
+    void setupUvaArguments();
+
+    void assertScalar(const int index,
+                      const dtype_t &type) const;
+
+  public:
+    bool isInitialized() const;
+
+    occa::kernel getKernel() const;
+
+    int size() const;
+
+    void set(const int index, const kernelArg &arg);
+
+    // Scalars are updated in-place without allocating
+    void set(const int index, const uint8_t value);
+    void set(const int index, const uint16_t value);
+    void set(const int index, const uint32_t value);
+    void set(const int index, const uint64_t value);
+
+    void set(const int index, const int8_t value);
+    void set(const int index, const int16_t value);
+    void set(const int index, const int32_t value);
+    void set(const int index, const int64_t value);
+
+    void set(const int index, const float value);
+    void set(const int index, const double value);
+
+    void run() const;
+    void operator () () const;
+  };
+  //====================================
+}
+
+#endif
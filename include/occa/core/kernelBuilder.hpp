@@ -49,6 +49,48 @@ namespace occa {
 
     void run(occa::scope &scope);
 
+    //---[ Tuning ]-------------------
+    // Builds each variant in [searchSpace], the cartesian product of
+    //   its array values, and times it with [args] on [device]:
+    //
+    //   builder.tune(device,
+    //                "defines: {"
+    //                "  TILESIZE: [64, 128, 256],"
+    //                "  UNROLL: [1, 4],"
+    //                "}",
+    //                args);
+    //
+    // The fastest variant is stored in the device's tuning database
+    //   and used by later build(device) calls, including in other
+    //   processes, with no lookup cost once built
+    //
+    // Note: Every variant runs with [args] (warmup + repeats) times,
+    //       kernels that update their arguments in place will modify
+    //       the caller's data that many times. Pass scratch copies
+    //       when the data needs to be kept
+    //
+    // Options in [tuneProps]
+    //   - warmup: Untimed runs per variant (default: 2)
+    //   - repeats: Timed runs per variant, keeping the fastest (default: 5)
+    occa::kernel tune(occa::device device,
+                      const occa::properties &searchSpace,
+                      const std::vector<occa::kernelArg> &args,
+                      const occa::properties &tuneProps = occa::properties());
+
+    // Default properties with the tuned values for [device], if any
+    occa::properties tunedProperties(occa::device device);
+
+    void clearTuning(occa::device device);
+
+  private:
+    std::string tuningKey() const;
+
+    occa::kernel buildKernel(occa::device device,
+                             const occa::properties &props);
+
+  public:
+    //================================
+
     void free();
   };
   //====================================
@@ -0,0 +1,123 @@
+#ifndef OCCA_CORE_KERNELFUTURE_HEADER
+#define OCCA_CORE_KERNELFUTURE_HEADER
+
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/core/kernel.hpp>
+#include <occa/tools/exception.hpp>
+#include <occa/tools/properties.hpp>
+#include <occa/tools/sys.hpp>
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <pthread.h>
+#endif
+
+namespace occa {
+  class modeDevice_t;
+  class kernelBuildRequest;
+  class kernelBuildJob_t;
+  class kernelFuture;
+
+  typedef std::vector<kernelBuildRequest>   kernelBuildRequestVector;
+  typedef std::vector<kernelFuture>         kernelFutureVector;
+  typedef std::vector<kernelBuildJob_t*>    kernelBuildJobVector;
+
+  typedef std::map<std::string, kernelBuildJob_t*> kernelBuildJobMap;
+  typedef kernelBuildJobMap::iterator              kernelBuildJobMapIterator;
+
+  //---[ kernelBuildRequest ]-----------
+  class kernelBuildRequest {
+  public:
+    std::string filename;
+    std::string kernelName;
+    occa::properties props;
+
+    kernelBuildRequest();
+
+    kernelBuildRequest(const std::string &filename_,
+                       const std::string &kernelName_,
+                       const occa::properties &props_ = occa::properties());
+  };
+  //====================================
+
+  //---[ kernelBuildJob_t ]-------------
+  // State shared between the futures waiting on a kernel
+  //   and the thread building it
+  class kernelBuildJob_t {
+  public:
+    modeDevice_t *modeDevice;
+    std::string filename;
+    std::string kernelName;
+    hash_t kernelHash;
+    occa::properties kernelProps;
+
+    // Builds run with the settings of the thread requesting them
+    occa::properties settings;
+
+    occa::mutex mutex;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_t doneCondition;
+#endif
+    int refs;
+    bool done;
+
+    kernel result;
+    exception *error;
+
+    kernelBuildJob_t(modeDevice_t *modeDevice_,
+                     const std::string &filename_,
+                     const std::string &kernelName_,
+                     const hash_t &kernelHash_,
+                     const occa::properties &kernelProps_);
+
+    ~kernelBuildJob_t();
+
+    std::string cacheKey() const;
+
+    void addRef();
+    void removeRef();
+
+    void run();
+    void wait();
+  };
+  //====================================
+
+  //---[ kernelFuture ]-----------------
+  class kernelFuture {
+  private:
+    kernelBuildJob_t *job;
+
+  public:
+    kernelFuture();
+    kernelFuture(kernelBuildJob_t *job_);
+
+    kernelFuture(const kernelFuture &other);
+    kernelFuture& operator = (const kernelFuture &other);
+    ~kernelFuture();
+
+  private:
+    void setJob(kernelBuildJob_t *job_);
+
+  public:
+    bool isInitialized() const;
+    bool isReady() const;
+
+    void wait() const;
+
+    // Waits for the build and rethrows any error it raised
+    occa::kernel get() const;
+  };
+  //====================================
+
+  //---[ Build Pool ]-------------------
+  namespace kernelBuildPool {
+    // Queues jobs on a process-wide pool of at most core-count workers,
+    //   running at most [threadCount] of them at a time
+    void run(const kernelBuildJobVector &jobs,
+             const int threadCount);
+  }
+  //====================================
+}
+
+#endif
@@ -13,6 +13,7 @@ namespace occa {
   class modeMemory_t; class memory;
   class modeDevice_t; class device;
   class kernelArg;
+  class dirtyPageTracker_t;
 
   typedef std::map<hash_t,occa::memory>   hashedMemoryMap;
   typedef hashedMemoryMap::iterator       hashedMemoryMapIterator;
@@ -35,6 +36,10 @@ namespace occa {
 
     char *ptr;
     char *uvaPtr;
+    // Tracks host writes to [uvaPtr] when enabled with [dirty_pages]
+    dirtyPageTracker_t *dirtyPages;
+    // Pool block backing pooled memory
+    modeMemory_t *poolBlock;
 
     occa::modeDevice_t *modeDevice;
 
@@ -0,0 +1,85 @@
+#ifndef OCCA_CORE_MEMORYPOOL_HEADER
+#define OCCA_CORE_MEMORYPOOL_HEADER
+
+#include <map>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/tools/hash.hpp>
+#include <occa/tools/properties.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  class modeDevice_t;
+  class modeMemory_t;
+
+  //---[ memoryPool_t ]-----------------
+  // A cached block and the hash of the properties it was allocated with
+  class pooledBlock_t {
+  public:
+    modeMemory_t *block;
+    hash_t propsHash;
+  };
+
+  // Keeps freed device allocations around for later allocations
+  //
+  // Memory properties
+  //   - pool           : Allocate through the device's pool
+  //   - pool_alignment : Power of two that pooled sizes are rounded to,
+  //                      passed as [alignment] to the mode's malloc
+  //                      (default: OCCA_MEM_BYTE_ALIGN)
+  //   - pool_limit     : Bytes the pool can hold before cached blocks
+  //                      are freed, 0 for no limit
+  //
+  // Sizes are rounded up to size classes with 4 bins per power of two
+  // Pooled memory is a slice of a cached block so every mode can use it
+  class memoryPool_t {
+  public:
+    typedef std::vector<pooledBlock_t>    blockVector;
+    typedef std::map<udim_t, blockVector> blockBinMap;
+    typedef std::map<modeMemory_t*, hash_t> blockHashMap;
+
+    modeDevice_t *modeDevice;
+
+    occa::mutex mutex;
+    blockBinMap freeBlocks;
+    // Blocks in use and their property hashes, which are slow to recompute
+    blockHashMap usedBlocks;
+    udim_t limit;
+
+    // Bytes in blocks, in use or cached
+    udim_t reservedBytes;
+    udim_t cachedBytes;
+    udim_t peakReservedBytes;
+    udim_t hits;
+    udim_t misses;
+
+    memoryPool_t(modeDevice_t *modeDevice_);
+    ~memoryPool_t();
+
+    static udim_t getSizeClass(const udim_t bytes,
+                               const udim_t alignment);
+
+    modeMemory_t* malloc(const udim_t bytes,
+                         const void *src,
+                         const occa::properties &props);
+
+    // Returns a block freed through its pooled memory
+    void free(modeMemory_t *block);
+
+    // Stops tracking a block whose pooled memory was detached
+    void detach(modeMemory_t *block);
+
+    // Frees cached blocks until the pool holds at most [bytes]
+    void trim(const udim_t bytes = 0);
+
+  private:
+    modeMemory_t* takeBlock(const udim_t blockBytes,
+                            const hash_t &propsHash);
+
+    void trimLocked(const udim_t bytes);
+  };
+  //====================================
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef OCCA_CORE_TUNING_HEADER
+#define OCCA_CORE_TUNING_HEADER
+
+#include <occa/core/device.hpp>
+#include <occa/tools/json.hpp>
+
+namespace occa {
+  //---[ Tuning Database ]--------------
+  // Results of kernelBuilder::tune() stored per device in
+  //   [OCCA_CACHE_DIR/tuning/<hash>.json]
+  //   - The hash includes the mode and processor name since host
+  //     devices share a hash across machines
+  //   - Lookups are done in memory after reading the file once
+  //   - Updates are merged with the file under a lock and renamed
+  //     over it, readers always see a complete database
+  namespace tuning {
+    hash_t deviceHash(occa::device device);
+
+    std::string filename(occa::device device);
+
+    // Returns an empty json if [key] hasn't been tuned
+    json get(occa::device device,
+             const std::string &key);
+
+    void set(occa::device device,
+             const std::string &key,
+             const json &entry);
+
+    void remove(occa::device device,
+                const std::string &key);
+
+    // Drop the in-memory databases, forcing the next lookup to reload them
+    void clear();
+  }
+  //====================================
+}
+
+#endif
@@ -17,8 +17,10 @@
 
 #if   (OCCA_OS == OCCA_LINUX_OS) || (OCCA_OS == OCCA_MACOS_OS)
 #  define OCCA_INLINE inline __attribute__ ((always_inline))
+#  define OCCA_DEPRECATED(message) __attribute__ ((deprecated(message)))
 #elif (OCCA_OS == OCCA_WINDOWS_OS)
 #  define OCCA_INLINE __forceinline
+#  define OCCA_DEPRECATED(message) __declspec(deprecated(message))
 #endif
 
 // Just in case someone wants to run with an older format than C99
@@ -2,6 +2,7 @@
 #define OCCA_IO_HEADER
 
 #include <occa/io/cache.hpp>
+#include <occa/io/cacheIndex.hpp>
 #include <occa/io/fileOpener.hpp>
 #include <occa/io/lock.hpp>
 #include <occa/io/utils.hpp>
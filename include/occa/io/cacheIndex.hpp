@@ -0,0 +1,60 @@
+#ifndef OCCA_IO_CACHEINDEX_HEADER
+#define OCCA_IO_CACHEINDEX_HEADER
+
+#include <iostream>
+#include <map>
+#include <set>
+
+#include <occa/tools/hash.hpp>
+
+namespace occa {
+  namespace io {
+    typedef std::map<std::string, hash_t> strHashMap;
+
+    //---[ Cache Index ]----------------
+    // Process-wide index of the kernel cache stored in [cachePath()/index]
+    //   - Lookups are done in memory after mapping the index file once,
+    //     only records appended since then are read on misses
+    //   - Updates append one record under the index lock, readers skip
+    //     records that are still being written
+    //   - Once superseded records outnumber live ones, the live records
+    //     are written to a copy of the index which is renamed over it
+    //   - The filesystem (.success/ markers, build.json) is still the
+    //     source of truth, the index only avoids probing it and complete
+    //     files are checked before being used
+    class cacheIndexEntry_t {
+    public:
+      std::set<std::string> completeFiles;
+      bool hasDependencies;
+      strHashMap dependencyHashes;
+
+      cacheIndexEntry_t();
+    };
+
+    typedef std::map<std::string, cacheIndexEntry_t> cacheIndexEntryMap;
+
+    namespace cacheIndex {
+      const std::string& filename();
+
+      bool isComplete(const std::string &hashDir,
+                      const std::string &filename);
+
+      void markComplete(const std::string &hashDir,
+                        const std::string &filename);
+
+      bool getDependencyHashes(const std::string &hashDir,
+                               strHashMap &dependencyHashes);
+
+      void setDependencyHashes(const std::string &hashDir,
+                               const strHashMap &dependencyHashes);
+
+      void remove(const std::string &hashDir);
+
+      // Drop the in-memory index, forcing the next lookup to reload it
+      void clear();
+    }
+    //==================================
+  }
+}
+
+#endif
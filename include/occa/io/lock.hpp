@@ -7,6 +7,13 @@ namespace occa {
   class hash_t;
 
   namespace io {
+    class fileLock_t;
+
+    // Locks use advisory file locks (flock) on [locks/<hash>_<tag>.lock]
+    //   - Waiters block in the kernel and wake up as soon as the lock is released
+    //   - Locks held by processes that die are released automatically
+    // Directory locks on [locks/<hash>_<tag>] are used as a fallback for
+    //   filesystems without advisory locks or if [locks/file_locks] is false
     class lock_t {
     private:
       mutable std::string lockDir;
@@ -14,6 +21,8 @@ namespace occa {
       float staleWarning;
       float staleAge;
       mutable bool released;
+      bool useFileLock;
+      mutable fileLock_t *fileLock;
 
     public:
       lock_t();
@@ -22,11 +31,22 @@ namespace occa {
              const std::string &tag,
              const float staleAge_ = -1);
 
+      lock_t(const lock_t &other);
+      lock_t& operator = (const lock_t &other);
+
       ~lock_t();
 
+    private:
+      void setFileLock(fileLock_t *fileLock_) const;
+      int acquireFileLock();
+
+    public:
       bool isInitialized() const;
 
       const std::string& dir() const;
+      std::string filename() const;
+
+      bool isFileLock() const;
 
       void release() const;
 
@@ -15,6 +15,13 @@ namespace occa {
         virtual bool forStatement(const int sType) const;
 
         virtual bool isValid(const attributeToken_t &attr) const;
+        bool validArgs(const attributeToken_t &attr) const;
+        bool validKwargs(const attributeToken_t &attr) const;
+
+        static bool isValidSchedule(const std::string &schedule);
+
+        // OpenMP doesn't take a chunk size for "auto" and "runtime"
+        static bool scheduleTakesChunk(const std::string &schedule);
       };
     }
   }
@@ -12,7 +12,9 @@ namespace occa {
 
         virtual void afterParsing();
 
-        void findOuterMostLoops(statementPtrVector &outerMostSmnts);
+        // Builds the [omp parallel for] pragma with the optional
+        //   collapse(n) and schedule(...) clauses
+        std::string getOuterPragma(forStatement &outerSmnt);
       };
     }
   }
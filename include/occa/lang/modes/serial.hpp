@@ -14,6 +14,7 @@ namespace occa {
       class serialParser : public parser_t {
       public:
         static const std::string exclusiveIndexName;
+        static const std::string trampolinePrefix;
 
         serialParser(const occa::properties &settings_ = occa::properties());
 
@@ -27,22 +28,73 @@ namespace occa {
 
         static void setupKernel(functionDeclStatement &kernelSmnt);
 
+        // Kernels are launched through an extern "C" trampoline
+        //   taking the argument pointers as a single void**
+        static std::string trampolineName(const std::string &kernelName);
+
+        void setupKernelTrampolines();
+        void setupKernelTrampoline(functionDeclStatement &kernelSmnt);
+
+        void findOuterMostLoops(statementPtrVector &outerMostSmnts);
+
+        static void getCollapsedOuterLoops(forStatement &outerSmnt,
+                                           statementPtrVector &loopSmnts);
+
+        static bool usesIterators(exprNode *expr,
+                                  const std::vector<variable_t*> &iterators);
+
         void setupExclusives();
 
+        void fuseExclusiveInnerLoops(statementExprMap &exprMap);
+        bool canFuseInnerLoops(forStatement &firstSmnt,
+                               forStatement &secondSmnt);
+        static bool onlyWritesPrivates(forStatement &loopSmnt,
+                                       statement_t *otherSmnt);
+        void fuseInnerLoops(forStatement &firstSmnt,
+                            forStatement &secondSmnt);
+        static bool sharesExclusives(statement_t &firstSmnt,
+                                     statement_t &secondSmnt);
+        static bool updatesVariable(exprNode &expr);
+        static bool passesPointer(exprNode &expr);
+
+        void promoteExclusives(statementExprMap &exprMap);
+        static forStatement* getPromotedExclusiveLoop(declarationStatement &declSmnt,
+                                                      statementExprMap &exprMap);
+
         void setupExclusiveDeclarations(statementExprMap &exprMap);
         void setupExclusiveDeclaration(declarationStatement &declSmnt);
         bool exclusiveIsDeclared(declarationStatement &declSmnt);
 
+        void setupExclusiveStorage(declarationStatement &declSmnt,
+                                   forStatement &outerSmnt);
+        void setupExclusiveVector(variableDeclaration &decl,
+                                  transforms::smntTreeNode &innerRoot,
+                                  exprNodeVector &counts);
+        void setupArrayHeader();
+        static exprNode* getInnerLoopCount(transforms::smntTreeNode &innerNode);
+
         void setupExclusiveIndices();
 
         static bool exclusiveVariableMatcher(exprNode &expr);
 
         static bool exclusiveInnerLoopMatcher(statement_t &smnt);
 
+        static bool innerLoopMatcher(statement_t &smnt);
+
         void getInnerMostLoops(transforms::smntTreeNode &innerRoot,
                                statementPtrVector &loopSmnts);
 
 
+        // Inner-most @inner loop iterations are independent, letting
+        //   them be annotated with [#pragma omp simd]
+        void setupSimdLoops();
+        bool canVectorizeInnerLoop(forStatement &innerSmnt,
+                                   std::string &reason);
+        std::string getSimdPragma(forStatement &innerSmnt);
+        void getAlignedArgs(forStatement &innerSmnt,
+                            strVector &argNames);
+        static bool restrictArgMatcher(exprNode &expr);
+
         static exprNode* updateExclusiveExprNodes(statement_t &smnt,
                                                   exprNode &expr,
                                                   const bool isBeingDeclared);
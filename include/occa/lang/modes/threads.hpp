@@ -0,0 +1,52 @@
+#ifndef OCCA_LANG_MODES_THREADS_HEADER
+#define OCCA_LANG_MODES_THREADS_HEADER
+
+#include <occa/lang/modes/serial.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace okl {
+      // Prints its children as a lambda closing the [call] arguments:
+      //   call[&](args) {
+      //     ...
+      //   });
+      class lambdaCallStatement : public blockStatement {
+      public:
+        std::string call;
+        std::string args;
+
+        lambdaCallStatement(blockStatement *up_,
+                            token_t *source_,
+                            const std::string &call_,
+                            const std::string &args_);
+        lambdaCallStatement(blockStatement *up_,
+                            const lambdaCallStatement &other);
+
+        virtual statement_t& clone_(blockStatement *up_) const;
+
+        virtual std::string statementName() const;
+
+        virtual void print(printer &pout) const;
+      };
+
+      class threadsParser : public serialParser {
+      public:
+        static const std::string outerChunkName;
+        static const std::string outerIndexName;
+
+        threadsParser(const occa::properties &settings_ = occa::properties());
+
+        virtual void afterParsing();
+
+        void setupThreadsHeader();
+
+        void setupOuterLoop(forStatement &outerSmnt);
+
+        void replaceOuterLoop(forStatement &forSmnt,
+                              exprNode &outerIndex);
+      };
+    }
+  }
+}
+
+#endif
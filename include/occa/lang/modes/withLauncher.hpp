@@ -1,6 +1,8 @@
 #ifndef OCCA_LANG_MODES_WITHLAUNCHER_HEADER
 #define OCCA_LANG_MODES_WITHLAUNCHER_HEADER
 
+#include <set>
+
 #include <occa/lang/parser.hpp>
 #include <occa/lang/modes/serial.hpp>
 #include <occa/lang/transforms/builtins/finders.hpp>
@@ -8,10 +10,24 @@
 namespace occa {
   namespace lang {
     namespace okl {
+      // @shared variables used by a set of statements
+      class sharedAccesses_t {
+      public:
+        std::set<std::string> accesses;
+        std::set<std::string> writes;
+
+        void add(const sharedAccesses_t &other);
+        void clear();
+
+        // Two sets conflict if one writes a variable the other uses
+        bool conflictsWith(const sharedAccesses_t &other) const;
+      };
+
       class withLauncher : public parser_t {
       public:
         serialParser launcherParser;
         type_t *memoryType;
+        type_t *kernelType;
 
         withLauncher(const occa::properties &settings_ = occa::properties());
 
@@ -69,8 +85,23 @@ namespace occa {
 
         void setupOccaFors(functionDeclStatement &kernelSmnt);
 
-        void addBarriersAfterInnerLoop(forStatement &forSmnt);
+        void getBarrierInnerLoops(functionDeclStatement &kernelSmnt,
+                                  statementPtrVector &barrierSmnts);
+
+        bool hasUntrackedSharedAccesses(functionDeclStatement &kernelSmnt);
+
+        void getSharedAccesses(statement_t &smnt,
+                               sharedAccesses_t &sharedAccesses);
+
+        void addBarrierAfterInnerLoop(forStatement &forSmnt);
+
+        static bool isInnerLoopOrBarrier(statement_t &smnt);
+        static bool isInInnerLoop(statement_t &smnt);
 
+        static bool isSharedVariable(exprNode &expr);
+        static bool isSharedPointer(exprNode &expr);
+        static bool isSharedPointerSubscript(exprNode &expr);
+        static bool takesSharedAddress(exprNode &expr);
         static bool writesToShared(exprNode &expr);
 
         void replaceOccaFor(forStatement &forSmnt);
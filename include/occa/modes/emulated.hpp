@@ -0,0 +1,6 @@
+#ifndef OCCA_MODES_EMULATED_HEADER
+#define OCCA_MODES_EMULATED_HEADER
+
+#include <occa/modes/emulated/utils.hpp>
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef OCCA_MODES_EMULATED_DEVICE_HEADER
+#define OCCA_MODES_EMULATED_DEVICE_HEADER
+
+#include <occa/modes/serial/device.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace emulated {
+    namespace transferType {
+      static const int hostToDevice   = 0;
+      static const int deviceToHost   = 1;
+      static const int deviceToDevice = 2;
+    }
+
+    class transferStats_t {
+    public:
+      udim_t hostToDeviceBytes;
+      udim_t deviceToHostBytes;
+      udim_t deviceToDeviceBytes;
+
+      udim_t hostToDeviceTransfers;
+      udim_t deviceToHostTransfers;
+      udim_t deviceToDeviceTransfers;
+
+      // Modeled time spent in transfers (seconds)
+      double transferTime;
+
+      transferStats_t();
+
+      udim_t bytes() const;
+      udim_t transfers() const;
+    };
+
+    // Runs [Serial] kernels on a device-side heap kept apart from
+    //   the host, so UVA syncs and staging go through real copies
+    //   - bandwidth : Modeled transfer bandwidth in GB/s, 0 for unlimited
+    //   - latency   : Modeled latency per transfer in microseconds
+    class device : public serial::device {
+    public:
+      double bandwidth;
+      double latency;
+
+      occa::mutex statsMutex;
+      transferStats_t stats;
+
+      device(const occa::properties &properties_);
+      virtual ~device();
+
+      virtual bool hasSeparateMemorySpace() const;
+
+      // Counts the transfer and waits for its modeled time
+      void addTransfer(const int type,
+                       const udim_t bytes);
+
+      transferStats_t getTransferStats();
+      void resetTransferStats();
+
+      //---[ Memory ]-------------------
+      virtual modeMemory_t* malloc(const udim_t bytes,
+                                   const void *src,
+                                   const occa::properties &props);
+      //================================
+    };
+  }
+}
+
+#endif
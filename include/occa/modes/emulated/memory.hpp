@@ -0,0 +1,39 @@
+#ifndef OCCA_MODES_EMULATED_MEMORY_HEADER
+#define OCCA_MODES_EMULATED_MEMORY_HEADER
+
+#include <occa/modes/serial/memory.hpp>
+
+namespace occa {
+  namespace emulated {
+    class device;
+
+    class memory : public serial::memory {
+    public:
+      memory(modeDevice_t *modeDevice_,
+             udim_t size_,
+             const occa::properties &properties_ = occa::properties());
+
+      device& getDevice() const;
+
+      modeMemory_t* addOffset(const dim_t offset);
+
+      void copyTo(void *dest,
+                  const udim_t bytes,
+                  const udim_t destOffset,
+                  const occa::properties &props) const;
+
+      void copyFrom(const void *src,
+                    const udim_t bytes,
+                    const udim_t offset,
+                    const occa::properties &props);
+
+      void copyFrom(const modeMemory_t *src,
+                    const udim_t bytes,
+                    const udim_t destOffset,
+                    const udim_t srcOffset,
+                    const occa::properties &props);
+    };
+  }
+}
+
+#endif
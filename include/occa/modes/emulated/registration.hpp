@@ -0,0 +1,23 @@
+#ifndef OCCA_MODES_EMULATED_REGISTRATION_HEADER
+#define OCCA_MODES_EMULATED_REGISTRATION_HEADER
+
+#include <occa/modes.hpp>
+#include <occa/modes/emulated/device.hpp>
+#include <occa/modes/emulated/memory.hpp>
+#include <occa/core/base.hpp>
+
+namespace occa {
+  namespace emulated {
+    class modeInfo : public modeInfo_v {
+    public:
+      modeInfo();
+
+      bool init();
+    };
+
+    extern occa::mode<emulated::modeInfo,
+                      emulated::device> mode;
+  }
+}
+
+#endif
@@ -0,0 +1,14 @@
+#ifndef OCCA_MODES_EMULATED_UTILS_HEADER
+#define OCCA_MODES_EMULATED_UTILS_HEADER
+
+#include <occa/core/device.hpp>
+#include <occa/modes/emulated/device.hpp>
+
+namespace occa {
+  namespace emulated {
+    transferStats_t getTransferStats(occa::device device);
+    void resetTransferStats(occa::device device);
+  }
+}
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef OCCA_MODES_OPENMP_HEADER
+#define OCCA_MODES_OPENMP_HEADER
+
+#include <occa/modes/openmp/numa.hpp>
+#include <occa/modes/openmp/utils.hpp>
+
+#endif
@@ -2,6 +2,7 @@
 #define OCCA_MODES_OPENMP_DEVICE_HEADER
 
 #include <occa/modes/serial/device.hpp>
+#include <occa/modes/openmp/numa.hpp>
 
 namespace occa {
   namespace openmp {
@@ -11,9 +12,13 @@ namespace occa {
       //   due to compiler changes
       std::string lastCompiler;
       std::string lastCompilerOpenMPFlag;
+      occa::mutex lastCompilerMutex;
 
     public:
+      numaTopology_t numaTopology;
+
       device(const occa::properties &properties_);
+      virtual ~device();
 
       virtual hash_t kernelHash(const occa::properties &props) const;
 
@@ -26,6 +31,13 @@ namespace occa {
                                         const std::string &kernelName,
                                         const hash_t kernelHash,
                                         const occa::properties &kernelProps);
+
+      //---[ Memory ]-------------------
+      // Places pages with the [numa] memory property
+      virtual modeMemory_t* malloc(const udim_t bytes,
+                                   const void *src,
+                                   const occa::properties &props);
+      //================================
     };
   }
 }
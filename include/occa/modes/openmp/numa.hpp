@@ -0,0 +1,84 @@
+#ifndef OCCA_MODES_OPENMP_NUMA_HEADER
+#define OCCA_MODES_OPENMP_NUMA_HEADER
+
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/tools/properties.hpp>
+#include <occa/types.hpp>
+
+namespace occa {
+  class device;
+
+  namespace openmp {
+    namespace numaPolicy {
+      static const int none       = 0;
+      // Pages are placed by the thread that first writes them
+      static const int firstTouch = 1;
+      // Pages are spread round-robin across all nodes
+      static const int interleave = 2;
+      // Pages are placed on [numa_node]
+      static const int bind       = 3;
+    }
+
+    //---[ Topology ]-------------------
+    class numaNode_t {
+    public:
+      int id;
+      std::vector<int> cpus;
+      udim_t memoryBytes;
+
+      numaNode_t();
+    };
+
+    class numaTopology_t {
+    public:
+      std::vector<numaNode_t> nodes;
+      // Whether the kernel accepts memory policies (mbind)
+      bool policiesSupported;
+
+      numaTopology_t();
+
+      int nodeCount() const;
+      bool hasNode(const int id) const;
+
+      // -1 if the CPU isn't listed
+      int getCpuNode(const int cpu) const;
+    };
+
+    // Read from /sys/devices/system/node on Linux, other systems
+    //   report a single node with every core
+    const numaTopology_t& getSystemNumaTopology();
+
+    numaTopology_t getNumaTopology(occa::device device);
+    //==================================
+
+    //---[ Placement ]------------------
+    // Memory properties
+    //   - numa      : "first_touch", "interleave" or "bind"
+    //   - numa_node : Node used by the "bind" policy (default: 0)
+    //
+    // Every policy initializes pages in parallel with a static OpenMP
+    //   schedule, matching how @outer loops are split across threads
+    int getNumaPolicy(const occa::properties &props);
+
+    // Applies [policy] to the pages in [ptr, ptr + bytes), which should
+    //   be page-aligned and not shared with other allocations
+    // Returns false if the system doesn't support memory policies
+    bool setNumaPolicy(void *ptr,
+                       const udim_t bytes,
+                       const int policy,
+                       const int node = 0);
+
+    // Copies [src], or zeros if NULL, using the kernel thread partition
+    void parallelFirstTouch(void *ptr,
+                            const void *src,
+                            const udim_t bytes);
+
+    // Node holding the page at [ptr], -1 if unknown
+    int getPtrNumaNode(const void *ptr);
+    //==================================
+  }
+}
+
+#endif
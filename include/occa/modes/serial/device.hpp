@@ -1,14 +1,44 @@
 #ifndef OCCA_MODES_SERIAL_DEVICE_HEADER
 #define OCCA_MODES_SERIAL_DEVICE_HEADER
 
+#include <atomic>
+
 #include <occa/defines.hpp>
 #include <occa/core/device.hpp>
 
 namespace occa {
   namespace serial {
+    class kernel;
+    class stream;
+
+    // All kernels in a source file are compiled into one binary,
+    //   kernels loaded from it share the handle
+    class sharedBinary_t {
+    public:
+      void *dlHandle;
+      int refs;
+
+      bool hasMetadata;
+      lang::sourceMetadata_t metadata;
+
+      sharedBinary_t();
+    };
+
+    typedef std::map<std::string, sharedBinary_t> sharedBinaryMap;
+    typedef sharedBinaryMap::iterator             sharedBinaryMapIterator;
+
     class device : public occa::modeDevice_t {
       mutable hash_t hash_;
 
+      occa::mutex sharedBinaryMutex;
+      sharedBinaryMap sharedBinaries;
+
+      // Streams with a worker thread, which synchronous work waits for
+      mutable occa::mutex asyncStreamMutex;
+      std::vector<stream*> asyncStreams;
+      std::atomic<int> asyncStreamCount;
+      bool hasInitialStream;
+
     public:
       device(const occa::properties &properties_);
       virtual ~device();
@@ -24,6 +54,12 @@ namespace occa {
       //---[ Stream ]-------------------
       virtual modeStream_t* createStream(const occa::properties &props);
 
+      void addAsyncStream(stream *s);
+      void removeAsyncStream(stream *s);
+
+      // Waits for every async stream, except the caller's own worker
+      void finishAsyncStreams() const;
+
       virtual streamTag tagStream();
       virtual void waitFor(streamTag tag);
       virtual double timeBetween(const streamTag &startTag,
@@ -31,6 +67,8 @@ namespace occa {
       //================================
 
       //---[ Kernel ]-------------------
+      virtual bool hasThreadSafeKernelBuilds() const;
+
       virtual bool parseFile(const std::string &filename,
                              const std::string &outputFile,
                              const occa::properties &kernelProps,
@@ -59,6 +97,20 @@ namespace occa {
                                                   const std::string &kernelName,
                                                   const occa::properties &kernelProps,
                                                   lang::kernelMetadata_t &metadata);
+
+      // Modes built on top of Serial can launch kernels differently
+      virtual kernel* newKernel(const std::string &kernelName,
+                                const std::string &filename,
+                                const occa::properties &kernelProps);
+
+      void* openSharedBinary(const std::string &filename);
+      void closeSharedBinary(const std::string &filename);
+      int sharedBinaryRefs(const std::string &filename);
+
+      bool getSharedBinaryMetadata(const std::string &filename,
+                                   lang::sourceMetadata_t &metadata);
+      void setSharedBinaryMetadata(const std::string &filename,
+                                   const lang::sourceMetadata_t &metadata);
       //================================
 
       //---[ Memory ]-------------------
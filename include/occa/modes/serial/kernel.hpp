@@ -11,10 +11,13 @@ namespace occa {
   namespace serial {
     class device;
 
+    typedef void (*trampolinePtr_t)(void **args);
+
     class kernel : public occa::modeKernel_t {
     protected:
       void *dlHandle;
       functionPtr_t function;
+      trampolinePtr_t trampoline;
       mutable std::vector<void*> vArgs;
 
     public:
@@ -29,10 +32,20 @@ namespace occa {
       int maxDims() const;
       dim maxOuterDims() const;
       dim maxInnerDims() const;
+      int maxArgs() const;
 
       const lang::kernelMetadata_t& getMetadata() const;
 
-      void run() const;
+    protected:
+      void** getArgumentPointers() const;
+
+    public:
+      // Queued on async streams
+      virtual void run() const;
+
+      // Runs the kernel on the calling thread
+      virtual void launch(const int argc,
+                          void **args) const;
 
       friend class device;
     };
@@ -1,18 +1,161 @@
 #ifndef OCCA_MODES_SERIAL_STREAM_HEADER
 #define OCCA_MODES_SERIAL_STREAM_HEADER
 
+#include <deque>
+#include <exception>
+#include <vector>
+
 #include <occa/defines.hpp>
+#include <occa/core/kernelArg.hpp>
 #include <occa/core/stream.hpp>
+#include <occa/tools/sys.hpp>
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <pthread.h>
+#endif
 
 namespace occa {
   namespace serial {
+    class kernel;
+    class stream;
+
+    //---[ Events ]---------------------
+    // Completed by a stream's worker once the work queued before it ran
+    //   and shared between the queued marker and stream tags
+    class streamEvent_t {
+    private:
+      occa::mutex mutex;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_t condition;
+#endif
+      int refs;
+      bool done;
+      double time;
+      // First error raised by the stream's work before the event
+      std::exception_ptr error;
+
+    public:
+      streamEvent_t();
+
+    private:
+      ~streamEvent_t();
+
+    public:
+      void addRef();
+      void removeRef();
+
+      void complete(const std::exception_ptr &error_);
+      bool isDone();
+
+      // Blocks until the event completes and returns its completion time
+      double wait();
+      std::exception_ptr getError();
+    };
+    //==================================
+
+    //---[ Tasks ]----------------------
+    class streamTask_t {
+    public:
+      virtual ~streamTask_t();
+      virtual void run() = 0;
+    };
+
+    // Keeps its own copy of the arguments since the kernel's are
+    //   replaced by the next launch
+    class kernelTask_t : public streamTask_t {
+    public:
+      const serial::kernel *kernel;
+      kArgVector arguments;
+      std::vector<void*> args;
+
+      kernelTask_t(const serial::kernel *kernel_,
+                   const kArgVector &arguments_);
+
+      virtual void run();
+    };
+
+    class memcpyTask_t : public streamTask_t {
+    public:
+      void *dest;
+      const void *src;
+      udim_t bytes;
+
+      memcpyTask_t(void *dest_,
+                   const void *src_,
+                   const udim_t bytes_);
+
+      virtual void run();
+    };
+
+    class eventTask_t : public streamTask_t {
+    public:
+      stream *owner;
+      streamEvent_t *event;
+
+      eventTask_t(stream *owner_,
+                  streamEvent_t *event_);
+      virtual ~eventTask_t();
+
+      virtual void run();
+    };
+    //==================================
+
+    //---[ Stream ]---------------------
+    // Stream properties
+    //   - async : Run kernels and [async: true] copies in order on a
+    //             worker thread. The device's initial stream defaults to
+    //             false so launches and copies stay synchronous unless
+    //             another stream is set
+    //
+    // Synchronous work waits for every async stream of the device, as
+    //   CUDA's legacy default stream does
+    //
+    // Exceptions thrown by queued work are caught by the worker and
+    //   rethrown on the caller's thread by finish() and waitFor()
     class stream : public occa::modeStream_t {
     public:
+      bool isAsync;
+
+      occa::mutex mutex;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_t taskCondition;
+      pthread_cond_t doneCondition;
+      pthread_t thread;
+#endif
+      bool hasThread;
+      bool stopping;
+      // Queued tasks, including the one running
+      std::deque<streamTask_t*> tasks;
+      // First exception thrown by a task since the last finish()
+      std::exception_ptr error;
+
       stream(modeDevice_t *modeDevice_,
-             const occa::properties &properties_);
+             const occa::properties &properties_,
+             const bool isAsync_);
 
       virtual ~stream();
+
+    private:
+      void startThread();
+      static void* workerMain(void *streamPtr);
+
+    public:
+      void enqueue(streamTask_t *task);
+
+      // Blocks until every queued task ran and rethrows the first
+      //   exception a task threw, if any
+      void finish();
+      bool isFinished();
+
+      std::exception_ptr getError();
+
+      // Whether the caller is this stream's worker
+      bool isWorkerThread() const;
     };
+
+    // The device's current stream if it runs work asynchronously
+    stream* getAsyncStream(modeDevice_t *modeDevice);
+    //==================================
   }
 }
 
@@ -7,14 +7,27 @@
 
 namespace occa {
   namespace serial {
+    class streamEvent_t;
+
     class streamTag : public occa::modeStreamTag_t {
     public:
       double time;
+      // Set for tags on async streams
+      streamEvent_t *event;
 
       streamTag(modeDevice_t *modeDevice_,
                 double time_);
 
+      // Takes ownership of a reference to [event_]
+      streamTag(modeDevice_t *modeDevice_,
+                streamEvent_t *event_);
+
       virtual ~streamTag();
+
+      // Blocks until the work queued before the tag ran and rethrows
+      //   the first exception that work threw
+      void wait();
+      double getTime();
     };
   }
 }
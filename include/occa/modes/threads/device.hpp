@@ -0,0 +1,30 @@
+#ifndef OCCA_MODES_THREADS_DEVICE_HEADER
+#define OCCA_MODES_THREADS_DEVICE_HEADER
+
+#include <occa/modes/serial/device.hpp>
+#include <occa/modes/threads/pool.hpp>
+
+namespace occa {
+  namespace threads {
+    class device : public serial::device {
+    public:
+      pool_t *pool;
+
+      device(const occa::properties &properties_);
+      virtual ~device();
+
+      virtual hash_t kernelHash(const occa::properties &props) const;
+
+      virtual bool parseFile(const std::string &filename,
+                             const std::string &outputFile,
+                             const occa::properties &kernelProps,
+                             lang::sourceMetadata_t &metadata);
+
+      virtual serial::kernel* newKernel(const std::string &kernelName,
+                                        const std::string &filename,
+                                        const occa::properties &kernelProps);
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef OCCA_MODES_THREADS_KERNEL_HEADER
+#define OCCA_MODES_THREADS_KERNEL_HEADER
+
+#include <occa/modes/serial/kernel.hpp>
+
+namespace occa {
+  namespace threads {
+    class kernel : public serial::kernel {
+    public:
+      kernel(modeDevice_t *modeDevice_,
+             const std::string &name_,
+             const std::string &sourceFilename_,
+             const occa::properties &properties_);
+
+      virtual void launch(const int argc,
+                          void **args) const;
+    };
+  }
+}
+
+#endif
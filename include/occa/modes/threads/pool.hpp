@@ -0,0 +1,160 @@
+#ifndef OCCA_MODES_THREADS_POOL_HEADER
+#define OCCA_MODES_THREADS_POOL_HEADER
+
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/tools/sys.hpp>
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <pthread.h>
+#endif
+
+namespace occa {
+  namespace threads {
+    class pool_t;
+    class poolMember_t;
+
+    typedef void (*taskFunction_t)(void **args);
+
+    //---[ Outer Loops ]----------------
+    // [Threads] kernels run once on the launching thread, which hands
+    //   each set of collapsed @outer loops to the pool
+    //
+    //   occa::threads::outerLoop(N0 * N1, [&](occa::threads::outerChunk_t &chunk) {
+    //     while (occa::threads::outerLoopNext(chunk)) {
+    //       for (int64_t i = chunk.start; i < chunk.end; ++i) {...}
+    //     }
+    //   });
+    //
+    // Every pool thread takes chunks from its own share of the iterations
+    //   before stealing from other threads, outerLoop() returns once all
+    //   iterations are done
+    class outerChunk_t {
+    public:
+      int64_t start, end;
+      int64_t chunkSize;
+      int64_t remaining;
+      poolMember_t *member;
+
+      outerChunk_t();
+    };
+
+    typedef void (*outerLoopFunction_t)(outerChunk_t &chunk,
+                                        void *loop);
+
+    void runOuterLoop(const int64_t iterations,
+                      outerLoopFunction_t func,
+                      void *loop);
+
+    template <class loopFunction_t>
+    void callOuterLoop(outerChunk_t &chunk,
+                       void *loop) {
+      (*((loopFunction_t*) loop))(chunk);
+    }
+
+    template <class loopFunction_t>
+    void outerLoop(const int64_t iterations,
+                   loopFunction_t loop) {
+      runOuterLoop(iterations,
+                   callOuterLoop<loopFunction_t>,
+                   &loop);
+    }
+
+    // Returns false once no work is left to take or steal
+    bool outerLoopNext(outerChunk_t &chunk);
+    //==================================
+
+    //---[ Pool ]-----------------------
+    class poolMember_t {
+    public:
+      pool_t *pool;
+      int id;
+
+      // Iterations of the current @outer loop left to this member
+      occa::mutex rangeMutex;
+      int64_t start, end;
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_t thread;
+#endif
+
+      poolMember_t(pool_t *pool_,
+                   const int id_);
+      ~poolMember_t();
+
+      void setRange(const int64_t start_,
+                    const int64_t end_);
+
+      bool takeChunk(const int64_t chunkSize,
+                     int64_t &chunkStart,
+                     int64_t &chunkEnd);
+
+      bool stealHalf(int64_t &stolenStart,
+                     int64_t &stolenEnd);
+    };
+
+    // Persistent threads running kernels in [Threads] mode
+    //   - threads   : Number of threads, including the launching thread
+    //   - chunkSize : Iterations taken at a time, 0 splits each
+    //                 thread's share into a few chunks
+    //   - pinned    : Pin worker threads to cores
+    class pool_t {
+    public:
+      int threadCount;
+      int chunkSize;
+      bool pinned;
+
+      std::vector<poolMember_t*> members;
+
+      // Launches from different host threads take turns
+      occa::mutex runMutex;
+
+      // Set while the pool runs an @outer loop, nested ones run inline
+      bool inOuterLoop;
+
+      occa::mutex mutex;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_t taskCondition;
+      pthread_cond_t doneCondition;
+#endif
+      int taskGeneration;
+      outerLoopFunction_t task;
+      void *taskLoop;
+      int64_t taskChunkSize;
+      int activeMembers;
+      bool stopping;
+
+      pool_t(const int threadCount_,
+             const int chunkSize_,
+             const bool pinned_);
+      ~pool_t();
+
+    private:
+      void startThreads();
+      void stopThreads();
+
+      static void* workerMain(void *memberPtr);
+
+      void runChunks(poolMember_t &member,
+                     outerLoopFunction_t task_,
+                     void *loop,
+                     const int64_t chunkSize_);
+
+    public:
+      int64_t getChunkSize(const int64_t iterations) const;
+
+      // Runs the kernel on the launching thread
+      void run(taskFunction_t task_,
+               void **args);
+
+      // Splits the iterations between all pool threads
+      void runOuterLoop(const int64_t iterations,
+                        outerLoopFunction_t task_,
+                        void *loop);
+    };
+    //==================================
+  }
+}
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef OCCA_MODES_THREADS_REGISTRATION_HEADER
+#define OCCA_MODES_THREADS_REGISTRATION_HEADER
+
+#include <occa/modes.hpp>
+#include <occa/modes/threads/device.hpp>
+#include <occa/modes/serial/memory.hpp>
+#include <occa/core/base.hpp>
+
+namespace occa {
+  namespace threads {
+    class modeInfo : public modeInfo_v {
+    public:
+      modeInfo();
+
+      bool init();
+    };
+
+    extern occa::mode<threads::modeInfo,
+                      threads::device> mode;
+  }
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define OCCA_TOOLS_HEADER
 
 #include <occa/tools/cli.hpp>
+#include <occa/tools/dirtyPages.hpp>
 #include <occa/tools/env.hpp>
 #include <occa/tools/exception.hpp>
 #include <occa/tools/gc.hpp>
@@ -14,6 +15,7 @@
 #include <occa/tools/styling.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/tools/tls.hpp>
+#include <occa/tools/trace.hpp>
 #include <occa/tools/uva.hpp>
 #include <occa/tools/vector.hpp>
 
@@ -0,0 +1,130 @@
+#ifndef OCCA_TOOLS_DIRTYPAGES_HEADER
+#define OCCA_TOOLS_DIRTYPAGES_HEADER
+
+#include <atomic>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/tools/properties.hpp>
+#include <occa/types.hpp>
+
+namespace occa {
+  class modeMemory_t;
+
+  class dirtyPageTracker_t;
+  typedef std::vector<dirtyPageTracker_t*> dirtyPageTrackerVector;
+
+  namespace dirtyPageMethod {
+    static const int none        = 0;
+    // Write-protect pages and record the first write fault of each page
+    //   - System calls writing into protected pages, such as read(),
+    //     recv() or MPI receives, fail with EFAULT instead of faulting
+    static const int writeFaults = 1;
+    // Read the kernel's soft-dirty bits from /proc/self/pagemap (Linux)
+    //   - Clearing the bits is process-wide, so restarting one buffer
+    //     sends the other tracked buffers back to a full sync
+    static const int softDirty   = 2;
+  }
+
+  //---[ Stats ]------------------------
+  class dirtyPageStats_t {
+  public:
+    // Write-protection faults taken on tracked pages
+    udim_t faults;
+    // Host-to-device syncs that only copied dirty pages
+    udim_t partialSyncs;
+    // Host-to-device syncs that copied the whole buffer
+    udim_t fullSyncs;
+    udim_t pagesSynced;
+    udim_t bytesSynced;
+    // Clean bytes partial syncs didn't copy
+    udim_t bytesSkipped;
+
+    dirtyPageStats_t();
+  };
+
+  dirtyPageStats_t getDirtyPageStats();
+  void resetDirtyPageStats();
+  //====================================
+
+  //---[ Tracker ]----------------------
+  // Tracks which pages of a UVA host buffer were written since
+  //   the last call to startTracking()
+  //
+  // The buffer must be page-aligned and own all of its pages since
+  //   protection changes are applied to whole pages
+  class dirtyPageTracker_t {
+  public:
+    char *start;
+    udim_t bytes;
+    udim_t pageSize;
+    udim_t pageCount;
+    int method;
+
+    std::atomic<bool> tracking;
+    std::vector<char> dirty;
+
+    dirtyPageTracker_t(void *ptr,
+                       const udim_t bytes_,
+                       const int method_ = dirtyPageMethod::writeFaults);
+    ~dirtyPageTracker_t();
+
+    static bool isSupported(const int method_);
+    static udim_t getPageSize();
+
+    // Bytes to allocate for [bytes_] to cover whole pages
+    static udim_t getTrackedBytes(const udim_t bytes_);
+
+    // Page-aligned allocation covering whole pages, freed with sys::free
+    static void* malloc(const udim_t bytes_);
+
+    void startTracking();
+    void stopTracking();
+
+    // Restarts the trackers together, clearing soft-dirty bits once
+    static void startTracking(const dirtyPageTrackerVector &trackers);
+
+    inline bool isTracking() const {
+      return tracking;
+    }
+
+    bool isDirty(const udim_t page);
+    udim_t dirtyPageCount();
+
+    // Merges consecutive dirty pages into [offset, bytes) pairs,
+    //   clipped to the tracked bytes
+    void getDirtyRanges(std::vector<udim_t> &offsets,
+                        std::vector<udim_t> &rangeBytes);
+
+    bool handleFault(void *addr);
+
+  private:
+    // Slot in the table read by the fault handler, -1 if untracked
+    int slot;
+
+    void protect();
+    void unprotect();
+    void readSoftDirtyBits();
+  };
+  //====================================
+
+  //---[ UVA Syncs ]--------------------
+  // Memory properties
+  //   - dirty_pages       : Track host writes to the UVA buffer
+  //   - dirty_page_method : "soft_dirty" (default) or "write_faults"
+  //                         - Soft-dirty tracking falls back to write
+  //                           faults when the kernel doesn't support it
+  //                         - Avoid write faults for buffers filled by
+  //                           system calls, see dirtyPageMethod
+  int getDirtyPageMethod(const occa::properties &props);
+
+  // Copies the UVA host buffer to the device, only copying the
+  //   dirty pages when the memory is tracked
+  //   - The tracker is added to [syncedPages] and should be restarted
+  //     with the other synced buffers once they're all copied
+  void copyDirtyPagesToDevice(modeMemory_t *mem,
+                              dirtyPageTrackerVector &syncedPages);
+  //====================================
+}
+
+#endif
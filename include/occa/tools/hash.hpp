@@ -2,13 +2,14 @@
 #define OCCA_TOOLS_HASH_HEADER
 
 #include <iostream>
+#include <stdint.h>
 
 #include <occa/defines.hpp>
 #include <occa/io/output.hpp>
 #include <occa/types.hpp>
 
 namespace occa {
-  // Uses FNV hashing
+  // 256-bit hash stored as 8 ints
   class hash_t {
   public:
     bool initialized;
@@ -47,6 +48,36 @@ namespace occa {
   std::ostream& operator << (std::ostream &out,
                            const hash_t &hash);
 
+  //---[ hasher_t ]---------------------
+  // Streaming hash engine used by occa::hash
+  //   - Input is consumed in 32-byte stripes split across 8 independent
+  //     32-bit lanes, which maps to a single AVX2 (or two SSE) registers
+  //   - Lanes are mixed together and avalanched in digest()
+  //   - update() can be called repeatedly, the digest only depends on
+  //     the concatenated input
+  class hasher_t {
+  public:
+    static const int lanes = 8;
+    static const int stripeBytes = 32;
+
+  private:
+    uint32_t acc[lanes];
+    unsigned char buffer[stripeBytes];
+    int bufferBytes;
+    udim_t totalBytes;
+
+  public:
+    hasher_t();
+
+    void reset();
+
+    hasher_t& update(const void *ptr, udim_t bytes);
+    hasher_t& update(const std::string &str);
+
+    hash_t digest() const;
+  };
+  //====================================
+
   hash_t hash(const void *ptr, udim_t bytes);
 
   template <class TM>
@@ -91,11 +91,22 @@ namespace occa {
     void addSharedBinaryFlags(const std::string &compiler, std::string &compilerFlags);
     void addSharedBinaryFlags(const int vendor_, std::string &compilerFlags);
 
+    std::string compilerSimdFlags(const std::string &compiler);
+    std::string compilerSimdFlags(const int vendor_);
+
+    void addSimdFlags(const std::string &compiler, std::string &compilerFlags);
+    void addSimdFlags(const int vendor_, std::string &compilerFlags);
+
+    std::string compilerVectorizationReportFlags(const std::string &compiler);
+    std::string compilerVectorizationReportFlags(const int vendor_);
+
     void addCompilerFlags(std::string &compilerFlags, const std::string &flags);
     //==================================
 
     //---[ Dynamic Methods ]------------
     void* malloc(udim_t bytes);
+    // Aligned to at least OCCA_MEM_BYTE_ALIGN, [alignment] must be a power of two
+    void* malloc(udim_t bytes, udim_t alignment);
     void free(void *ptr);
 
     void* dlopen(const std::string &filename,
@@ -105,6 +116,10 @@ namespace occa {
                         const std::string &functionName,
                         const io::lock_t &lock = io::lock_t());
 
+    // Returns NULL if the symbol does not exist
+    functionPtr_t dlsymIfExists(void *dlHandle,
+                                const std::string &functionName);
+
     void dlclose(void *dlHandle);
 
     void runFunction(functionPtr_t f, const int argc, void **args);
@@ -18,6 +18,8 @@ namespace occa {
   private:
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
     pthread_key_t pkey;
+
+    static void freeValue(void *ptr);
 #else
     thread_local TM value_;
 #endif
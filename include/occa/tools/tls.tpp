@@ -2,7 +2,7 @@ namespace occa {
   template <class TM>
   tls<TM>::tls(const TM &val) {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    pthread_key_create(&pkey, NULL);
+    pthread_key_create(&pkey, freeValue);
     pthread_setspecific(pkey, new TM(val));
 #else
     value_ = val;
@@ -13,13 +13,20 @@ namespace occa {
   template <class TM2>
   tls<TM>::tls(const tls<TM2> &t) {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    pthread_key_create(&pkey, NULL);
+    pthread_key_create(&pkey, freeValue);
     pthread_setspecific(pkey, new TM(t.value()));
 #else
     value_ = t.value_;
 #endif
   }
 
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+  template <class TM>
+  void tls<TM>::freeValue(void *ptr) {
+    delete (TM*) ptr;
+  }
+#endif
+
   template <class TM>
   tls<TM>::~tls() {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
@@ -56,7 +63,13 @@ namespace occa {
   template <class TM>
   TM& tls<TM>::value() {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    return *((TM*) pthread_getspecific(pkey));
+    TM *ptr = (TM*) pthread_getspecific(pkey);
+    // Threads other than the creator start without a value
+    if (!ptr) {
+      ptr = new TM();
+      pthread_setspecific(pkey, ptr);
+    }
+    return *ptr;
 #else
     return value_;
 #endif
@@ -65,7 +78,7 @@ namespace occa {
   template <class TM>
   const TM& tls<TM>::value() const {
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-    return *((TM*) pthread_getspecific(pkey));
+    return const_cast<tls<TM>*>(this)->value();
 #else
     return value_;
 #endif
@@ -0,0 +1,79 @@
+#ifndef OCCA_TOOLS_TRACE_HEADER
+#define OCCA_TOOLS_TRACE_HEADER
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <occa/defines.hpp>
+#include <occa/tools/json.hpp>
+#include <occa/types.hpp>
+
+namespace occa {
+  namespace trace {
+    // Opt-in record of kernel builds, launches, allocations and copies
+    //
+    // Enabled by
+    //   - OCCA_TRACE=1 (written to OCCA_TRACE_FILE at exit,
+    //     default: occa_trace.json)
+    //   - The [trace: true] device property (written to [trace_file]
+    //     at exit when set)
+    //
+    // Call sites check isEnabled() before doing any work so disabled
+    //   tracing only costs a flag check
+    namespace category {
+      extern const std::string build;
+      extern const std::string launch;
+      extern const std::string malloc;
+      extern const std::string free;
+      extern const std::string copy;
+    }
+
+    class event_t {
+    public:
+      std::string name;
+      std::string category;
+      // Seconds since tracing was first enabled
+      double start;
+      double duration;
+      int threadId;
+      udim_t bytes;
+      occa::json args;
+
+      event_t();
+    };
+
+    // Toggled from any thread, events recorded around a toggle can be
+    //   kept or dropped
+    extern std::atomic<bool> enabled;
+
+    inline bool isEnabled() {
+      return enabled.load(std::memory_order_relaxed);
+    }
+
+    void enable();
+    void disable();
+
+    // Writes the trace to [filename] when the program exits
+    void setExitFile(const std::string &filename);
+
+    // Timestamp to pass to record()
+    double now();
+
+    void record(const std::string &category_,
+                const std::string &name,
+                const double start,
+                const udim_t bytes = 0,
+                const occa::json &args = occa::json());
+
+    std::vector<event_t> getEvents();
+    std::vector<event_t> getEvents(const std::string &category_);
+    void clear();
+
+    // Chrome trace-event format, readable by chrome://tracing and Perfetto
+    occa::json toChromeTrace();
+    void writeChromeTrace(const std::string &filename);
+  }
+}
+
+#endif
@@ -1,23 +1,29 @@
 #ifndef OCCA_UVA_HEADER
 #define OCCA_UVA_HEADER
 
+#include <atomic>
 #include <iostream>
 #include <vector>
 
 #include <occa/defines.hpp>
 #include <occa/io/output.hpp>
+#include <occa/tools/sys.hpp>
 #include <occa/types.hpp>
 
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <pthread.h>
+#endif
+
 namespace occa {
   class device;
   class memory;
   class modeMemory_t;
   class ptrRange;
+  class uvaIndex_t;
 
-  typedef std::map<ptrRange, occa::modeMemory_t*> ptrRangeMap;
-  typedef std::vector<occa::modeMemory_t*>        memoryVector;
+  typedef std::vector<occa::modeMemory_t*> memoryVector;
 
-  extern ptrRangeMap uvaMap;
+  extern uvaIndex_t uvaMap;
   extern memoryVector uvaStaleMemory;
 
   //---[ ptrRange ]---------------------
@@ -42,6 +48,61 @@ namespace occa {
   //====================================
 
 
+  //---[ uvaIndex_t ]------------------
+  class uvaIndexEntry_t {
+  public:
+    char *start, *end;
+    occa::modeMemory_t *modeMemory;
+  };
+
+  // Maps pointers to the allocation containing them
+  //   - Entries are kept in an array sorted by address and found
+  //     with a binary search under a shared lock
+  //   - Each thread caches its last hit, which is reused without
+  //     locking until the index changes
+  //   - Inserts and erases lock the index exclusively
+  class uvaIndex_t {
+  private:
+    std::vector<uvaIndexEntry_t> entries;
+    std::atomic<udim_t> version;
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    mutable pthread_rwlock_t rwlock;
+#else
+    mutable occa::mutex rwlock;
+#endif
+
+    uvaIndex_t(const uvaIndex_t &other);
+    uvaIndex_t& operator = (const uvaIndex_t &other);
+
+  public:
+    uvaIndex_t();
+    ~uvaIndex_t();
+
+    // Ranges with 0 bytes only match [ptr]
+    // Overlapping entries are replaced
+    void insert(void *ptr,
+                const udim_t bytes,
+                occa::modeMemory_t *modeMemory);
+
+    // Removes the entry containing [ptr]
+    bool erase(void *ptr);
+
+    occa::modeMemory_t* find(const void *ptr) const;
+
+    size_t size() const;
+
+  private:
+    void lockShared() const;
+    void lockExclusive() const;
+    void unlock() const;
+
+    // Index of the first entry ending after [ptr]
+    size_t lowerBound(const char *ptr) const;
+  };
+  //====================================
+
+
   //---[ UVA ]--------------------------
   occa::modeMemory_t* uvaToMemory(void *ptr);
 
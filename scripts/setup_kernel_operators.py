@@ -93,7 +93,8 @@ def run_function_from_argument(N):
 @to_file('include/occa/core/kernelOperators.hpp')
 def operator_declarations(N):
     return '\n\n'.join(
-        operator_declaration(n) for n in range(N + 1)
+        [operator_declaration(n) for n in range(N + 1)]
+        + [bind_declaration(n) for n in range(N + 1)]
     )
 
 
@@ -106,10 +107,20 @@ def operator_declaration(N):
     return content
 
 
+def bind_declaration(N):
+    content = 'kernelArgPack bind('
+    indent = ' ' * len(content)
+    content += operator_args(N, indent, 'const kernelArg &')
+    content += ') const;'
+
+    return content
+
+
 @to_file('src/core/kernelOperators.cpp')
 def operator_definitions(N):
     return '\n'.join(
-        operator_definition(n) for n in range(N + 1)
+        [operator_definition(n) for n in range(N + 1)]
+        + [bind_definition(n) for n in range(N + 1)]
     )
 
 
@@ -137,6 +148,27 @@ def operator_definition(N):
     return content
 
 
+def bind_definition(N):
+    content = 'kernelArgPack kernel::bind('
+    indent = ' ' * len(content)
+    content += operator_args(N, indent, 'const kernelArg &')
+    if N > 0:
+        content += ''') const {{
+  kernelArg args[] = {{
+    {array_args}
+  }};
+  return kernelArgPack(*this, args, {N});
+}}
+'''.format(N=N,
+           array_args=array_args(N, ' ' * 4))
+    else:
+        content += ''') const {
+  return kernelArgPack(*this, NULL, 0);
+}
+'''
+    return content
+
+
 @to_file('include/occa/core/inlinedKernelScope.hpp')
 def inlined_kernel_scope_definitions(N):
     return '\n\n'.join(
@@ -0,0 +1,101 @@
+#include <map>
+
+#include <occa/array/expression.hpp>
+#include <occa/array/linalg.hpp>
+
+namespace occa {
+  arrayExprBuilder::arrayExprBuilder(occa::memory output,
+                                     const udim_t entries_,
+                                     const std::string &outputType) :
+    entries(entries_) {
+    OCCA_ERROR("Cannot assign to an uninitialized array",
+               output.isInitialized());
+    vectors.push_back(output);
+    vectorTypes.push_back(outputType);
+  }
+
+  std::string arrayExprBuilder::addVector(occa::memory vec,
+                                          const udim_t vecEntries,
+                                          const std::string &type) {
+    OCCA_ERROR("Cannot use an uninitialized array in an expression",
+               vec.isInitialized());
+    OCCA_ERROR("Arrays must be in the same device",
+               vec.getDevice() == vectors[0].getDevice());
+    OCCA_ERROR("Arrays must have the same size, expected ["
+               << entries << "] entries but found [" << vecEntries << "]",
+               vecEntries == entries);
+
+    const int vectorCount = (int) vectors.size();
+    int index;
+    for (index = 0; index < vectorCount; ++index) {
+      if ((vectors[index] == vec)
+          && (vectorTypes[index] == type)) {
+        break;
+      }
+    }
+    if (index == vectorCount) {
+      vectors.push_back(vec);
+      vectorTypes.push_back(type);
+    }
+    return "v" + toString(index) + "[i]";
+  }
+
+  std::string arrayExprBuilder::addConstant(const occa::kernelArg &value,
+                                            const std::string &type) {
+    const int index = (int) constants.size();
+    constants.push_back(value);
+    constantTypes.push_back(type);
+    return "c" + toString(index);
+  }
+
+  void arrayExprBuilder::run(const std::string &op,
+                             const std::string &source,
+                             const int tileSize) {
+    // Kernels are generated for each expression shape and types
+    static std::map<std::string, kernelBuilderVector> buildersMap;
+
+    const int vectorCount = (int) vectors.size();
+    const int constantCount = (int) constants.size();
+
+    const std::string formula = "v0[i] " + op + " " + source + ";";
+
+    std::string defines;
+    for (int i = 0; i < vectorCount; ++i) {
+      defines += "  VTYPE" + toString(i) + ": '" + vectorTypes[i] + "',";
+    }
+    for (int i = 0; i < constantCount; ++i) {
+      defines += "  CTYPE" + toString(i) + ": '" + constantTypes[i] + "',";
+    }
+
+    kernelBuilderVector &builders = buildersMap[formula + defines];
+    if (!builders.size()) {
+      for (int t = 0; t < linalg::indexTypeCount; ++t) {
+        for (int i = 0; i < linalg::usedTileSizeCount; ++i) {
+          builders.push_back(
+            linalg::customLinearMethod("fusedExpression",
+                                       formula,
+                                       "defines: {"
+                                       + defines
+                                       + "  TILESIZE: '" + toString(linalg::usedTileSizes[i]) + "',"
+                                       "  INDEX_TYPE: '" + linalg::indexTypes[t] + "',"
+                                       "}")
+          );
+        }
+      }
+    }
+
+    occa::kernel kernel = linalg::getTiledKernel(builders,
+                                                 vectors[0].getDevice(),
+                                                 tileSize,
+                                                 entries);
+    kernel.clearArgs();
+    kernel.pushArg(linalg::indexArg(entries));
+    for (int i = 0; i < constantCount; ++i) {
+      kernel.pushArg(constants[i]);
+    }
+    for (int i = 0; i < vectorCount; ++i) {
+      kernel.pushArg(vectors[i]);
+    }
+    kernel.run();
+  }
+}
@@ -85,9 +85,13 @@ namespace occa {
       }
 
       std::stringstream ss;
+      ss << "#ifndef INDEX_TYPE\n"
+            "#  define INDEX_TYPE int\n"
+            "#endif\n"
+            "\n";
 
       // Setup arguments
-      ss << "@kernel void " << kernelName << "(const int entries,\n";
+      ss << "@kernel void " << kernelName << "(const INDEX_TYPE entries,\n";
       for (int i = 0; i < constantCount; ++i) {
         ss << "                  const CTYPE" << i << " c" << i;
         if ((i < (constantCount - 1)) || inputCount) {
@@ -104,12 +108,273 @@ namespace occa {
       }
       // Setup body
       ss << ") {\n"
-        "  for (int i = 0; i < entries; ++i; @tile(TILESIZE, @outer, @inner)) {\n"
+        "  for (INDEX_TYPE i = 0; i < entries; ++i; @tile(TILESIZE, @outer, @inner)) {\n"
         "    " << formula << "\n"
         "  }\n"
         "}\n";
 
       return kernelBuilder::fromString(ss.str(), kernelName, props);
     }
+
+    bool usesGpuReductions(const std::string &mode) {
+      return ((mode == "CUDA")
+              || (mode == "OpenCL")
+              || (mode == "Metal"));
+    }
+
+    int getReductionPartials(occa::kernel kernel) {
+      const occa::properties &props = kernel.properties();
+      if (usesGpuReductions(kernel.mode())) {
+        return props.get("defines/GPU_DOT_OUTER", 1);
+      }
+      return props.get("defines/CPU_DOT_OUTER", 1);
+    }
+
+    //---[ Tuning ]---------------------
+    json reductionSearchSpace(const std::string &mode) {
+      json outers(json::array_), inners(json::array_);
+      for (int i = 0; i < tunedDotOuterCount; ++i) {
+        outers += tunedDotOuters[i];
+      }
+      for (int i = 0; i < tunedDotInnerCount; ++i) {
+        inners += tunedDotInners[i];
+      }
+
+      json space;
+      if (usesGpuReductions(mode)) {
+        space["defines/GPU_DOT_OUTER"] = outers;
+        space["defines/GPU_DOT_INNER"] = inners;
+      } else {
+        space["defines/CPU_DOT_OUTER"] = outers;
+      }
+      return space;
+    }
+
+    json tileSearchSpace() {
+      json tileSizes(json::array_);
+      for (int i = 0; i < usedTileSizeCount; ++i) {
+        tileSizes += usedTileSizes[i];
+      }
+      json space;
+      space["defines/TILESIZE"] = tileSizes;
+      return space;
+    }
+    //==================================
+
+    //---[ Fused Reductions ]-----------
+    reduction_t::reduction_t(const reductionType::type_t type_,
+                             const int vec1_,
+                             const int vec2_) :
+      type(type_),
+      vec1(vec1_),
+      vec2(vec2_) {}
+
+    bool reduction_t::usesTwoVectors() const {
+      return ((type == reductionType::dot)
+              || (type == reductionType::distance));
+    }
+
+    bool reduction_t::needsEntries() const {
+      return ((type == reductionType::lInfNorm)
+              || (type == reductionType::max)
+              || (type == reductionType::min));
+    }
+
+    std::string reduction_t::toString() const {
+      std::stringstream ss;
+      ss << type << ':' << vec1 << ':' << vec2;
+      return ss.str();
+    }
+
+    static std::string reductionInit(const reduction_t &reduction) {
+      const std::string vec = "v" + occa::toString(reduction.vec1);
+      switch (reduction.type) {
+        case reductionType::lInfNorm:
+          return "ABS_FUNC((VTYPE) " + vec + "[0])";
+        case reductionType::max:
+        case reductionType::min:
+          return vec + "[0]";
+        default:
+          return "0";
+      }
+    }
+
+    static std::string reductionOperation(const reduction_t &reduction,
+                                          const std::string &red,
+                                          const std::string &idx) {
+      const std::string vec1 = "v" + occa::toString(reduction.vec1) + "[" + idx + "]";
+      const std::string vec2 = "v" + occa::toString(reduction.vec2) + "[" + idx + "]";
+      switch (reduction.type) {
+        case reductionType::sum:
+          return red + " += " + vec1 + ";";
+        case reductionType::l1Norm:
+          return red + " += ABS_FUNC((VTYPE) " + vec1 + ");";
+        case reductionType::l2Norm:
+          return "{ const RETTYPE r_v = " + vec1 + "; " + red + " += r_v * r_v; }";
+        case reductionType::lInfNorm:
+          return ("{ const RETTYPE r_v = ABS_FUNC((VTYPE) " + vec1 + "); "
+                  + red + " = (" + red + " < r_v) ? r_v : " + red + "; }");
+        case reductionType::max:
+          return ("{ const RETTYPE r_v = " + vec1 + "; "
+                  + red + " = (" + red + " < r_v) ? r_v : " + red + "; }");
+        case reductionType::min:
+          return ("{ const RETTYPE r_v = " + vec1 + "; "
+                  + red + " = (" + red + " > r_v) ? r_v : " + red + "; }");
+        case reductionType::dot:
+          return red + " += " + vec1 + " * " + vec2 + ";";
+        case reductionType::distance:
+          return ("{ const RETTYPE r_v = " + vec1 + " - " + vec2 + "; "
+                  + red + " += r_v * r_v; }");
+      }
+      return "";
+    }
+
+    // Combines two partial reductions into [red]
+    static std::string reductionCombine(const reduction_t &reduction,
+                                        const std::string &red,
+                                        const std::string &part) {
+      switch (reduction.type) {
+        case reductionType::lInfNorm:
+        case reductionType::max:
+          return ("{ const RETTYPE r_v = " + part + "; "
+                  + red + " = (" + red + " < r_v) ? r_v : " + red + "; }");
+        case reductionType::min:
+          return ("{ const RETTYPE r_v = " + part + "; "
+                  + red + " = (" + red + " > r_v) ? r_v : " + red + "; }");
+        default:
+          return red + " += " + part + ";";
+      }
+    }
+
+    static std::string reductionFinalize(const reduction_t &reduction,
+                                         const std::string &red) {
+      switch (reduction.type) {
+        case reductionType::l2Norm:
+        case reductionType::distance:
+          return "sqrt(" + red + ")";
+        default:
+          return red;
+      }
+    }
+
+    std::string multiReduceSource(const reductionVector &reductions,
+                                  const int vectorCount) {
+      const int reductionCount = (int) reductions.size();
+
+      OCCA_ERROR("At least one reduction is required",
+                 reductionCount > 0);
+      for (int r = 0; r < reductionCount; ++r) {
+        const reduction_t &reduction = reductions[r];
+        OCCA_ERROR("Reduction [" << r << "] uses vector [" << reduction.vec1 << "]"
+                   << " but only " << vectorCount << " vectors were given",
+                   (0 <= reduction.vec1) && (reduction.vec1 < vectorCount));
+        if (reduction.usesTwoVectors()) {
+          OCCA_ERROR("Reduction [" << r << "] uses vector [" << reduction.vec2 << "]"
+                     << " but only " << vectorCount << " vectors were given",
+                     (0 <= reduction.vec2) && (reduction.vec2 < vectorCount));
+        }
+      }
+
+      std::stringstream ss;
+      ss << "#ifndef ABS_FUNC\n"
+            "#  define ABS_FUNC fabs\n"
+            "#endif\n"
+            "#ifndef INDEX_TYPE\n"
+            "#  define INDEX_TYPE int\n"
+            "#endif\n"
+            "\n";
+
+      // Stage 1: Each block reduces its slice of the vectors
+      ss << "@kernel void multiReduce(const INDEX_TYPE entries,\n";
+      for (int i = 0; i < vectorCount; ++i) {
+        ss << "                         const VTYPE *v" << i << ",\n";
+      }
+      ss << "                         RETTYPE *partials) {\n"
+            "#ifdef OCCA_USING_GPU\n"
+            "  for (int oi = 0; oi < " << multiReduceBlocks << "; ++oi; @outer) {\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        ss << "    @shared RETTYPE s_red" << r << "[" << multiReduceInner << "];\n";
+      }
+      ss << "    for (int i = 0; i < " << multiReduceInner << "; ++i; @inner) {\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        ss << "      RETTYPE r_red" << r << " = " << reductionInit(reductions[r]) << ";\n";
+      }
+      ss << "      for (INDEX_TYPE j = (oi * " << multiReduceInner << ") + i; j < entries;"
+            " j += " << (multiReduceBlocks * multiReduceInner) << ") {\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        ss << "        " << reductionOperation(reductions[r], "r_red" + occa::toString(r), "j") << '\n';
+      }
+      ss << "      }\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        ss << "      s_red" << r << "[i] = r_red" << r << ";\n";
+      }
+      ss << "    }\n";
+      for (int n = (multiReduceInner / 2); n > 0; n /= 2) {
+        ss << "    for (int i = 0; i < " << multiReduceInner << "; ++i; @inner) {\n"
+              "      if (i < " << n << ") {\n";
+        for (int r = 0; r < reductionCount; ++r) {
+          const std::string red = "s_red" + occa::toString(r);
+          ss << "        " << reductionCombine(reductions[r],
+                                               red + "[i]",
+                                               red + "[i + " + occa::toString(n) + "]") << '\n';
+        }
+        ss << "      }\n"
+              "    }\n";
+      }
+      ss << "    for (int i = 0; i < " << multiReduceInner << "; ++i; @inner) {\n"
+            "      if (i == 0) {\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        ss << "        partials[" << (r * multiReduceBlocks) << " + oi] = s_red" << r << "[0];\n";
+      }
+      ss << "      }\n"
+            "    }\n"
+            "  }\n"
+            "#else\n"
+            "  for (int oi = 0; oi < " << multiReduceBlocks << "; ++oi; @outer) {\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        ss << "    RETTYPE r_red" << r << " = " << reductionInit(reductions[r]) << ";\n";
+      }
+      ss << "    const INDEX_TYPE r_blockSize = (entries + " << (multiReduceBlocks - 1) << ") / " << multiReduceBlocks << ";\n"
+            "    const INDEX_TYPE r_start = oi * r_blockSize;\n"
+            "    for (INDEX_TYPE i = r_start; i < (r_start + r_blockSize); ++i; @inner) {\n"
+            "      if (i < entries) {\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        ss << "        " << reductionOperation(reductions[r], "r_red" + occa::toString(r), "i") << '\n';
+      }
+      ss << "      }\n"
+            "    }\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        ss << "    partials[" << (r * multiReduceBlocks) << " + oi] = r_red" << r << ";\n";
+      }
+      ss << "  }\n"
+            "#endif\n"
+            "}\n"
+            "\n";
+
+      // Stage 2: Reduce the partials on the device
+      ss << "@kernel void multiReduceFinalize(const RETTYPE *partials,\n"
+            "                                 RETTYPE *results) {\n"
+            "  for (int r = 0; r < " << reductionCount << "; ++r; @outer) {\n"
+            "    for (int i = 0; i < 1; ++i; @inner) {\n";
+      for (int r = 0; r < reductionCount; ++r) {
+        const reduction_t &reduction = reductions[r];
+        const int offset = r * multiReduceBlocks;
+        ss << "      if (r == " << r << ") {\n"
+              "        RETTYPE r_red = partials[" << offset << "];\n"
+              "        for (int b = 1; b < " << multiReduceBlocks << "; ++b) {\n"
+              "          " << reductionCombine(reduction,
+                                               "r_red",
+                                               "partials[" + occa::toString(offset) + " + b]") << "\n"
+              "        }\n"
+              "        results[" << r << "] = " << reductionFinalize(reduction, "r_red") << ";\n"
+              "      }\n";
+      }
+      ss << "    }\n"
+            "  }\n"
+            "}\n";
+
+      return ss.str();
+    }
+    //==================================
   }
 }
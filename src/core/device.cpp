@@ -1,8 +1,11 @@
 #include <occa/core/device.hpp>
 #include <occa/core/base.hpp>
+#include <occa/core/memoryPool.hpp>
 #include <occa/modes.hpp>
+#include <occa/tools/dirtyPages.hpp>
 #include <occa/tools/env.hpp>
 #include <occa/tools/sys.hpp>
+#include <occa/tools/trace.hpp>
 #include <occa/io.hpp>
 
 namespace occa {
@@ -11,7 +14,13 @@ namespace occa {
     mode((std::string) properties_["mode"]),
     properties(properties_),
     needsLauncherKernel(false),
-    bytesAllocated(0) {}
+    bytesAllocated(0),
+    memoryPool(NULL),
+    pendingKernelBuilds(0) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_init(&kernelBuildsCondition, NULL);
+#endif
+  }
 
   modeDevice_t::~modeDevice_t() {
     // Null all wrappers
@@ -20,16 +29,31 @@ namespace occa {
       deviceRing.removeRef(mem);
       mem->modeDevice = NULL;
     }
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_destroy(&kernelBuildsCondition);
+#endif
+    kernelMutex.free();
   }
 
   // Must be called before ~modeDevice_t()!
   void modeDevice_t::freeResources() {
+    waitForKernelBuilds();
     freeRing<modeKernel_t>(kernelRing);
+    // Cached blocks are in the memory ring
+    delete memoryPool;
+    memoryPool = NULL;
     freeRing<modeMemory_t>(memoryRing);
     freeRing<modeStream_t>(streamRing);
     freeRing<modeStreamTag_t>(streamTagRing);
   }
 
+  memoryPool_t& modeDevice_t::getMemoryPool() {
+    if (!memoryPool) {
+      memoryPool = new memoryPool_t(this);
+    }
+    return *memoryPool;
+  }
+
   void modeDevice_t::dontUseRefs() {
     deviceRing.dontUseRefs();
   }
@@ -47,11 +71,15 @@ namespace occa {
   }
 
   void modeDevice_t::addKernelRef(modeKernel_t *kernel) {
+    kernelMutex.lock();
     kernelRing.addRef(kernel);
+    kernelMutex.unlock();
   }
 
   void modeDevice_t::removeKernelRef(modeKernel_t *kernel) {
+    kernelMutex.lock();
     kernelRing.removeRef(kernel);
+    kernelMutex.unlock();
   }
 
   void modeDevice_t::addMemoryRef(modeMemory_t *memory) {
@@ -115,20 +143,115 @@ namespace occa {
                          kernel->name);
   }
 
-  kernel& modeDevice_t::getCachedKernel(const hash_t &kernelHash,
-                                        const std::string &kernelName) {
+  kernel modeDevice_t::getCachedKernel(const hash_t &kernelHash,
+                                       const std::string &kernelName) {
+    kernel cachedKernel;
+    kernelMutex.lock();
+    cachedKernelMapIterator it = cachedKernels.find(getKernelHash(kernelHash, kernelName));
+    if (it != cachedKernels.end()) {
+      cachedKernel = it->second;
+    }
+    kernelMutex.unlock();
+    return cachedKernel;
+  }
 
-    return cachedKernels[getKernelHash(kernelHash, kernelName)];
+  void modeDevice_t::setCachedKernel(const hash_t &kernelHash,
+                                     const std::string &kernelName,
+                                     const kernel &kernel_) {
+    kernelMutex.lock();
+    kernel &cachedKernel = cachedKernels[getKernelHash(kernelHash, kernelName)];
+    // Keep the replaced kernel alive until the lock is released
+    //   since freeing it removes its cache entry
+    kernel previousKernel = cachedKernel;
+    cachedKernel = kernel_;
+    kernelMutex.unlock();
+  }
+
+  void modeDevice_t::removeCachedKernel(const hash_t &kernelHash,
+                                        const std::string &kernelName) {
+    kernel previousKernel;
+    kernelMutex.lock();
+    cachedKernelMapIterator it = cachedKernels.find(getKernelHash(kernelHash, kernelName));
+    if (it != cachedKernels.end()) {
+      previousKernel = it->second;
+      cachedKernels.erase(it);
+    }
+    kernelMutex.unlock();
   }
 
   void modeDevice_t::removeCachedKernel(modeKernel_t *kernel) {
-    if (kernel == NULL) {
+    if ((kernel == NULL) ||
+        !kernel->properties.has("hash")) {
       return;
     }
+    kernelMutex.lock();
     cachedKernelMapIterator it = cachedKernels.find(getKernelHash(kernel));
     if (it != cachedKernels.end()) {
-      cachedKernels.erase(it);
+      // ~modeKernel_t NULLs the cached wrapper before calling this,
+      //   skip entries that belong to a different kernel with the same key
+      modeKernel_t *cachedModeKernel = it->second.getModeKernel();
+      if (!cachedModeKernel || (cachedModeKernel == kernel)) {
+        cachedKernels.erase(it);
+      }
     }
+    kernelMutex.unlock();
+  }
+
+  kernel modeDevice_t::buildHashedKernel(const std::string &filename,
+                                         const std::string &kernelName,
+                                         const hash_t &kernelHash,
+                                         const occa::properties &kernelProps) {
+    const std::string hashDir = io::hashDir(filename, kernelHash);
+
+    occa::properties allProps = kernelProps;
+    allProps["hash"] = kernelHash.getFullString();
+
+    kernel newKernel = buildKernel(filename,
+                                   kernelName,
+                                   kernelHash,
+                                   allProps);
+
+    if (newKernel.isInitialized()) {
+      newKernel.getModeKernel()->hash = kernelHash;
+    } else {
+      removeCachedKernel(kernelHash, kernelName);
+      io::cacheIndex::remove(hashDir);
+      sys::rmrf(hashDir);
+    }
+
+    return newKernel;
+  }
+
+  void modeDevice_t::addPendingKernelBuild() {
+    kernelMutex.lock();
+    ++pendingKernelBuilds;
+    kernelMutex.unlock();
+  }
+
+  void modeDevice_t::removePendingKernelBuild() {
+    kernelMutex.lock();
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    if (!(--pendingKernelBuilds)) {
+      pthread_cond_broadcast(&kernelBuildsCondition);
+    }
+#else
+    --pendingKernelBuilds;
+#endif
+    kernelMutex.unlock();
+  }
+
+  void modeDevice_t::waitForKernelBuilds() {
+    kernelMutex.lock();
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    while (pendingKernelBuilds) {
+      pthread_cond_wait(&kernelBuildsCondition, &(kernelMutex.mutexHandle));
+    }
+#endif
+    kernelMutex.unlock();
+  }
+
+  bool modeDevice_t::hasThreadSafeKernelBuilds() const {
+    return false;
   }
   //====================================
 
@@ -220,6 +343,15 @@ namespace occa {
     deviceProps["memory"] = initialObjectProps(mode_, "memory", props);
     deviceProps["stream"] = initialObjectProps(mode_, "stream", props);
 
+    // Tracing is process-wide once a device enables it
+    if (props.get("trace", false)) {
+      trace::enable();
+      const std::string traceFile = props.get<std::string>("trace_file");
+      if (traceFile.size()) {
+        trace::setExitFile(traceFile);
+      }
+    }
+
     setModeDevice(occa::newModeDevice(deviceProps));
 
     // Create an initial stream
@@ -250,7 +382,9 @@ namespace occa {
 
   const occa::properties& device::kernelProperties() const {
     assertInitialized();
-    return (const occa::properties&) modeDevice->properties["kernel"];
+    // Read through a const reference to avoid copying shared properties
+    const occa::properties &props = modeDevice->properties;
+    return (const occa::properties&) props["kernel"];
   }
 
   occa::properties device::kernelProperties(const occa::properties &additionalProps) const {
@@ -262,7 +396,9 @@ namespace occa {
 
   const occa::properties& device::memoryProperties() const {
     assertInitialized();
-    return (const occa::properties&) modeDevice->properties["memory"];
+    // Read through a const reference to avoid copying shared properties
+    const occa::properties &props = modeDevice->properties;
+    return (const occa::properties&) props["memory"];
   }
 
   occa::properties device::memoryProperties(const occa::properties &additionalProps) const {
@@ -274,7 +410,9 @@ namespace occa {
 
   const occa::properties& device::streamProperties() const {
     assertInitialized();
-    return (const occa::properties&) modeDevice->properties["stream"];
+    // Read through a const reference to avoid copying shared properties
+    const occa::properties &props = modeDevice->properties;
+    return (const occa::properties&) props["stream"];
   }
 
   occa::properties device::streamProperties(const occa::properties &additionalProps) const {
@@ -305,15 +443,63 @@ namespace occa {
     return 0;
   }
 
+  udim_t device::memoryPoolReserved() const {
+    if (modeDevice && modeDevice->memoryPool) {
+      return modeDevice->memoryPool->reservedBytes;
+    }
+    return 0;
+  }
+
+  udim_t device::memoryPoolCached() const {
+    if (modeDevice && modeDevice->memoryPool) {
+      return modeDevice->memoryPool->cachedBytes;
+    }
+    return 0;
+  }
+
+  udim_t device::memoryPoolPeak() const {
+    if (modeDevice && modeDevice->memoryPool) {
+      return modeDevice->memoryPool->peakReservedBytes;
+    }
+    return 0;
+  }
+
+  udim_t device::memoryPoolHits() const {
+    if (modeDevice && modeDevice->memoryPool) {
+      return modeDevice->memoryPool->hits;
+    }
+    return 0;
+  }
+
+  udim_t device::memoryPoolMisses() const {
+    if (modeDevice && modeDevice->memoryPool) {
+      return modeDevice->memoryPool->misses;
+    }
+    return 0;
+  }
+
+  void device::trimMemoryPool(const udim_t bytes) {
+    if (modeDevice && modeDevice->memoryPool) {
+      modeDevice->memoryPool->trim(bytes);
+    }
+  }
+
   void device::finish() {
     if (!modeDevice) {
       return;
     }
+    dirtyPageTrackerVector syncedPages;
     if (modeDevice->hasSeparateMemorySpace()) {
       const size_t staleEntries = uvaStaleMemory.size();
       for (size_t i = 0; i < staleEntries; ++i) {
         occa::modeMemory_t *mem = uvaStaleMemory[i];
 
+        // Kernels can write anywhere so the whole buffer is copied back
+        if (mem->dirtyPages) {
+          mem->dirtyPages->stopTracking();
+          syncedPages.push_back(mem->dirtyPages);
+        }
+
         mem->copyTo(mem->uvaPtr, mem->size, 0, "async: true");
 
         mem->memInfo &= ~uvaFlag::inDevice;
@@ -325,6 +511,11 @@ namespace occa {
     }
 
     modeDevice->finish();
+
+    // Host writes after the copies finish are tracked again
+    if (syncedPages.size()) {
+      dirtyPageTracker_t::startTracking(syncedPages);
+    }
   }
 
   bool device::hasSeparateMemorySpace() {
@@ -384,26 +575,36 @@ namespace occa {
   }
 
   hash_t device::applyDependencyHash(const hash_t &kernelHash) const {
-    // Check if the build.json exists to compare dependencies
-    const std::string buildFile = io::hashDir(kernelHash) + kc::buildFile;
-    if (!io::exists(buildFile)) {
-      return kernelHash;
-    }
+    const std::string hashDir = io::hashDir(kernelHash);
+
+    io::strHashMap dependencyHashes;
+    if (!io::cacheIndex::getDependencyHashes(hashDir, dependencyHashes)) {
+      // Check if the build.json exists to compare dependencies
+      const std::string buildFile = hashDir + kc::buildFile;
+      if (!io::exists(buildFile)) {
+        return kernelHash;
+      }
 
-    json buildJson = json::read(buildFile);
-    json dependenciesJson = buildJson["kernel/dependencies"];
-    if (!dependenciesJson.isInitialized()) {
-      return kernelHash;
+      json buildJson = json::read(buildFile);
+      json dependenciesJson = buildJson["kernel/dependencies"];
+      if (dependenciesJson.isInitialized()) {
+        jsonObject &dependencyObject = dependenciesJson.object();
+        jsonObject::iterator it = dependencyObject.begin();
+        while (it != dependencyObject.end()) {
+          dependencyHashes[it->first] = hash_t::fromString(it->second);
+          ++it;
+        }
+      }
+      io::cacheIndex::setDependencyHashes(hashDir, dependencyHashes);
     }
 
     hash_t newKernelHash = kernelHash;
     bool foundDependencyChanges = false;
 
-    jsonObject dependencyHashes = dependenciesJson.object();
-    jsonObject::iterator it = dependencyHashes.begin();
+    io::strHashMap::iterator it = dependencyHashes.begin();
     while (it != dependencyHashes.end()) {
       const std::string &dependency = it->first;
-      const hash_t dependencyHash = hash_t::fromString(it->second);
+      const hash_t &dependencyHash = it->second;
 
       if (io::exists(dependency)) {
         // Check whether the dependency changed
@@ -431,35 +632,40 @@ namespace occa {
   kernel device::buildKernel(const std::string &filename,
                              const std::string &kernelName,
                              const occa::properties &props) const {
+    const bool tracing = trace::isEnabled();
+    const double start = tracing ? trace::now() : 0;
+
     occa::properties allProps;
     hash_t kernelHash;
     setupKernelInfo(props, hashFile(filename),
                     allProps, kernelHash);
 
-    // TODO: [#185] Fix kernel cache frees
-    // // Check cache first
-    // kernel &cachedKernel = modeDevice->getCachedKernel(kernelHash,
-    //                                                    kernelName);
-    // if (cachedKernel.isInitialized()) {
-    //   return cachedKernel;
-    // }
+    if (tracing) {
+      trace::record(trace::category::build, "hash", start);
+    }
 
-    const std::string realFilename = io::filename(filename);
-    const std::string hashDir = io::hashDir(realFilename, kernelHash);
-    allProps["hash"] = kernelHash.getFullString();
+    // Check cache first
+    kernel cachedKernel = modeDevice->getCachedKernel(kernelHash,
+                                                      kernelName);
+    if (cachedKernel.isInitialized()) {
+      return cachedKernel;
+    }
 
-    kernel cachedKernel = modeDevice->buildKernel(realFilename,
-                                                  kernelName,
-                                                  kernelHash,
-                                                  allProps);
+    kernel newKernel = modeDevice->buildHashedKernel(io::filename(filename),
+                                                     kernelName,
+                                                     kernelHash,
+                                                     allProps);
+    if (newKernel.isInitialized()) {
+      modeDevice->setCachedKernel(kernelHash, kernelName, newKernel);
+    }
 
-    if (cachedKernel.isInitialized()) {
-      cachedKernel.modeKernel->hash = kernelHash;
-    } else {
-      sys::rmrf(hashDir);
+    if (tracing) {
+      occa::json args;
+      args["hash"] = kernelHash.getString();
+      trace::record(trace::category::build, kernelName, start, 0, args);
     }
 
-    return cachedKernel;
+    return newKernel;
   }
 
   kernel device::buildKernelFromString(const std::string &content,
@@ -470,6 +676,13 @@ namespace occa {
     setupKernelInfo(props, occa::hash(content),
                     allProps, kernelHash);
 
+    // Skip writing the source file if the kernel is already loaded
+    kernel cachedKernel = modeDevice->getCachedKernel(kernelHash,
+                                                      kernelName);
+    if (cachedKernel.isInitialized()) {
+      return cachedKernel;
+    }
+
     io::lock_t lock(kernelHash, "occa-device");
     std::string stringSourceFile = io::hashDir(kernelHash);
     stringSourceFile += "string_source.cpp";
@@ -496,6 +709,64 @@ namespace occa {
                                                     props));
   }
 
+  kernelFutureVector device::buildKernelsAsync(const kernelBuildRequestVector &requests,
+                                               const occa::properties &props) const {
+    assertInitialized();
+
+    const int requestCount = (int) requests.size();
+    kernelFutureVector futures(requestCount);
+    kernelBuildJobVector newJobs;
+
+    for (int i = 0; i < requestCount; ++i) {
+      const kernelBuildRequest &request = requests[i];
+
+      occa::properties allProps;
+      hash_t kernelHash;
+      setupKernelInfo(request.props, hashFile(request.filename),
+                      allProps, kernelHash);
+
+      kernelBuildJob_t *job = new kernelBuildJob_t(modeDevice,
+                                                   io::filename(request.filename),
+                                                   request.kernelName,
+                                                   kernelHash,
+                                                   allProps);
+
+      // Loaded kernels resolve right away
+      kernel cachedKernel = modeDevice->getCachedKernel(kernelHash,
+                                                        request.kernelName);
+      if (cachedKernel.isInitialized()) {
+        job->result = cachedKernel;
+        job->done = true;
+        futures[i] = kernelFuture(job);
+        continue;
+      }
+
+      // Share jobs with identical hashes, including in-flight builds
+      modeDevice->kernelMutex.lock();
+      kernelBuildJob_t *&jobEntry = modeDevice->kernelBuilds[job->cacheKey()];
+      if (!jobEntry) {
+        jobEntry = job;
+        newJobs.push_back(job);
+      }
+      kernelBuildJob_t *sharedJob = jobEntry;
+      futures[i] = kernelFuture(sharedJob);
+      modeDevice->kernelMutex.unlock();
+
+      if (sharedJob != job) {
+        delete job;
+      }
+    }
+
+    const int threads = (
+      modeDevice->hasThreadSafeKernelBuilds()
+      ? props.get("threads", sys::getCoreCount())
+      : 0
+    );
+    kernelBuildPool::run(newJobs, threads);
+
+    return futures;
+  }
+
   void device::loadKernels(const std::string &library) {
     // TODO 1.1: Load kernels
 #if 0
@@ -570,13 +841,28 @@ namespace occa {
                << "negative bytes (" << bytes << ")",
                bytes >= 0);
 
+    const bool tracing = trace::isEnabled();
+    const double start = tracing ? trace::now() : 0;
+
     occa::properties memProps = memoryProperties(props);
 
-    memory mem(modeDevice->malloc(bytes, src, memProps));
+    // Memory wrapping host pointers isn't pooled
+    const bool usePool = (memProps.get("pool", false)
+                          && !(src && memProps.get("use_host_pointer", false)));
+
+    memory mem(usePool
+               ? modeDevice->getMemoryPool().malloc(bytes, src, memProps)
+               : modeDevice->malloc(bytes, src, memProps));
     mem.setDtype(dtype);
 
     modeDevice->bytesAllocated += bytes;
 
+    if (tracing) {
+      occa::json args;
+      args["pool"] = usePool;
+      trace::record(trace::category::malloc, "malloc", start, bytes, args);
+    }
+
     return mem;
   }
 
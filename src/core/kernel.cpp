@@ -1,11 +1,14 @@
 #include <occa/core/device.hpp>
 #include <occa/core/kernel.hpp>
+#include <occa/core/kernelArgPack.hpp>
 #include <occa/core/memory.hpp>
 #include <occa/io.hpp>
 #include <occa/lang/builtins/types.hpp>
 #include <occa/lang/parser.hpp>
 #include <occa/lang/transforms/builtins/finders.hpp>
+#include <occa/tools/dirtyPages.hpp>
 #include <occa/tools/sys.hpp>
+#include <occa/tools/trace.hpp>
 #include <occa/tools/uva.hpp>
 
 namespace occa {
@@ -30,6 +33,7 @@ namespace occa {
     }
     // Remove ref from device
     if (modeDevice) {
+      modeDevice->removeCachedKernel(this);
       modeDevice->removeKernelRef(this);
     }
   }
@@ -50,10 +54,15 @@ namespace occa {
     return kernelRing.needsFree();
   }
 
-  void modeKernel_t::assertArgumentLimit() const {
+  int modeKernel_t::maxArgs() const {
+    return OCCA_MAX_ARGS;
+  }
+
+  void modeKernel_t::assertArgumentLimit(const int argc) const {
     // Check argument limit
-    OCCA_ERROR("(" << name << ") Kernels can have at most [" << OCCA_MAX_ARGS << "] arguments",
-               ((int) arguments.size() + 1) < OCCA_MAX_ARGS);
+    const int maxArgc = maxArgs();
+    OCCA_ERROR("(" << name << ") Kernels can have at most [" << maxArgc << "] arguments",
+               (maxArgc < 0) || ((argc + 1) < maxArgc));
   }
 
   void modeKernel_t::assertArgInDevice(const kernelArgData &arg) const {
@@ -80,68 +89,100 @@ namespace occa {
       arguments.push_back(argi);
     }
 
-    assertArgumentLimit();
+    assertArgumentLimit((int) arguments.size());
   }
 
-  void modeKernel_t::setupRun() {
-    const int argc = (int) arguments.size();
-
-    const bool validateTypes = (
+  bool modeKernel_t::validatesArgumentTypes() const {
+    return (
       metadata.isInitialized()
       && properties.get("type_validation", true)
     );
+  }
 
-    if (validateTypes) {
-      const int metaArgc = (int) metadata.arguments.size();
-
-      OCCA_ERROR("(" << name << ") Kernel expects ["
-                 << metaArgc << "] argument"
-                 << (metaArgc != 1 ? "s," : ",")
-                 << " received ["
-                 << argc << ']',
-                 argc == metaArgc);
-
-      // TODO: Get original arg #
-      for (int i = 0; i < argc; ++i) {
-        kernelArgData &arg = arguments[i];
-        lang::argMetadata_t &argInfo = metadata.arguments[i];
-
-        modeMemory_t *mem = arg.getModeMemory();
-        const bool isNull = arg.isNull();
-        const bool isPtr = mem || isNull;
-        if (isPtr != argInfo.isPtr) {
-          if (argInfo.isPtr) {
-            OCCA_FORCE_ERROR("(" << name << ") Kernel expects an occa::memory for argument ["
-                             << (i + 1) << "]");
-          } else {
-            OCCA_FORCE_ERROR("(" << name << ") Kernel expects a non-occa::memory type for argument ["
-                             << (i + 1) << "]");
-          }
-        }
-
-        if (!isPtr || isNull) {
-          continue;
-        }
-
-        OCCA_ERROR("(" << name << ") Argument [" << (i + 1) << "] has wrong runtime type.\n"
-                   << "Expected type: " << argInfo.dtype << '\n'
-                   << "Received type: " << *(mem->dtype_) << '\n',
-                   mem->dtype_->canBeCastedTo(argInfo.dtype));
-
-        arg.setupForKernelCall(argInfo.isConst);
-      }
+  void modeKernel_t::assertArgumentCount(const int argc) const {
+    if (!validatesArgumentTypes()) {
       return;
     }
+    const int metaArgc = (int) metadata.arguments.size();
 
-    // Non-OKL kernel setup
+    OCCA_ERROR("(" << name << ") Kernel expects ["
+               << metaArgc << "] argument"
+               << (metaArgc != 1 ? "s," : ",")
+               << " received ["
+               << argc << ']',
+               argc == metaArgc);
+  }
+
+  bool modeKernel_t::assertArgumentType(const int index,
+                                        const kernelArgData &arg) const {
+    // Non-OKL kernels
     // All memory arguments are expected to be non-const for UVA purposes
+    if (!validatesArgumentTypes()) {
+      return false;
+    }
+
+    // TODO: Get original arg #
+    const lang::argMetadata_t &argInfo = metadata.arguments[index];
+
+    modeMemory_t *mem = arg.getModeMemory();
+    const bool isNull = arg.isNull();
+    const bool isPtr = mem || isNull;
+    if (isPtr != argInfo.isPtr) {
+      if (argInfo.isPtr) {
+        OCCA_FORCE_ERROR("(" << name << ") Kernel expects an occa::memory for argument ["
+                         << (index + 1) << "]");
+      } else {
+        OCCA_FORCE_ERROR("(" << name << ") Kernel expects a non-occa::memory type for argument ["
+                         << (index + 1) << "]");
+      }
+    }
+
+    if (isPtr && !isNull) {
+      OCCA_ERROR("(" << name << ") Argument [" << (index + 1) << "] has wrong runtime type.\n"
+                 << "Expected type: " << argInfo.dtype << '\n'
+                 << "Received type: " << *(mem->dtype_) << '\n',
+                 mem->dtype_->canBeCastedTo(argInfo.dtype));
+    }
+
+    return argInfo.isConst;
+  }
+
+  void modeKernel_t::setupRun() {
+    const int argc = (int) arguments.size();
+
+    assertArgumentCount(argc);
+
+    dirtyPageTrackerVector syncedPages;
     for (int i = 0; i < argc; ++i) {
       kernelArgData &arg = arguments[i];
-      modeMemory_t *mem = arg.getModeMemory();
-      if (mem) {
-        arg.setupForKernelCall(false);
+      const bool isConst = assertArgumentType(i, arg);
+      if (arg.getModeMemory()) {
+        arg.setupForKernelCall(isConst, syncedPages);
       }
     }
+    if (syncedPages.size()) {
+      dirtyPageTracker_t::startTracking(syncedPages);
+    }
+  }
+
+  static occa::json dimToJson(const dim &d) {
+    occa::json j(json::array_);
+    for (int i = 0; i < d.dims; ++i) {
+      j += d[i];
+    }
+    return j;
+  }
+
+  void modeKernel_t::recordLaunch(const double start) const {
+    // Launches on asynchronous streams only record the time to queue them
+    occa::json args;
+    args["arguments"] = (int) arguments.size();
+    // Modes running the @outer loops in the kernel don't set dims
+    if (outerDims.dims) {
+      args["outer_dims"] = dimToJson(outerDims);
+      args["inner_dims"] = dimToJson(innerDims);
+    }
+    trace::record(trace::category::launch, name, start, 0, args);
   }
   //====================================
 
@@ -306,8 +347,16 @@ namespace occa {
   void kernel::run() const {
     assertInitialized();
 
+    if (!trace::isEnabled()) {
+      modeKernel->setupRun();
+      modeKernel->run();
+      return;
+    }
+
+    const double start = trace::now();
     modeKernel->setupRun();
     modeKernel->run();
+    modeKernel->recordLaunch(start);
   }
 
 #include "kernelOperators.cpp"
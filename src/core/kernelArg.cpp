@@ -1,6 +1,7 @@
 #include <occa/core/device.hpp>
 #include <occa/core/memory.hpp>
 #include <occa/core/kernelArg.hpp>
+#include <occa/tools/dirtyPages.hpp>
 #include <occa/tools/uva.hpp>
 
 namespace occa {
@@ -51,14 +52,15 @@ namespace occa {
     return (info & kArgInfo::isNull);
   }
 
-  void kernelArgData::setupForKernelCall(const bool isConst) const {
+  void kernelArgData::setupForKernelCall(const bool isConst,
+                                         dirtyPageTrackerVector &syncedPages) const {
     if (!modeMemory              ||
         !modeMemory->isManaged() ||
         !modeMemory->modeDevice->hasSeparateMemorySpace()) {
       return;
     }
     if (!modeMemory->inDevice()) {
-      modeMemory->copyFrom(modeMemory->uvaPtr, modeMemory->size);
+      copyDirtyPagesToDevice(modeMemory, syncedPages);
       modeMemory->memInfo |= uvaFlag::inDevice;
     }
     if (!isConst && !modeMemory->isStale()) {
@@ -213,10 +215,7 @@ namespace occa {
     if (argIsUva) {
       modeMemory = (modeMemory_t*) arg;
     } else if (lookAtUva) {
-      ptrRangeMap::iterator it = uvaMap.find(arg);
-      if (it != uvaMap.end()) {
-        modeMemory = it->second;
-      }
+      modeMemory = uvaMap.find(arg);
     }
 
     if (modeMemory) {
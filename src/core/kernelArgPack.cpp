@@ -0,0 +1,221 @@
+#include <occa/core/device.hpp>
+#include <occa/core/kernelArgPack.hpp>
+#include <occa/core/memory.hpp>
+#include <occa/tools/dirtyPages.hpp>
+#include <occa/tools/trace.hpp>
+
+namespace occa {
+  //---[ kernelArgPack ]----------------
+  kernelArgPack::kernelArgPack() {}
+
+  kernelArgPack::kernelArgPack(const occa::kernel &kernel__,
+                               const kernelArg *args,
+                               const int count) :
+    kernel_(kernel__) {
+    assertInitialized();
+
+    for (int i = 0; i < count; ++i) {
+      const kernelArg &arg = args[i];
+      const int argCount = arg.size();
+      for (int j = 0; j < argCount; ++j) {
+        arguments.push_back(arg[j]);
+      }
+    }
+
+    modeKernel_t *modeKernel = kernel_.getModeKernel();
+    const int argc = (int) arguments.size();
+    modeKernel->assertArgumentLimit(argc);
+    modeKernel->assertArgumentCount(argc);
+
+    constArguments.resize(argc, false);
+    scalarTypes.resize(argc, NULL);
+    for (int i = 0; i < argc; ++i) {
+      bindArgument(i);
+    }
+    setupUvaArguments();
+  }
+
+  kernelArgPack::kernelArgPack(const kernelArgPack &other) :
+    kernel_(other.kernel_),
+    arguments(other.arguments),
+    constArguments(other.constArguments),
+    scalarTypes(other.scalarTypes),
+    uvaArguments(other.uvaArguments) {}
+
+  kernelArgPack& kernelArgPack::operator = (const kernelArgPack &other) {
+    kernel_ = other.kernel_;
+    arguments = other.arguments;
+    constArguments = other.constArguments;
+    scalarTypes = other.scalarTypes;
+    uvaArguments = other.uvaArguments;
+    return *this;
+  }
+
+  void kernelArgPack::assertInitialized() const {
+    OCCA_ERROR("Kernel not initialized or has been freed",
+               kernel_.getModeKernel() != NULL);
+  }
+
+  void kernelArgPack::bindArgument(const int index) {
+    modeKernel_t *modeKernel = kernel_.getModeKernel();
+    const kernelArgData &arg = arguments[index];
+
+    modeKernel->assertArgInDevice(arg);
+    constArguments[index] = modeKernel->assertArgumentType(index, arg);
+
+    // Non-OKL kernels don't have argument types to check scalars against
+    scalarTypes[index] = NULL;
+    if (modeKernel->validatesArgumentTypes()) {
+      const lang::argMetadata_t &argInfo = modeKernel->metadata.arguments[index];
+      if (!argInfo.isPtr) {
+        scalarTypes[index] = &(argInfo.dtype);
+      }
+    }
+  }
+
+  void kernelArgPack::setupUvaArguments() {
+    uvaArguments.clear();
+
+    const int argc = (int) arguments.size();
+    for (int i = 0; i < argc; ++i) {
+      modeMemory_t *mem = arguments[i].getModeMemory();
+      if (mem
+          && mem->isManaged()
+          && mem->modeDevice->hasSeparateMemorySpace()) {
+        uvaArguments.push_back(i);
+      }
+    }
+  }
+
+  void kernelArgPack::assertScalar(const int index,
+                                   const dtype_t &type) const {
+    OCCA_ERROR("Argument index [" << index << "] is out of bounds",
+               (0 <= index) && (index < (int) arguments.size()));
+
+    const kernelArgData &arg = arguments[index];
+    OCCA_ERROR("Argument [" << (index + 1) << "] was not bound to a scalar"
+               " of [" << type.bytes() << "] bytes",
+               !arg.getModeMemory()
+               && !(arg.info & kArgInfo::usePointer)
+               && (arg.size == (udim_t) type.bytes()));
+
+    // Same-sized integers and floats can't be told apart by size
+    const dtype_t *expectedType = scalarTypes[index];
+    OCCA_ERROR("Argument [" << (index + 1) << "] has wrong runtime type.\n"
+               << "Expected type: " << *expectedType << '\n'
+               << "Received type: " << type << '\n',
+               !expectedType || type.canBeCastedTo(*expectedType));
+  }
+
+  bool kernelArgPack::isInitialized() const {
+    return (kernel_.getModeKernel() != NULL);
+  }
+
+  occa::kernel kernelArgPack::getKernel() const {
+    return kernel_;
+  }
+
+  int kernelArgPack::size() const {
+    return (int) arguments.size();
+  }
+
+  void kernelArgPack::set(const int index, const kernelArg &arg) {
+    assertInitialized();
+    OCCA_ERROR("Argument index [" << index << "] is out of bounds",
+               (0 <= index) && (index < (int) arguments.size()));
+    OCCA_ERROR("Only one argument can be set at a time",
+               arg.size() == 1);
+
+    arguments[index] = arg[0];
+    bindArgument(index);
+    setupUvaArguments();
+  }
+
+  void kernelArgPack::set(const int index, const uint8_t value) {
+    assertScalar(index, dtype::uint8);
+    arguments[index].data.uint8_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const uint16_t value) {
+    assertScalar(index, dtype::uint16);
+    arguments[index].data.uint16_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const uint32_t value) {
+    assertScalar(index, dtype::uint32);
+    arguments[index].data.uint32_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const uint64_t value) {
+    assertScalar(index, dtype::uint64);
+    arguments[index].data.uint64_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const int8_t value) {
+    assertScalar(index, dtype::int8);
+    arguments[index].data.int8_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const int16_t value) {
+    assertScalar(index, dtype::int16);
+    arguments[index].data.int16_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const int32_t value) {
+    assertScalar(index, dtype::int32);
+    arguments[index].data.int32_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const int64_t value) {
+    assertScalar(index, dtype::int64);
+    arguments[index].data.int64_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const float value) {
+    assertScalar(index, dtype::float_);
+    arguments[index].data.float_ = value;
+  }
+
+  void kernelArgPack::set(const int index, const double value) {
+    assertScalar(index, dtype::double_);
+    arguments[index].data.double_ = value;
+  }
+
+  void kernelArgPack::run() const {
+    assertInitialized();
+    modeKernel_t *modeKernel = kernel_.getModeKernel();
+
+    const int uvaArgs = (int) uvaArguments.size();
+    dirtyPageTrackerVector syncedPages;
+    for (int i = 0; i < uvaArgs; ++i) {
+      const int index = uvaArguments[i];
+      arguments[index].setupForKernelCall(constArguments[index],
+                                          syncedPages);
+    }
+    if (syncedPages.size()) {
+      dirtyPageTracker_t::startTracking(syncedPages);
+    }
+
+    const bool tracing = trace::isEnabled();
+    const double start = tracing ? trace::now() : 0;
+
+    // Lend the bound arguments to the kernel without copying them
+    modeKernel->arguments.swap(arguments);
+    try {
+      modeKernel->run();
+    } catch (...) {
+      modeKernel->arguments.swap(arguments);
+      throw;
+    }
+    modeKernel->arguments.swap(arguments);
+
+    if (tracing) {
+      modeKernel->recordLaunch(start);
+    }
+  }
+
+  void kernelArgPack::operator () () const {
+    run();
+  }
+  //====================================
+}
@@ -1,6 +1,7 @@
 #include <occa/core/device.hpp>
 #include <occa/core/kernelBuilder.hpp>
 #include <occa/core/scope.hpp>
+#include <occa/core/tuning.hpp>
 #include <occa/tools/json.hpp>
 #include <occa/tools/lex.hpp>
 #include <occa/tools/string.hpp>
@@ -56,7 +57,7 @@ namespace occa {
   }
 
   occa::kernel kernelBuilder::build(occa::device device) {
-    return build(device, hash(device), defaultProps);
+    return build(device, hash(device));
   }
 
   occa::kernel kernelBuilder::build(occa::device device,
@@ -70,7 +71,11 @@ namespace occa {
 
   occa::kernel kernelBuilder::build(occa::device device,
                                     const hash_t &hash) {
-    return build(device, hash, defaultProps);
+    occa::kernel &kernel = kernelMap[hash];
+    if (!kernel.isInitialized()) {
+      kernel = buildKernel(device, tunedProperties(device));
+    }
+    return kernel;
   }
 
   occa::kernel kernelBuilder::build(occa::device device,
@@ -78,15 +83,19 @@ namespace occa {
                                     const occa::properties &props) {
     occa::kernel &kernel = kernelMap[hash];
     if (!kernel.isInitialized()) {
-      if (buildingFromFile) {
-        kernel = device.buildKernel(source_, function_, props);
-      } else {
-        kernel = device.buildKernelFromString(source_, function_, props);
-      }
+      kernel = buildKernel(device, props);
     }
     return kernel;
   }
 
+  occa::kernel kernelBuilder::buildKernel(occa::device device,
+                                          const occa::properties &props) {
+    if (buildingFromFile) {
+      return device.buildKernel(source_, function_, props);
+    }
+    return device.buildKernelFromString(source_, function_, props);
+  }
+
   occa::kernel kernelBuilder::operator [] (occa::device device) {
     return build(device, hash(device));
   }
@@ -110,6 +119,149 @@ namespace occa {
     kernel.run();
   }
 
+  //---[ Tuning ]---------------------
+  static void getSearchDimensions(const json &space,
+                                  const std::string &path,
+                                  strVector &paths,
+                                  std::vector<jsonArray> &values) {
+    if (space.isArray()) {
+      OCCA_ERROR("Search space [" << path << "] has no values",
+                 space.size() > 0);
+      paths.push_back(path);
+      values.push_back(space.array());
+      return;
+    }
+    if (!space.isObject()) {
+      return;
+    }
+    const jsonObject &object = space.object();
+    jsonObject::const_iterator it = object.begin();
+    while (it != object.end()) {
+      getSearchDimensions(it->second,
+                          path.size() ? (path + "/" + it->first) : it->first,
+                          paths,
+                          values);
+      ++it;
+    }
+  }
+
+  static double timeKernel(occa::device device,
+                           occa::kernel kernel,
+                           const std::vector<occa::kernelArg> &args,
+                           const int warmup,
+                           const int repeats) {
+    kernel.clearArgs();
+    for (int i = 0; i < (int) args.size(); ++i) {
+      kernel.pushArg(args[i]);
+    }
+
+    for (int i = 0; i < warmup; ++i) {
+      kernel.run();
+    }
+    device.finish();
+
+    // Keep the fastest run, the others are slowed down by noise
+    double bestTime = -1;
+    for (int i = 0; i < repeats; ++i) {
+      const double start = sys::currentTime();
+      kernel.run();
+      device.finish();
+      const double time = sys::currentTime() - start;
+      if ((bestTime < 0) || (time < bestTime)) {
+        bestTime = time;
+      }
+    }
+    return bestTime;
+  }
+
+  occa::kernel kernelBuilder::tune(occa::device device,
+                                   const occa::properties &searchSpace,
+                                   const std::vector<occa::kernelArg> &args,
+                                   const occa::properties &tuneProps) {
+    const int warmup = tuneProps.get("warmup", 2);
+    const int repeats = tuneProps.get("repeats", 5);
+    OCCA_ERROR("Tuning needs at least one timed run per variant",
+               repeats > 0);
+
+    strVector paths;
+    std::vector<jsonArray> values;
+    getSearchDimensions(searchSpace, "", paths, values);
+
+    const int dimensions = (int) paths.size();
+    OCCA_ERROR("Search space has no values to tune",
+               dimensions > 0);
+
+    int variantCount = 1;
+    for (int d = 0; d < dimensions; ++d) {
+      variantCount *= (int) values[d].size();
+    }
+
+    occa::kernel bestKernel;
+    occa::properties bestVariant;
+    double bestTime = -1;
+    for (int v = 0; v < variantCount; ++v) {
+      occa::properties variant;
+      int index = v;
+      for (int d = 0; d < dimensions; ++d) {
+        const int size = (int) values[d].size();
+        variant[paths[d]] = values[d][index % size];
+        index /= size;
+      }
+
+      occa::properties kernelProps = defaultProps;
+      kernelProps += variant;
+      occa::kernel kernel = buildKernel(device, kernelProps);
+
+      // Kernels are shared with other builds of the same hash,
+      //   so slower variants are only dropped, not freed
+      const double time = timeKernel(device, kernel, args, warmup, repeats);
+      if ((bestTime < 0) || (time < bestTime)) {
+        bestKernel = kernel;
+        bestVariant = variant;
+        bestTime = time;
+      }
+    }
+
+    json entry;
+    entry["function"] = function_;
+    entry["props"] = bestVariant;
+    entry["time"] = bestTime;
+    entry["variants"] = variantCount;
+    tuning::set(device, tuningKey(), entry);
+
+    // Replace the kernel used by build(device)
+    kernelMap[hash(device)] = bestKernel;
+
+    return bestKernel;
+  }
+
+  occa::properties kernelBuilder::tunedProperties(occa::device device) {
+    occa::properties props = defaultProps;
+    json entry = tuning::get(device, tuningKey());
+    if (entry.isInitialized()) {
+      props += entry["props"];
+    }
+    return props;
+  }
+
+  void kernelBuilder::clearTuning(occa::device device) {
+    tuning::remove(device, tuningKey());
+
+    hashedKernelMapIterator it = kernelMap.find(hash(device));
+    if (it != kernelMap.end()) {
+      kernelMap.erase(it);
+    }
+  }
+
+  std::string kernelBuilder::tuningKey() const {
+    return (
+      occa::hash(source_)
+      ^ occa::hash(function_)
+      ^ defaultProps.hash()
+    ).getFullString();
+  }
+  //==================================
+
   void kernelBuilder::free() {
     hashedKernelMapIterator it = kernelMap.begin();
     while (it != kernelMap.end()) {
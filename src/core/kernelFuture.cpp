@@ -0,0 +1,317 @@
+#include <occa/core/device.hpp>
+#include <occa/core/kernelFuture.hpp>
+#include <occa/tools/env.hpp>
+
+namespace occa {
+  //---[ kernelBuildRequest ]-----------
+  kernelBuildRequest::kernelBuildRequest() {}
+
+  kernelBuildRequest::kernelBuildRequest(const std::string &filename_,
+                                         const std::string &kernelName_,
+                                         const occa::properties &props_) :
+    filename(filename_),
+    kernelName(kernelName_),
+    props(props_) {}
+  //====================================
+
+  //---[ kernelBuildJob_t ]-------------
+  kernelBuildJob_t::kernelBuildJob_t(modeDevice_t *modeDevice_,
+                                     const std::string &filename_,
+                                     const std::string &kernelName_,
+                                     const hash_t &kernelHash_,
+                                     const occa::properties &kernelProps_) :
+    modeDevice(modeDevice_),
+    filename(filename_),
+    kernelName(kernelName_),
+    kernelHash(kernelHash_),
+    kernelProps(kernelProps_),
+    settings(occa::settings()),
+    refs(0),
+    done(false),
+    error(NULL) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_init(&doneCondition, NULL);
+#endif
+  }
+
+  kernelBuildJob_t::~kernelBuildJob_t() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_destroy(&doneCondition);
+#endif
+    mutex.free();
+    delete error;
+  }
+
+  std::string kernelBuildJob_t::cacheKey() const {
+    return modeDevice->getKernelHash(kernelHash, kernelName);
+  }
+
+  void kernelBuildJob_t::addRef() {
+    mutex.lock();
+    ++refs;
+    mutex.unlock();
+  }
+
+  void kernelBuildJob_t::removeRef() {
+    mutex.lock();
+    const bool isLastRef = (--refs == 0);
+    mutex.unlock();
+    if (isLastRef) {
+      delete this;
+    }
+  }
+
+  void kernelBuildJob_t::run() {
+    occa::settings() = settings;
+
+    // Assign directly to [result] so no other wrapper of the
+    //   new kernel outlives the build in this thread
+    try {
+      result = modeDevice->buildHashedKernel(filename,
+                                             kernelName,
+                                             kernelHash,
+                                             kernelProps);
+    } catch (exception &exc) {
+      error = new exception(exc);
+    } catch (...) {
+      error = new exception("Error",
+                            __FILE__,
+                            __FUNCTION__,
+                            __LINE__,
+                            "Unknown error building kernel [" + kernelName + "]");
+    }
+
+    // New requests for this kernel start their own job from here on
+    modeDevice->kernelMutex.lock();
+    kernelBuildJobMapIterator it = modeDevice->kernelBuilds.find(cacheKey());
+    if ((it != modeDevice->kernelBuilds.end()) &&
+        (it->second == this)) {
+      modeDevice->kernelBuilds.erase(it);
+    }
+    modeDevice->kernelMutex.unlock();
+
+    mutex.lock();
+    done = true;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_cond_broadcast(&doneCondition);
+#endif
+    mutex.unlock();
+  }
+
+  void kernelBuildJob_t::wait() {
+    mutex.lock();
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    while (!done) {
+      pthread_cond_wait(&doneCondition, &(mutex.mutexHandle));
+    }
+#endif
+    mutex.unlock();
+  }
+  //====================================
+
+  //---[ kernelFuture ]-----------------
+  kernelFuture::kernelFuture() :
+    job(NULL) {}
+
+  kernelFuture::kernelFuture(kernelBuildJob_t *job_) :
+    job(NULL) {
+    setJob(job_);
+  }
+
+  kernelFuture::kernelFuture(const kernelFuture &other) :
+    job(NULL) {
+    setJob(other.job);
+  }
+
+  kernelFuture& kernelFuture::operator = (const kernelFuture &other) {
+    setJob(other.job);
+    return *this;
+  }
+
+  kernelFuture::~kernelFuture() {
+    setJob(NULL);
+  }
+
+  void kernelFuture::setJob(kernelBuildJob_t *job_) {
+    if (job == job_) {
+      return;
+    }
+    if (job_) {
+      job_->addRef();
+    }
+    if (job) {
+      job->removeRef();
+    }
+    job = job_;
+  }
+
+  bool kernelFuture::isInitialized() const {
+    return job;
+  }
+
+  bool kernelFuture::isReady() const {
+    if (!job) {
+      return false;
+    }
+    job->mutex.lock();
+    const bool done = job->done;
+    job->mutex.unlock();
+    return done;
+  }
+
+  void kernelFuture::wait() const {
+    if (job) {
+      job->wait();
+    }
+  }
+
+  occa::kernel kernelFuture::get() const {
+    OCCA_ERROR("Kernel future not initialized",
+               job != NULL);
+
+    job->wait();
+    if (job->error) {
+      throw exception(*(job->error));
+    }
+
+    kernel &result = job->result;
+    if (!result.isInitialized()) {
+      return result;
+    }
+
+    // Cache the kernel in the resolving thread to keep wrappers
+    //   of cached kernels out of the build threads
+    modeDevice_t *modeDevice = result.getModeKernel()->modeDevice;
+    kernel cachedKernel = modeDevice->getCachedKernel(job->kernelHash,
+                                                      job->kernelName);
+    if (cachedKernel.isInitialized()) {
+      return cachedKernel;
+    }
+    modeDevice->setCachedKernel(job->kernelHash,
+                                job->kernelName,
+                                result);
+    return result;
+  }
+  //====================================
+
+  //---[ Build Pool ]-------------------
+  namespace kernelBuildPool {
+    class batch_t {
+    public:
+      kernelBuildJobVector jobs;
+      size_t nextJob;
+      int threadLimit;
+      int runningJobs;
+
+      batch_t(const kernelBuildJobVector &jobs_,
+              const int threadLimit_) :
+        jobs(jobs_),
+        nextJob(0),
+        threadLimit(threadLimit_),
+        runningJobs(0) {}
+    };
+
+    static void finishJob(kernelBuildJob_t *job) {
+      modeDevice_t *modeDevice = job->modeDevice;
+      job->removeRef();
+      modeDevice->removePendingKernelBuild();
+    }
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    // Workers are shared by every device and live until the process exits
+    static pthread_mutex_t poolMutex = PTHREAD_MUTEX_INITIALIZER;
+    static pthread_cond_t jobCondition = PTHREAD_COND_INITIALIZER;
+    static std::vector<batch_t*> batches;
+    static int workerCount = 0;
+
+    // Takes the next job from the oldest batch with a free thread slot
+    //   and must be called with [poolMutex] locked
+    static kernelBuildJob_t* nextJob(batch_t *&jobBatch) {
+      const int batchCount = (int) batches.size();
+      for (int i = 0; i < batchCount; ++i) {
+        batch_t *batch = batches[i];
+        if (batch->runningJobs < batch->threadLimit) {
+          kernelBuildJob_t *job = batch->jobs[batch->nextJob++];
+          ++(batch->runningJobs);
+          if (batch->nextJob == batch->jobs.size()) {
+            batches.erase(batches.begin() + i);
+          }
+          jobBatch = batch;
+          return job;
+        }
+      }
+      return NULL;
+    }
+
+    static void* runWorker(void *) {
+      pthread_mutex_lock(&poolMutex);
+      while (true) {
+        batch_t *batch = NULL;
+        kernelBuildJob_t *job = nextJob(batch);
+        if (!job) {
+          pthread_cond_wait(&jobCondition, &poolMutex);
+          continue;
+        }
+        pthread_mutex_unlock(&poolMutex);
+
+        job->run();
+        finishJob(job);
+
+        pthread_mutex_lock(&poolMutex);
+        --(batch->runningJobs);
+        if ((batch->nextJob == batch->jobs.size()) &&
+            !batch->runningJobs) {
+          delete batch;
+        } else {
+          // Our thread slot in [batch] is free again
+          pthread_cond_broadcast(&jobCondition);
+        }
+      }
+      return NULL;
+    }
+#endif
+
+    void run(const kernelBuildJobVector &jobs,
+             const int threadCount) {
+      const int jobCount = (int) jobs.size();
+      for (int i = 0; i < jobCount; ++i) {
+        jobs[i]->addRef();
+        jobs[i]->modeDevice->addPendingKernelBuild();
+      }
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      static const int maxWorkers = sys::getCoreCount();
+
+      int threads = (threadCount < jobCount) ? threadCount : jobCount;
+      threads = (threads < maxWorkers) ? threads : maxWorkers;
+      if (0 < threads) {
+        pthread_mutex_lock(&poolMutex);
+        while (workerCount < threads) {
+          pthread_t thread;
+          if (pthread_create(&thread, NULL, runWorker, NULL)) {
+            break;
+          }
+          pthread_detach(thread);
+          ++workerCount;
+        }
+        const bool hasWorkers = workerCount;
+        if (hasWorkers) {
+          batches.push_back(new batch_t(jobs, threads));
+          pthread_cond_broadcast(&jobCondition);
+        }
+        pthread_mutex_unlock(&poolMutex);
+
+        if (hasWorkers) {
+          return;
+        }
+      }
+#endif
+
+      for (int i = 0; i < jobCount; ++i) {
+        jobs[i]->run();
+        finishJob(jobs[i]);
+      }
+    }
+  }
+  //====================================
+}
@@ -783,3 +783,682 @@ void kernel::operator() (const kernelArg &arg1, const kernelArg &arg2, const ker
   run();
 }
 
+kernelArgPack kernel::bind() const {
+  return kernelArgPack(*this, NULL, 0);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1) const {
+  kernelArg args[] = {
+    arg1
+  };
+  return kernelArgPack(*this, args, 1);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2) const {
+  kernelArg args[] = {
+    arg1, arg2
+  };
+  return kernelArgPack(*this, args, 2);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3
+  };
+  return kernelArgPack(*this, args, 3);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4
+  };
+  return kernelArgPack(*this, args, 4);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5
+  };
+  return kernelArgPack(*this, args, 5);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6
+  };
+  return kernelArgPack(*this, args, 6);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7
+  };
+  return kernelArgPack(*this, args, 7);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8
+  };
+  return kernelArgPack(*this, args, 8);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9
+  };
+  return kernelArgPack(*this, args, 9);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10
+  };
+  return kernelArgPack(*this, args, 10);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11
+  };
+  return kernelArgPack(*this, args, 11);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12
+  };
+  return kernelArgPack(*this, args, 12);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13
+  };
+  return kernelArgPack(*this, args, 13);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14
+  };
+  return kernelArgPack(*this, args, 14);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15
+  };
+  return kernelArgPack(*this, args, 15);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16
+  };
+  return kernelArgPack(*this, args, 16);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17
+  };
+  return kernelArgPack(*this, args, 17);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18
+  };
+  return kernelArgPack(*this, args, 18);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19
+  };
+  return kernelArgPack(*this, args, 19);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20
+  };
+  return kernelArgPack(*this, args, 20);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21
+  };
+  return kernelArgPack(*this, args, 21);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22
+  };
+  return kernelArgPack(*this, args, 22);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23
+  };
+  return kernelArgPack(*this, args, 23);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24
+  };
+  return kernelArgPack(*this, args, 24);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25
+  };
+  return kernelArgPack(*this, args, 25);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26
+  };
+  return kernelArgPack(*this, args, 26);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27
+  };
+  return kernelArgPack(*this, args, 27);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28
+  };
+  return kernelArgPack(*this, args, 28);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29
+  };
+  return kernelArgPack(*this, args, 29);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30
+  };
+  return kernelArgPack(*this, args, 30);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31
+  };
+  return kernelArgPack(*this, args, 31);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32
+  };
+  return kernelArgPack(*this, args, 32);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33
+  };
+  return kernelArgPack(*this, args, 33);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34
+  };
+  return kernelArgPack(*this, args, 34);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35
+  };
+  return kernelArgPack(*this, args, 35);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36
+  };
+  return kernelArgPack(*this, args, 36);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37
+  };
+  return kernelArgPack(*this, args, 37);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38
+  };
+  return kernelArgPack(*this, args, 38);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39
+  };
+  return kernelArgPack(*this, args, 39);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40
+  };
+  return kernelArgPack(*this, args, 40);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41
+  };
+  return kernelArgPack(*this, args, 41);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42
+  };
+  return kernelArgPack(*this, args, 42);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42, arg43
+  };
+  return kernelArgPack(*this, args, 43);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42, arg43, arg44
+  };
+  return kernelArgPack(*this, args, 44);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42, arg43, arg44, arg45
+  };
+  return kernelArgPack(*this, args, 45);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                           const kernelArg &arg46) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42, arg43, arg44, arg45, arg46
+  };
+  return kernelArgPack(*this, args, 46);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                           const kernelArg &arg46, const kernelArg &arg47) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42, arg43, arg44, arg45, arg46, arg47
+  };
+  return kernelArgPack(*this, args, 47);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                           const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48
+  };
+  return kernelArgPack(*this, args, 48);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                           const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48, const kernelArg &arg49) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49
+  };
+  return kernelArgPack(*this, args, 49);
+}
+
+kernelArgPack kernel::bind(const kernelArg &arg1, const kernelArg &arg2, const kernelArg &arg3, const kernelArg &arg4, const kernelArg &arg5,
+                           const kernelArg &arg6, const kernelArg &arg7, const kernelArg &arg8, const kernelArg &arg9, const kernelArg &arg10,
+                           const kernelArg &arg11, const kernelArg &arg12, const kernelArg &arg13, const kernelArg &arg14, const kernelArg &arg15,
+                           const kernelArg &arg16, const kernelArg &arg17, const kernelArg &arg18, const kernelArg &arg19, const kernelArg &arg20,
+                           const kernelArg &arg21, const kernelArg &arg22, const kernelArg &arg23, const kernelArg &arg24, const kernelArg &arg25,
+                           const kernelArg &arg26, const kernelArg &arg27, const kernelArg &arg28, const kernelArg &arg29, const kernelArg &arg30,
+                           const kernelArg &arg31, const kernelArg &arg32, const kernelArg &arg33, const kernelArg &arg34, const kernelArg &arg35,
+                           const kernelArg &arg36, const kernelArg &arg37, const kernelArg &arg38, const kernelArg &arg39, const kernelArg &arg40,
+                           const kernelArg &arg41, const kernelArg &arg42, const kernelArg &arg43, const kernelArg &arg44, const kernelArg &arg45,
+                           const kernelArg &arg46, const kernelArg &arg47, const kernelArg &arg48, const kernelArg &arg49, const kernelArg &arg50) const {
+  kernelArg args[] = {
+    arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10,
+    arg11, arg12, arg13, arg14, arg15, arg16, arg17, arg18, arg19, arg20,
+    arg21, arg22, arg23, arg24, arg25, arg26, arg27, arg28, arg29, arg30,
+    arg31, arg32, arg33, arg34, arg35, arg36, arg37, arg38, arg39, arg40,
+    arg41, arg42, arg43, arg44, arg45, arg46, arg47, arg48, arg49, arg50
+  };
+  return kernelArgPack(*this, args, 50);
+}
+
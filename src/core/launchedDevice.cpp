@@ -88,10 +88,7 @@ namespace occa {
     const std::string binaryFilename = hashDir + kc::binaryFile;
 
     // Check if binary exists and is finished
-    bool foundBinary = (
-      io::cachedFileIsComplete(hashDir, kc::binaryFile)
-      && io::isFile(binaryFilename)
-    );
+    bool foundBinary = io::cachedFileIsComplete(hashDir, kc::binaryFile);
 
     io::lock_t lock;
     if (!foundBinary) {
@@ -2,10 +2,13 @@
 
 #include <occa/core/base.hpp>
 #include <occa/core/memory.hpp>
+#include <occa/core/memoryPool.hpp>
 #include <occa/core/device.hpp>
 #include <occa/modes/serial/memory.hpp>
+#include <occa/tools/dirtyPages.hpp>
 #include <occa/tools/uva.hpp>
 #include <occa/tools/sys.hpp>
+#include <occa/tools/trace.hpp>
 
 namespace occa {
   //---[ modeMemory_t ]-----------------
@@ -16,6 +19,8 @@ namespace occa {
     properties(properties_),
     ptr(NULL),
     uvaPtr(NULL),
+    dirtyPages(NULL),
+    poolBlock(NULL),
     modeDevice(modeDevice_),
     dtype_(&dtype::byte),
     size(size_),
@@ -24,6 +29,7 @@ namespace occa {
   }
 
   modeMemory_t::~modeMemory_t() {
+    delete dirtyPages;
     // NULL all wrappers
     while (memoryRing.head) {
       memory *mem = (memory*) memoryRing.head;
@@ -71,14 +77,22 @@ namespace occa {
 
 
   //---[ memory ]-----------------------
+  // Device writes outside of UVA syncs aren't seen by the dirty page
+  //   tracker, so the next sync copies the whole buffer
+  static void stopTrackingPages(modeMemory_t *mem) {
+    if (mem->dirtyPages) {
+      mem->dirtyPages->stopTracking();
+    }
+  }
+
   memory::memory() :
       modeMemory(NULL) {}
 
   memory::memory(void *uvaPtr) :
       modeMemory(NULL) {
-    ptrRangeMap::iterator it = uvaMap.find(uvaPtr);
-    if (it != uvaMap.end()) {
-      setModeMemory(it->second);
+    modeMemory_t *uvaMemory = uvaMap.find(uvaPtr);
+    if (uvaMemory) {
+      setModeMemory(uvaMemory);
     } else {
       setModeMemory((modeMemory_t*) uvaPtr);
     }
@@ -255,19 +269,24 @@ namespace occa {
     if ( !(modeMemory->modeDevice->hasSeparateMemorySpace()) ) {
       modeMemory->uvaPtr = modeMemory->ptr;
     } else {
-      modeMemory->uvaPtr = (char*) sys::malloc(modeMemory->size);
+      const int dirtyPageMethod_ = getDirtyPageMethod(modeMemory->properties);
+      if (dirtyPageMethod_ != dirtyPageMethod::none) {
+        // Page protection needs the host buffer to own its pages
+        modeMemory->uvaPtr = (char*) dirtyPageTracker_t::malloc(modeMemory->size);
+        modeMemory->dirtyPages = new dirtyPageTracker_t(modeMemory->uvaPtr,
+                                                        modeMemory->size,
+                                                        dirtyPageMethod_);
+      } else {
+        modeMemory->uvaPtr = (char*) sys::malloc(modeMemory->size);
+      }
     }
 
-    ptrRange range;
-    range.start = modeMemory->uvaPtr;
-    range.end   = (range.start + modeMemory->size);
-
-    uvaMap[range] = modeMemory;
-    modeMemory->modeDevice->uvaMap[range] = modeMemory;
+    uvaMap.insert(modeMemory->uvaPtr, modeMemory->size, modeMemory);
+    modeMemory->modeDevice->uvaMap.insert(modeMemory->uvaPtr, modeMemory->size, modeMemory);
 
     // Needed for kernelArg.void_ -> modeMemory checks
     if (modeMemory->uvaPtr != modeMemory->ptr) {
-      uvaMap[modeMemory->ptr] = modeMemory;
+      uvaMap.insert(modeMemory->ptr, 0, modeMemory);
     }
   }
 
@@ -308,6 +327,16 @@ namespace occa {
 
     copyFrom(modeMemory->uvaPtr, bytes_, offset);
 
+    // Host and device only match after syncing the whole buffer
+    dirtyPageTracker_t *pages = modeMemory->dirtyPages;
+    if (pages) {
+      if (bytes_ == modeMemory->size) {
+        pages->startTracking();
+      } else {
+        pages->stopTracking();
+      }
+    }
+
     modeMemory->memInfo |=  uvaFlag::inDevice;
     modeMemory->memInfo &= ~uvaFlag::isStale;
 
@@ -337,8 +366,17 @@ namespace occa {
       return;
     }
 
+    dirtyPageTracker_t *pages = modeMemory->dirtyPages;
+    if (pages) {
+      pages->stopTracking();
+    }
+
     copyTo(modeMemory->uvaPtr, bytes_, offset);
 
+    if (pages && (bytes_ == modeMemory->size)) {
+      pages->startTracking();
+    }
+
     modeMemory->memInfo &= ~uvaFlag::inDevice;
     modeMemory->memInfo &= ~uvaFlag::isStale;
 
@@ -430,7 +468,15 @@ namespace occa {
                << " trying to access [" << offset << ", " << (offset + bytes_) << "]",
                (bytes_ + offset) <= modeMemory->size);
 
+    const bool tracing = trace::isEnabled();
+    const double start = tracing ? trace::now() : 0;
+
+    stopTrackingPages(modeMemory);
     modeMemory->copyFrom(src, bytes_, offset, props);
+
+    if (tracing) {
+      trace::record(trace::category::copy, "host to device", start, bytes_);
+    }
   }
 
   void memory::copyFrom(const memory src,
@@ -459,7 +505,15 @@ namespace occa {
                << " trying to access [" << destOffset << ", " << (destOffset + bytes_) << "]",
                (bytes_ + destOffset) <= modeMemory->size);
 
+    const bool tracing = trace::isEnabled();
+    const double start = tracing ? trace::now() : 0;
+
+    stopTrackingPages(modeMemory);
     modeMemory->copyFrom(src.modeMemory, bytes_, destOffset, srcOffset, props);
+
+    if (tracing) {
+      trace::record(trace::category::copy, "device to device", start, bytes_);
+    }
   }
 
   void memory::copyTo(void *dest,
@@ -480,7 +534,14 @@ namespace occa {
                << " trying to access [" << offset << ", " << (offset + bytes_) << "]",
                (bytes_ + offset) <= modeMemory->size);
 
+    const bool tracing = trace::isEnabled();
+    const double start = tracing ? trace::now() : 0;
+
     modeMemory->copyTo(dest, bytes_, offset, props);
+
+    if (tracing) {
+      trace::record(trace::category::copy, "device to host", start, bytes_);
+    }
   }
 
   void memory::copyTo(memory dest,
@@ -509,7 +570,15 @@ namespace occa {
                << " trying to access [" << destOffset << ", " << (destOffset + bytes_) << "]",
                (bytes_ + destOffset) <= dest.modeMemory->size);
 
+    const bool tracing = trace::isEnabled();
+    const double start = tracing ? trace::now() : 0;
+
+    stopTrackingPages(dest.modeMemory);
     dest.modeMemory->copyFrom(modeMemory, bytes_, destOffset, srcOffset, props);
+
+    if (tracing) {
+      trace::record(trace::category::copy, "device to device", start, bytes_);
+    }
   }
 
   void memory::copyFrom(const void *src,
@@ -562,8 +631,21 @@ namespace occa {
 
     modeDevice_t *modeDevice = modeMemory->modeDevice;
 
+    // Pooled memory owns its slice of the pool block
+    modeMemory_t *poolBlock = modeMemory->poolBlock;
+
+    // Only frees of allocations are traced, not slices or detaches
+    const bool tracing = (trace::isEnabled()
+                          && freeMemory
+                          && (modeMemory->isOrigin || poolBlock));
+    const double start = tracing ? trace::now() : 0;
+    const udim_t bytes = modeMemory->size;
+
+    // Host buffer freed once queued work using it is done
+    void *hostUvaPtr = NULL;
+
     // Free the actual backend memory object
-    if (modeMemory->isOrigin) {
+    if (modeMemory->isOrigin || poolBlock) {
       modeDevice->bytesAllocated -= (modeMemory->size);
 
       if (modeMemory->uvaPtr) {
@@ -578,18 +660,42 @@ namespace occa {
           uvaMap.erase(ptr);
           modeDevice->uvaMap.erase(ptr);
 
-          sys::free(uvaPtr);
+          // Restore page permissions before handing pages back
+          delete modeMemory->dirtyPages;
+          modeMemory->dirtyPages = NULL;
+
+          hostUvaPtr = uvaPtr;
         }
       }
 
-      if (!freeMemory) {
+      if (!freeMemory && modeMemory->isOrigin) {
         modeMemory->detach();
       }
     }
 
     // ~modeMemory_t NULLs all wrappers
+    //   - Mode destructors wait for queued work using the memory
     delete modeMemory;
     modeMemory = NULL;
+
+    if (hostUvaPtr) {
+      sys::free(hostUvaPtr);
+    }
+
+    if (poolBlock) {
+      memoryPool_t &pool = modeDevice->getMemoryPool();
+      if (freeMemory) {
+        pool.free(poolBlock);
+      } else {
+        pool.detach(poolBlock);
+      }
+    }
+
+    if (tracing) {
+      occa::json args;
+      args["pool"] = !!poolBlock;
+      trace::record(trace::category::free, "free", start, bytes, args);
+    }
   }
 
   memory null;
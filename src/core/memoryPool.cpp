@@ -0,0 +1,167 @@
+#include <occa/core/device.hpp>
+#include <occa/core/memory.hpp>
+#include <occa/core/memoryPool.hpp>
+#include <occa/tools/env.hpp>
+
+namespace occa {
+  memoryPool_t::memoryPool_t(modeDevice_t *modeDevice_) :
+    modeDevice(modeDevice_),
+    limit(0),
+    reservedBytes(0),
+    cachedBytes(0),
+    peakReservedBytes(0),
+    hits(0),
+    misses(0) {}
+
+  memoryPool_t::~memoryPool_t() {
+    trim(0);
+    mutex.free();
+  }
+
+  udim_t memoryPool_t::getSizeClass(const udim_t bytes,
+                                    const udim_t alignment) {
+    udim_t size = alignment * ((bytes + alignment - 1) / alignment);
+    if (!size) {
+      size = alignment;
+    }
+
+    // Split each power of two into 4 bins to bound the wasted space
+    udim_t power = 1;
+    while ((power << 1) <= size) {
+      power <<= 1;
+    }
+    const udim_t step = ((power >> 2) > alignment) ? (power >> 2) : alignment;
+    return step * ((size + step - 1) / step);
+  }
+
+  modeMemory_t* memoryPool_t::malloc(const udim_t bytes,
+                                     const void *src,
+                                     const occa::properties &props) {
+    const udim_t alignment = props.get("pool_alignment",
+                                       (udim_t) env::OCCA_MEM_BYTE_ALIGN);
+    OCCA_ERROR("Memory pool alignment [" << alignment << "] must be a power of two",
+               alignment && !(alignment & (alignment - 1)));
+
+    const udim_t blockBytes = getSizeClass(bytes, alignment);
+
+    occa::properties blockProps = props;
+    blockProps["alignment"] = alignment;
+    const hash_t propsHash = blockProps.hash();
+
+    mutex.lock();
+    limit = props.get("pool_limit", limit);
+
+    modeMemory_t *block = takeBlock(blockBytes, propsHash);
+    if (block) {
+      ++hits;
+      usedBlocks[block] = propsHash;
+    } else {
+      ++misses;
+      // Make room for the new block under the limit
+      if (limit && ((reservedBytes + blockBytes) > limit)) {
+        trimLocked((limit > blockBytes) ? (limit - blockBytes) : 0);
+      }
+    }
+    mutex.unlock();
+
+    if (!block) {
+      block = modeDevice->malloc(blockBytes, NULL, blockProps);
+
+      mutex.lock();
+      usedBlocks[block] = propsHash;
+      reservedBytes += blockBytes;
+      if (peakReservedBytes < reservedBytes) {
+        peakReservedBytes = reservedBytes;
+      }
+      mutex.unlock();
+    }
+
+    modeMemory_t *mem = block->addOffset(0);
+    mem->modeDevice = modeDevice;
+    mem->size = bytes;
+    mem->isOrigin = false;
+    mem->poolBlock = block;
+
+    if (src) {
+      mem->copyFrom(src, bytes);
+    }
+    return mem;
+  }
+
+  modeMemory_t* memoryPool_t::takeBlock(const udim_t blockBytes,
+                                        const hash_t &propsHash) {
+    blockBinMap::iterator it = freeBlocks.find(blockBytes);
+    if (it == freeBlocks.end()) {
+      return NULL;
+    }
+
+    // Reuse the most recently freed block, which is more likely cached
+    blockVector &blocks = it->second;
+    for (int i = (int) blocks.size() - 1; i >= 0; --i) {
+      modeMemory_t *block = blocks[i].block;
+      if (blocks[i].propsHash == propsHash) {
+        blocks.erase(blocks.begin() + i);
+        cachedBytes -= block->size;
+        return block;
+      }
+    }
+    return NULL;
+  }
+
+  void memoryPool_t::free(modeMemory_t *block) {
+    mutex.lock();
+
+    blockHashMap::iterator it = usedBlocks.find(block);
+    pooledBlock_t pooledBlock;
+    pooledBlock.block = block;
+    pooledBlock.propsHash = it->second;
+    usedBlocks.erase(it);
+
+    freeBlocks[block->size].push_back(pooledBlock);
+    cachedBytes += block->size;
+
+    if (limit && (reservedBytes > limit)) {
+      trimLocked(limit);
+    }
+
+    mutex.unlock();
+  }
+
+  void memoryPool_t::detach(modeMemory_t *block) {
+    mutex.lock();
+    usedBlocks.erase(block);
+    reservedBytes -= block->size;
+    mutex.unlock();
+
+    block->detach();
+    delete block;
+  }
+
+  void memoryPool_t::trim(const udim_t bytes) {
+    mutex.lock();
+    trimLocked(bytes);
+    mutex.unlock();
+  }
+
+  void memoryPool_t::trimLocked(const udim_t bytes) {
+    // Free the largest blocks first
+    while ((reservedBytes > bytes) && cachedBytes) {
+      blockBinMap::iterator it = freeBlocks.end();
+      --it;
+
+      blockVector &blocks = it->second;
+      if (blocks.empty()) {
+        freeBlocks.erase(it);
+        continue;
+      }
+
+      // Free the least recently used block
+      modeMemory_t *block = blocks.front().block;
+      blocks.erase(blocks.begin());
+
+      cachedBytes -= block->size;
+      reservedBytes -= block->size;
+      delete block;
+    }
+  }
+}
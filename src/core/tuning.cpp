@@ -0,0 +1,139 @@
+#include <cstdio>
+#include <sstream>
+
+#include <occa/core/tuning.hpp>
+#include <occa/io/lock.hpp>
+#include <occa/io/utils.hpp>
+#include <occa/tools/env.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace tuning {
+    class tuningState_t {
+    public:
+      occa::mutex mutex;
+      // Databases by filename
+      std::map<std::string, json> databases;
+    };
+
+    static tuningState_t& state() {
+      static tuningState_t state_;
+      return state_;
+    }
+
+    static json readDatabase(const std::string &filename_) {
+      if (io::isFile(filename_)) {
+        json db = json::read(filename_);
+        if (db.isObject()) {
+          return db;
+        }
+      }
+      return json(json::object_);
+    }
+
+    // Loads the database on first use, expects the state to be locked
+    static json& getDatabase(tuningState_t &s,
+                             const std::string &filename_) {
+      std::map<std::string, json>::iterator it = s.databases.find(filename_);
+      if (it != s.databases.end()) {
+        return it->second;
+      }
+      json &db = s.databases[filename_];
+      db = readDatabase(filename_);
+      return db;
+    }
+
+    // Merges the update with entries written by other processes
+    static void writeDatabase(tuningState_t &s,
+                              const std::string &filename_,
+                              const std::string &key,
+                              const json &entry) {
+      sys::mkpath(io::dirname(filename_));
+
+      io::lock_t lock(occa::hash(filename_), "tuning");
+      if (!lock.isMine()) {
+        return;
+      }
+
+      json db = readDatabase(filename_);
+      if (entry.isInitialized()) {
+        db[key] = entry;
+      } else {
+        db.remove(key);
+      }
+
+      std::stringstream ss;
+      ss << filename_ << ".tmp." << sys::getPID();
+      const std::string tmpFilename = ss.str();
+
+      io::write(tmpFilename, db.dump());
+      if (::rename(tmpFilename.c_str(), filename_.c_str())) {
+        ::remove(tmpFilename.c_str());
+        return;
+      }
+      s.databases[filename_] = db;
+    }
+
+    hash_t deviceHash(occa::device device) {
+      return (
+        device.hash()
+        ^ occa::hash(device.mode())
+        ^ occa::hash(sys::getProcessorName())
+      );
+    }
+
+    std::string filename(occa::device device) {
+      return (env::OCCA_CACHE_DIR
+              + "tuning/"
+              + deviceHash(device).getFullString()
+              + ".json");
+    }
+
+    json get(occa::device device,
+             const std::string &key) {
+      const std::string filename_ = filename(device);
+      tuningState_t &s = state();
+
+      s.mutex.lock();
+      json &db = getDatabase(s, filename_);
+      json entry;
+      if (db.has(key)) {
+        entry = db[key];
+      }
+      s.mutex.unlock();
+
+      return entry;
+    }
+
+    void set(occa::device device,
+             const std::string &key,
+             const json &entry) {
+      const std::string filename_ = filename(device);
+      tuningState_t &s = state();
+
+      s.mutex.lock();
+      // Update the in-memory database even if we fail to write it
+      getDatabase(s, filename_)[key] = entry;
+      writeDatabase(s, filename_, key, entry);
+      s.mutex.unlock();
+    }
+
+    void remove(occa::device device,
+                const std::string &key) {
+      const std::string filename_ = filename(device);
+      tuningState_t &s = state();
+
+      s.mutex.lock();
+      getDatabase(s, filename_).remove(key);
+      writeDatabase(s, filename_, key, json());
+      s.mutex.unlock();
+    }
+
+    void clear() {
+      tuningState_t &s = state();
+      s.mutex.lock();
+      s.databases.clear();
+      s.mutex.unlock();
+    }
+  }
+}
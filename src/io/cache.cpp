@@ -1,5 +1,6 @@
 #include <occa/defines.hpp>
 #include <occa/io/cache.hpp>
+#include <occa/io/cacheIndex.hpp>
 #include <occa/io/lock.hpp>
 #include <occa/io/utils.hpp>
 #include <occa/tools/hash.hpp>
@@ -93,15 +94,34 @@ namespace occa {
 
       successFile += filename;
       io::write(successFile, "");
+
+      cacheIndex::markComplete(hashDir, filename);
     }
 
     bool cachedFileIsComplete(const std::string &hashDir,
                               const std::string &filename) {
+      if (cacheIndex::isComplete(hashDir, filename)) {
+        if (io::isFile(hashDir + filename)) {
+          return true;
+        }
+        // The cached file was deleted after it was indexed
+        cacheIndex::remove(hashDir);
+        return false;
+      }
+
+      // Fallback for entries cached before the index existed
       std::string successFile = hashDir;
       successFile += ".success/";
       successFile += filename;
 
-      return io::exists(successFile);
+      const bool isComplete = (
+        io::exists(successFile)
+        && io::isFile(hashDir + filename)
+      );
+      if (isComplete) {
+        cacheIndex::markComplete(hashDir, filename);
+      }
+      return isComplete;
     }
 
     void setBuildProps(occa::json &props) {
@@ -0,0 +1,516 @@
+#include <cstdio>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <occa/defines.hpp>
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+#include <occa/io/cacheIndex.hpp>
+#include <occa/io/lock.hpp>
+#include <occa/io/utils.hpp>
+#include <occa/tools/string.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace io {
+    cacheIndexEntry_t::cacheIndexEntry_t() :
+      hasDependencies(false) {}
+
+    namespace cacheIndex {
+      // Record types, one tab-separated record per line
+      //   C <hashDir> <filename>           : Cached file is complete
+      //   D <hashDir> [<path> <hash>]...   : Dependency hashes
+      //   R <hashDir>                      : Entry was removed
+      static const char completeRecord   = 'C';
+      static const char dependencyRecord = 'D';
+      static const char removeRecord     = 'R';
+
+      // Rewrite the index once it has this many superseded records
+      //   and at least as many superseded records as live ones
+      static const udim_t compactionThreshold = 1024;
+
+      class indexState_t {
+      public:
+        occa::mutex mutex;
+        cacheIndexEntryMap entries;
+
+        // Records read from the index file and how many are still used
+        udim_t fileRecords, liveRecords;
+
+        // Snapshot of the index file when it was last read
+        //   - [parsedBytes] ends at the last complete record
+        bool loaded;
+        udim_t fileIno, fileBytes, parsedBytes;
+        double fileMTime;
+
+        indexState_t() :
+          fileRecords(0),
+          liveRecords(0),
+          loaded(false),
+          fileIno(0),
+          fileBytes(0),
+          parsedBytes(0),
+          fileMTime(0) {}
+
+        void reset() {
+          entries.clear();
+          fileRecords = 0;
+          liveRecords = 0;
+          loaded = false;
+          fileIno = 0;
+          fileBytes = 0;
+          parsedBytes = 0;
+          fileMTime = 0;
+        }
+      };
+
+      static indexState_t& state() {
+        static indexState_t state_;
+        return state_;
+      }
+
+      static std::string indexKey(const std::string &hashDir) {
+        const std::string &cPath = cachePath();
+        if (startsWith(hashDir, cPath)) {
+          return hashDir.substr(cPath.size());
+        }
+        return hashDir;
+      }
+
+      static std::string getCompleteRecord(const std::string &key,
+                                           const std::string &filename) {
+        std::string record;
+        record += completeRecord;
+        record += '\t';
+        record += key;
+        record += '\t';
+        record += filename;
+        return record;
+      }
+
+      static std::string getDependencyRecord(const std::string &key,
+                                             const strHashMap &dependencyHashes) {
+        std::string record;
+        record += dependencyRecord;
+        record += '\t';
+        record += key;
+
+        strHashMap::const_iterator it = dependencyHashes.begin();
+        while (it != dependencyHashes.end()) {
+          record += '\t';
+          record += it->first;
+          record += '\t';
+          record += it->second.getFullString();
+          ++it;
+        }
+        return record;
+      }
+
+      static std::string getRemoveRecord(const std::string &key) {
+        std::string record;
+        record += removeRecord;
+        record += '\t';
+        record += key;
+        return record;
+      }
+
+      // Applies the record and keeps [liveRecords] up to date
+      static void parseRecord(const char *c,
+                              const char *end,
+                              indexState_t &s) {
+        std::vector<std::string> fields;
+        const char *start = c;
+        for (; c <= end; ++c) {
+          if ((c == end) || (*c == '\t')) {
+            fields.push_back(std::string(start, c - start));
+            start = c + 1;
+          }
+        }
+
+        const int fieldCount = (int) fields.size();
+        if ((fieldCount < 2)
+            || (fields[0].size() != 1)) {
+          return;
+        }
+
+        const char recordType = fields[0][0];
+        const std::string &key = fields[1];
+
+        if (recordType == removeRecord) {
+          cacheIndexEntryMap::iterator it = s.entries.find(key);
+          if (it != s.entries.end()) {
+            s.liveRecords -= (it->second.completeFiles.size()
+                              + it->second.hasDependencies);
+            s.entries.erase(it);
+          }
+          return;
+        }
+
+        cacheIndexEntry_t &entry = s.entries[key];
+        if (recordType == completeRecord) {
+          if ((fieldCount == 3)
+              && entry.completeFiles.insert(fields[2]).second) {
+            ++s.liveRecords;
+          }
+        } else if (recordType == dependencyRecord) {
+          if (!entry.hasDependencies) {
+            ++s.liveRecords;
+          }
+          entry.hasDependencies = true;
+          entry.dependencyHashes.clear();
+          for (int i = 2; (i + 1) < fieldCount; i += 2) {
+            entry.dependencyHashes[fields[i]] = hash_t::fromString(fields[i + 1]);
+          }
+        }
+      }
+
+      // Returns the number of bytes parsed, ending at the last complete record
+      static udim_t parseIndex(const char *c,
+                               const char *end,
+                               indexState_t &s) {
+        const char *start = c;
+        while (c < end) {
+          const char *lineEnd = c;
+          while ((lineEnd < end) && (*lineEnd != '\n')) {
+            ++lineEnd;
+          }
+          // Skip partially written records
+          if (lineEnd == end) {
+            break;
+          }
+          parseRecord(c, lineEnd, s);
+          ++s.fileRecords;
+          c = lineEnd + 1;
+        }
+        return (udim_t) (c - start);
+      }
+
+      // Reads the index starting at [offset]
+      static bool readIndex(std::string &content,
+                            const udim_t offset = 0) {
+        const std::string &indexFilename = filename();
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+        const int fd = ::open(indexFilename.c_str(), O_RDONLY);
+        if (fd < 0) {
+          return false;
+        }
+        struct stat statbuf;
+        if (::fstat(fd, &statbuf)) {
+          ::close(fd);
+          return false;
+        }
+        const size_t fileBytes = statbuf.st_size;
+        const size_t bytes = (fileBytes > offset) ? (fileBytes - offset) : 0;
+        if (!bytes) {
+          content.clear();
+        } else if (!offset) {
+          void *ptr = ::mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+          if (ptr == MAP_FAILED) {
+            ::close(fd);
+            return false;
+          }
+          content.assign((const char*) ptr, bytes);
+          ::munmap(ptr, bytes);
+        } else {
+          content.resize(bytes);
+          const ssize_t bytesRead = ::pread(fd, &(content[0]), bytes, offset);
+          content.resize((bytesRead > 0) ? bytesRead : 0);
+        }
+        ::close(fd);
+        return true;
+#else
+        if (!io::isFile(indexFilename)) {
+          return false;
+        }
+        content = io::read(indexFilename, true);
+        content = (content.size() > offset) ? content.substr(offset) : "";
+        return true;
+#endif
+      }
+
+      // Reads records added to the index file since it was last read
+      //   - The whole index is re-read if the file was replaced
+      static void reload(indexState_t &s) {
+        struct stat statbuf;
+        if (::stat(filename().c_str(), &statbuf)) {
+          s.loaded = true;
+          return;
+        }
+
+#if (OCCA_OS == OCCA_LINUX_OS)
+        const double mtime = (statbuf.st_mtim.tv_sec
+                              + (1e-9 * statbuf.st_mtim.tv_nsec));
+#else
+        const double mtime = statbuf.st_mtime;
+#endif
+        const bool sameFile = (
+          s.loaded
+          && (s.fileIno == (udim_t) statbuf.st_ino)
+          && (s.parsedBytes <= (udim_t) statbuf.st_size)
+        );
+        if (sameFile
+            && (s.fileBytes == (udim_t) statbuf.st_size)
+            && (s.fileMTime == mtime)) {
+          return;
+        }
+        if (!sameFile) {
+          s.reset();
+        }
+
+        std::string content;
+        if (!readIndex(content, s.parsedBytes)) {
+          s.loaded = true;
+          return;
+        }
+
+        const udim_t offset = s.parsedBytes;
+        s.parsedBytes += parseIndex(content.c_str(),
+                                    content.c_str() + content.size(),
+                                    s);
+
+        s.loaded = true;
+        s.fileIno = (udim_t) statbuf.st_ino;
+        s.fileBytes = offset + content.size();
+        s.fileMTime = mtime;
+      }
+
+      static cacheIndexEntry_t* findEntry(indexState_t &s,
+                                          const std::string &key) {
+        if (!s.loaded) {
+          reload(s);
+        }
+        cacheIndexEntryMap::iterator it = s.entries.find(key);
+        if (it != s.entries.end()) {
+          return &(it->second);
+        }
+        // Another process could have added the entry
+        reload(s);
+        it = s.entries.find(key);
+        if (it != s.entries.end()) {
+          return &(it->second);
+        }
+        return NULL;
+      }
+
+      // Replaces the index with the live records, expects the index lock
+      static void compact(indexState_t &s) {
+        std::string content;
+        cacheIndexEntryMap::iterator it = s.entries.begin();
+        while (it != s.entries.end()) {
+          const std::string &key = it->first;
+          cacheIndexEntry_t &entry = it->second;
+
+          std::set<std::string>::iterator fileIt = entry.completeFiles.begin();
+          while (fileIt != entry.completeFiles.end()) {
+            content += getCompleteRecord(key, *fileIt);
+            content += '\n';
+            ++fileIt;
+          }
+          if (entry.hasDependencies) {
+            content += getDependencyRecord(key, entry.dependencyHashes);
+            content += '\n';
+          }
+          ++it;
+        }
+
+        const std::string &indexFilename = filename();
+        std::stringstream ss;
+        ss << indexFilename << ".tmp." << sys::getPID();
+        const std::string tmpFilename = ss.str();
+
+        FILE *fp = fopen(tmpFilename.c_str(), "wb");
+        if (!fp) {
+          return;
+        }
+        const size_t written = fwrite(content.c_str(), sizeof(char), content.size(), fp);
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+        fsync(fileno(fp));
+#endif
+        fclose(fp);
+
+        if ((written != content.size())
+            || ::rename(tmpFilename.c_str(), indexFilename.c_str())) {
+          ::remove(tmpFilename.c_str());
+          return;
+        }
+
+        // Re-read the compacted index
+        s.reset();
+        reload(s);
+      }
+
+      // Appends one record to the index file
+      static bool writeRecord(const std::string &record) {
+        const std::string &indexFilename = filename();
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+        const int fd = ::open(indexFilename.c_str(),
+                              O_RDWR | O_APPEND | O_CREAT,
+                              0644);
+        if (fd < 0) {
+          return false;
+        }
+
+        // Drop records left partially written by a crashed process,
+        //   nobody else is writing while we hold the lock
+        struct stat statbuf;
+        if (!::fstat(fd, &statbuf) && statbuf.st_size) {
+          char buffer[256];
+          off_t recordsEnd = statbuf.st_size;
+          while (recordsEnd > 0) {
+            const off_t start = (recordsEnd > (off_t) sizeof(buffer)
+                                 ? (recordsEnd - (off_t) sizeof(buffer))
+                                 : 0);
+            const ssize_t bytes = ::pread(fd, buffer, recordsEnd - start, start);
+            if (bytes != (ssize_t) (recordsEnd - start)) {
+              recordsEnd = statbuf.st_size;
+              break;
+            }
+            int i = (int) bytes - 1;
+            while ((i >= 0) && (buffer[i] != '\n')) {
+              --i;
+            }
+            if (i >= 0) {
+              recordsEnd = start + i + 1;
+              break;
+            }
+            recordsEnd = start;
+          }
+          if ((recordsEnd != statbuf.st_size)
+              && ::ftruncate(fd, recordsEnd)) {
+            ::close(fd);
+            return false;
+          }
+        }
+
+        std::string line = record;
+        line += '\n';
+
+        const bool success = (
+          ::write(fd, line.c_str(), line.size()) == (ssize_t) line.size()
+        );
+        ::close(fd);
+        return success;
+#else
+        std::string content;
+        readIndex(content);
+        content.resize(content.rfind('\n') + 1);
+        content += record;
+        content += '\n';
+        io::write(indexFilename, content);
+        return true;
+#endif
+      }
+
+      static void appendRecord(indexState_t &s,
+                               const std::string &record) {
+        // Update the in-memory index even if we fail to write it
+        parseRecord(record.c_str(),
+                    record.c_str() + record.size(),
+                    s);
+
+        sys::mkpath(io::dirname(filename()));
+
+        // Wait for other writers, isMine() is false if another
+        //   process held the lock and released it
+        io::lock_t lock(occa::hash(filename()), "cache-index");
+        while (!lock.isMine()) {}
+
+        if (!writeRecord(record)) {
+          return;
+        }
+
+        // Pick up our record along with the ones added by other processes
+        reload(s);
+
+        const udim_t supersededRecords = s.fileRecords - s.liveRecords;
+        if ((supersededRecords >= compactionThreshold)
+            && (supersededRecords >= s.liveRecords)) {
+          compact(s);
+        }
+      }
+
+      const std::string& filename() {
+        static std::string filename_;
+        if (filename_.size() == 0) {
+          filename_ = cachePath() + "index";
+        }
+        return filename_;
+      }
+
+      bool isComplete(const std::string &hashDir,
+                      const std::string &filename) {
+        indexState_t &s = state();
+        s.mutex.lock();
+
+        cacheIndexEntry_t *entry = findEntry(s, indexKey(hashDir));
+        const bool complete = (
+          entry
+          && entry->completeFiles.count(filename)
+        );
+
+        s.mutex.unlock();
+        return complete;
+      }
+
+      void markComplete(const std::string &hashDir,
+                        const std::string &filename) {
+        const std::string record = getCompleteRecord(indexKey(hashDir),
+                                                     filename);
+
+        indexState_t &s = state();
+        s.mutex.lock();
+        appendRecord(s, record);
+        s.mutex.unlock();
+      }
+
+      bool getDependencyHashes(const std::string &hashDir,
+                               strHashMap &dependencyHashes) {
+        indexState_t &s = state();
+        s.mutex.lock();
+
+        cacheIndexEntry_t *entry = findEntry(s, indexKey(hashDir));
+        const bool found = (entry && entry->hasDependencies);
+        if (found) {
+          dependencyHashes = entry->dependencyHashes;
+        }
+
+        s.mutex.unlock();
+        return found;
+      }
+
+      void setDependencyHashes(const std::string &hashDir,
+                               const strHashMap &dependencyHashes) {
+        const std::string record = getDependencyRecord(indexKey(hashDir),
+                                                       dependencyHashes);
+
+        indexState_t &s = state();
+        s.mutex.lock();
+        appendRecord(s, record);
+        s.mutex.unlock();
+      }
+
+      void remove(const std::string &hashDir) {
+        const std::string record = getRemoveRecord(indexKey(hashDir));
+
+        indexState_t &s = state();
+        s.mutex.lock();
+        if (findEntry(s, indexKey(hashDir))) {
+          appendRecord(s, record);
+        }
+        s.mutex.unlock();
+      }
+
+      void clear() {
+        indexState_t &s = state();
+        s.mutex.lock();
+        s.reset();
+        s.mutex.unlock();
+      }
+    }
+  }
+}
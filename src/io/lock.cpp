@@ -1,5 +1,6 @@
 #include <cmath>
 #include <errno.h>
+#include <sstream>
 #include <sys/stat.h>
 #include <sys/types.h>
 
@@ -8,8 +9,11 @@
 #include <occa/io/output.hpp>
 #include <occa/io/utils.hpp>
 #include <occa/tools/env.hpp>
+#include <occa/tools/sys.hpp>
 
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <fcntl.h>
+#  include <sys/file.h>
 #  include <unistd.h>
 #else
 #  include <windows.h> // Sleep
@@ -17,16 +21,45 @@
 
 namespace occa {
   namespace io {
+    //---[ fileLock_t ]-----------------
+    // Shared between lock_t copies, the flock is tied to the file descriptor
+    class fileLock_t {
+    public:
+      int fd;
+      int refs;
+
+      fileLock_t(const int fd_) :
+        fd(fd_),
+        refs(1) {}
+
+      void release() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+        if (fd < 0) {
+          return;
+        }
+        // An empty lock file tells waiters the lock was released properly
+        if (::ftruncate(fd, 0)) {}
+        ::flock(fd, LOCK_UN);
+        ::close(fd);
+        fd = -1;
+#endif
+      }
+    };
+    //==================================
+
     lock_t::lock_t() :
       isMineCached(false),
-      released(true) {}
+      released(true),
+      useFileLock(false),
+      fileLock(NULL) {}
 
     lock_t::lock_t(const hash_t &hash,
                    const std::string &tag,
                    const float staleAge_) :
       isMineCached(false),
       staleAge(staleAge_),
-      released(false) {
+      released(false),
+      fileLock(NULL) {
 
       lockDir = env::OCCA_CACHE_DIR;
       lockDir += "locks/";
@@ -41,10 +74,114 @@ namespace occa {
         staleAge = lockSettings.get("stale_age",
                                     (float) 20.0);
       }
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      useFileLock = lockSettings.get("file_locks", true);
+#else
+      useFileLock = false;
+#endif
+    }
+
+    lock_t::lock_t(const lock_t &other) :
+      fileLock(NULL) {
+      *this = other;
+    }
+
+    lock_t& lock_t::operator = (const lock_t &other) {
+      if (this != &other) {
+        lockDir      = other.lockDir;
+        isMineCached = other.isMineCached;
+        staleWarning = other.staleWarning;
+        staleAge     = other.staleAge;
+        released     = other.released;
+        useFileLock  = other.useFileLock;
+        setFileLock(other.fileLock);
+      }
+      return *this;
     }
 
     lock_t::~lock_t() {
-      release();
+      // File locks are released once the last copy is destroyed
+      if (fileLock) {
+        setFileLock(NULL);
+      } else {
+        release();
+      }
+    }
+
+    void lock_t::setFileLock(fileLock_t *fileLock_) const {
+      if (fileLock_ == fileLock) {
+        return;
+      }
+      if (fileLock_) {
+        ++(fileLock_->refs);
+      }
+      if (fileLock && !(--(fileLock->refs))) {
+        fileLock->release();
+        delete fileLock;
+      }
+      fileLock = fileLock_;
+    }
+
+    // Returns:
+    //    1: Lock is ours
+    //    0: Another process held the lock and released it
+    //   -1: Advisory locks are not supported
+    int lock_t::acquireFileLock() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      const std::string lockFilename = filename();
+
+      const int fd = ::open(lockFilename.c_str(), O_RDWR | O_CREAT, 0644);
+      if (fd < 0) {
+        return -1;
+      }
+
+      if (::flock(fd, LOCK_EX | LOCK_NB)) {
+        if (errno != EWOULDBLOCK) {
+          ::close(fd);
+          return -1;
+        }
+
+        // Block until the holder releases the lock or dies
+        int status;
+        do {
+          status = ::flock(fd, LOCK_EX);
+        } while (status && (errno == EINTR));
+
+        if (status) {
+          ::close(fd);
+          return -1;
+        }
+
+        // The holder died if it didn't clear the lock file
+        struct stat buffer;
+        const bool holderDied = (
+          !::fstat(fd, &buffer)
+          && (buffer.st_size > 0)
+        );
+        if (!holderDied) {
+          ::flock(fd, LOCK_UN);
+          ::close(fd);
+          return 0;
+        }
+      }
+
+      // Write our PID so waiters can tell if we die while holding the lock
+      std::stringstream ss;
+      ss << sys::getPID() << '\n';
+      const std::string pid = ss.str();
+      if (::ftruncate(fd, 0)
+          || (::write(fd, pid.c_str(), pid.size()) != (ssize_t) pid.size())) {
+        ::flock(fd, LOCK_UN);
+        ::close(fd);
+        return -1;
+      }
+
+      setFileLock(NULL);
+      fileLock = new fileLock_t(fd);
+      return 1;
+#else
+      return -1;
+#endif
     }
 
     bool lock_t::isInitialized() const {
@@ -55,11 +192,24 @@ namespace occa {
       return lockDir;
     }
 
+    std::string lock_t::filename() const {
+      return lockDir + ".lock";
+    }
+
+    bool lock_t::isFileLock() const {
+      return useFileLock;
+    }
+
     void lock_t::release() const {
-      if (!released) {
+      if (released) {
+        return;
+      }
+      if (fileLock) {
+        fileLock->release();
+      } else if (!useFileLock) {
         sys::rmdir(lockDir);
-        released = true;
       }
+      released = true;
     }
 
     bool lock_t::isMine() {
@@ -68,6 +218,16 @@ namespace occa {
       }
       sys::mkpath(env::OCCA_CACHE_DIR + "locks/");
 
+      if (useFileLock) {
+        const int status = acquireFileLock();
+        if (status >= 0) {
+          isMineCached = (status == 1);
+          return isMineCached;
+        }
+        // Fallback to directory locks
+        useFileLock = false;
+      }
+
       while (true) {
         int mkdirStatus = sys::mkdir(lockDir);
 
@@ -287,7 +287,7 @@ namespace occa {
     }
 
     strVector files(const std::string &dir) {
-      return filesInDir(dir, DT_REG);
+      return filesInDir(endWithSlash(dir), DT_REG);
     }
 
     bool exists(const std::string &filename) {
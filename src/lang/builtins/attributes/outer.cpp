@@ -19,10 +19,11 @@ namespace occa {
       }
 
       bool outer::isValid(const attributeToken_t &attr) const {
-        if (attr.kwargs.size()) {
-          attr.printError("[@outer] does not take kwargs");
-          return false;
-        }
+        return (validArgs(attr)
+                && validKwargs(attr));
+      }
+
+      bool outer::validArgs(const attributeToken_t &attr) const {
         const int argCount = (int) attr.args.size();
         if (argCount > 1) {
           attr.printError("[@outer] takes at most one index");
@@ -46,6 +47,67 @@ namespace occa {
         }
         return true;
       }
+
+      bool outer::validKwargs(const attributeToken_t &attr) const {
+        attributeArgMap::const_iterator it = attr.kwargs.begin();
+        while (it != attr.kwargs.end()) {
+          exprNode *value = it->second.expr;
+          if (it->first == "schedule") {
+            if ((value->type() != exprNodeType::string)
+                || !isValidSchedule(((stringNode*) value)->value)) {
+              value
+                ->startNode()
+                ->printError("[@outer] 'schedule' argument must be"
+                             " \"static\", \"dynamic\", \"guided\", \"auto\", or \"runtime\"");
+              return false;
+            }
+          } else if (it->first == "chunk") {
+            bool error = !value->canEvaluate();
+            if (!error) {
+              primitive chunk = value->evaluate();
+              error = (!chunk.isInteger()
+                       || ((int) chunk <= 0));
+            }
+            if (error) {
+              value
+                ->startNode()
+                ->printError("[@outer] 'chunk' argument must be a positive integer");
+              return false;
+            }
+          } else {
+            value
+              ->startNode()
+              ->printError("[@outer] does not take this kwarg");
+            return false;
+          }
+          ++it;
+        }
+
+        attributeArgMap::const_iterator scheduleIt = attr.kwargs.find("schedule");
+        attributeArgMap::const_iterator chunkIt = attr.kwargs.find("chunk");
+        if ((scheduleIt != attr.kwargs.end())
+            && (chunkIt != attr.kwargs.end())
+            && !scheduleTakesChunk(((stringNode*) scheduleIt->second.expr)->value)) {
+          chunkIt->second.expr
+            ->startNode()
+            ->printError("[@outer] 'chunk' can't be used with the \"auto\" or \"runtime\" schedules");
+          return false;
+        }
+        return true;
+      }
+
+      bool outer::isValidSchedule(const std::string &schedule) {
+        return ((schedule == "static")
+                || (schedule == "dynamic")
+                || (schedule == "guided")
+                || (schedule == "auto")
+                || (schedule == "runtime"));
+      }
+
+      bool outer::scheduleTakesChunk(const std::string &schedule) {
+        return ((schedule != "auto")
+                && (schedule != "runtime"));
+      }
     }
   }
 }
@@ -247,21 +247,25 @@ namespace occa {
           return NULL;
         }
 
-        exprNode *initInParen = initValue->wrapInParentheses();
+        // Increasing: check - init
+        // Decreasing: init - check
+        exprNode *startValue = positiveUpdate ? initValue : checkValue;
+        exprNode *endValue = positiveUpdate ? checkValue : initValue;
+        exprNode *startInParen = startValue->wrapInParentheses();
         exprNode *count = (
           new binaryOpNode(iterator->source,
-                           positiveUpdate ? op::sub : op::add,
-                           *checkValue,
-                           *initInParen)
+                           op::sub,
+                           *endValue,
+                           *startInParen)
         );
-        delete initInParen;
+        delete startInParen;
 
         if (checkIsInclusive) {
           primitiveNode inc(iterator->source, 1);
 
           exprNode *countWithInc = (
             new binaryOpNode(iterator->source,
-                             positiveUpdate ? op::sub : op::add,
+                             op::add,
                              *count,
                              inc)
           );
@@ -274,11 +278,11 @@ namespace occa {
 
           primitiveNode one(iterator->source, 1);
           binaryOpNode boundCheck(iterator->source,
-                                  positiveUpdate ? op::add : op::sub,
+                                  op::add,
                                   *count,
                                   *updateInParen);
           binaryOpNode boundCheck2(iterator->source,
-                                   positiveUpdate ? op::sub : op::add,
+                                   op::sub,
                                    boundCheck,
                                    one);
           exprNode *boundCheckInParen = boundCheck2.wrapInParentheses();
@@ -1,5 +1,9 @@
+#include <sstream>
+
+#include <occa/lang/expr.hpp>
 #include <occa/lang/modes/openmp.hpp>
 #include <occa/lang/transforms/builtins/finders.hpp>
+#include <occa/lang/builtins/attributes/outer.hpp>
 
 namespace occa {
   namespace lang {
@@ -23,40 +27,76 @@ namespace occa {
             outerSmnt.printError("Unable to add [#pragma omp]");
             return;
           }
+
+          std::string pragma = getOuterPragma((forStatement&) outerSmnt);
+          if (!success) {
+            return;
+          }
+
           // Add OpenMP Pragma
           blockStatement &outerBlock  = (blockStatement&) outerSmnt;
           blockStatement &parentBlock = *((blockStatement*) parent);
           pragmaStatement *pragmaSmnt = (
             new pragmaStatement((blockStatement*) parent,
                                 pragmaToken(outerBlock.source->origin,
-                                            "omp parallel for"))
+                                            pragma))
           );
           parentBlock.addBefore(outerSmnt,
                                 *pragmaSmnt);
         }
       }
 
-      void openmpParser::findOuterMostLoops(statementPtrVector &outerMostSmnts) {
-        statementPtrVector outerSmnts;
-        findStatementsByAttr(statementType::for_,
-                             "outer",
-                             root,
-                             outerSmnts);
+      std::string openmpParser::getOuterPragma(forStatement &outerSmnt) {
+        std::stringstream ss;
+        ss << "omp parallel for";
 
-        const int count = (int) outerSmnts.size();
-        for (int i = 0; i < count; ++i) {
-          statement_t *outerSmnt = outerSmnts[i];
-          statement_t *smnt = outerSmnt->up;
-          while (smnt) {
-            if (smnt->hasAttribute("outer")) {
-              break;
-            }
-            smnt = smnt->up;
+        // Collapse perfectly nested @outer loops
+        if (settings.get("openmp/collapse", true)) {
+          statementPtrVector loopSmnts;
+          getCollapsedOuterLoops(outerSmnt, loopSmnts);
+
+          const int loopCount = (int) loopSmnts.size();
+          if (loopCount > 1) {
+            ss << " collapse(" << loopCount << ')';
+          }
+        }
+
+        // @outer kwargs take precedence over the kernel properties
+        std::string schedule = settings.get<std::string>("openmp/schedule");
+        int chunk = settings.get("openmp/chunk", 0);
+
+        attributeToken_t &attr = outerSmnt.attributes["outer"];
+        attributeArgMap::iterator it = attr.kwargs.find("schedule");
+        if (it != attr.kwargs.end()) {
+          schedule = ((stringNode*) it->second.expr)->value;
+        }
+        it = attr.kwargs.find("chunk");
+        if (it != attr.kwargs.end()) {
+          chunk = (int) it->second.expr->evaluate();
+        }
+
+        if (schedule.size()) {
+          if (!attributes::outer::isValidSchedule(schedule)) {
+            success = false;
+            outerSmnt.printError("Unknown OpenMP schedule [" + schedule + "]");
+            return "";
           }
-          if (!smnt) {
-            outerMostSmnts.push_back(outerSmnt);
+          if ((chunk > 0)
+              && !attributes::outer::scheduleTakesChunk(schedule)) {
+            success = false;
+            outerSmnt.printError("OpenMP schedule [" + schedule + "] doesn't take a chunk size");
+            return "";
           }
+          ss << " schedule(" << schedule;
+          if (chunk > 0) {
+            ss << ", " << chunk;
+          }
+          ss << ')';
+        } else if (chunk > 0) {
+          ss << " schedule(static, " << chunk << ')';
         }
+
+        return ss.str();
       }
     }
   }
@@ -1,11 +1,19 @@
+#include <algorithm>
+#include <sstream>
+
 #include <occa/lang/modes/serial.hpp>
 #include <occa/lang/modes/okl.hpp>
 #include <occa/lang/builtins/types.hpp>
+#include <occa/lang/modes/oklForStatement.hpp>
+#include <occa/lang/transforms/builtins/replacer.hpp>
+#include <occa/io/output.hpp>
+#include <occa/tools/env.hpp>
 
 namespace occa {
   namespace lang {
     namespace okl {
       const std::string serialParser::exclusiveIndexName = "_occa_exclusive_index";
+      const std::string serialParser::trampolinePrefix = "_occa_trampoline_";
 
       serialParser::serialParser(const occa::properties &settings_) :
         parser_t(settings_) {
@@ -26,6 +34,14 @@ namespace occa {
 
         if (!success) return;
         setupExclusives();
+
+        if (!success) return;
+        if (settings.get("serial/simd", true)) {
+          setupSimdLoops();
+        }
+
+        if (!success) return;
+        setupKernelTrampolines();
       }
 
       void serialParser::setupHeaders() {
@@ -95,21 +111,194 @@ namespace occa {
         if (qualifiers.has(externCpp)) {
           qualifiers -= externCpp;
         }
-        // Pass non-pointer arguments by reference
+      }
+
+      std::string serialParser::trampolineName(const std::string &kernelName) {
+        return trampolinePrefix + kernelName;
+      }
+
+      void serialParser::setupKernelTrampolines() {
+        statementPtrVector kernelSmnts;
+        findStatementsByAttr(statementType::functionDecl,
+                             "kernel",
+                             root,
+                             kernelSmnts);
+        const int kernels = (int) kernelSmnts.size();
+        for (int i = 0; i < kernels; ++i) {
+          setupKernelTrampoline(*((functionDeclStatement*) kernelSmnts[i]));
+          if (!success) {
+            break;
+          }
+        }
+      }
+
+      void serialParser::setupKernelTrampoline(functionDeclStatement &kernelSmnt) {
+        // Add after the kernel:
+        //   extern "C" void _occa_trampoline_<kernel>(void **args) {
+        //     <kernel>(*((T0*) args[0]), (T1*) args[1], ...);
+        //   }
+        function_t &func = kernelSmnt.function;
+        blockStatement *parent = kernelSmnt.up;
+        if (!parent) {
+          success = false;
+          kernelSmnt.printError("Unable to add kernel trampoline");
+          return;
+        }
+
+        token_t *source = kernelSmnt.source;
+        const fileOrigin &origin = source->origin;
+
+        vartype_t returnType(void_);
+#if OCCA_OS == OCCA_WINDOWS_OS
+        returnType.qualifiers.addFirst(origin,
+                                       dllexport_);
+#endif
+        returnType.qualifiers.addFirst(origin,
+                                       externC);
+
+        identifierToken nameToken(origin,
+                                  trampolineName(func.name()));
+        function_t &trampoline = *(new function_t(returnType,
+                                                  nameToken));
+
+        identifierToken argsSource(origin, "args");
+        variable_t argsVar(vartype_t(void_), &argsSource);
+        argsVar += pointer_t();
+        argsVar += pointer_t();
+        trampoline.addArgument(argsVar);
+
+        functionDeclStatement &trampolineSmnt = (
+          *(new functionDeclStatement(parent, trampoline))
+        );
+        variable_t &trampolineArgsVar = *(trampoline.args[0]);
+
+        // Unpack arguments from the runtime's argument array
+        exprNodeVector callArgs;
         const int argCount = (int) func.args.size();
         for (int i = 0; i < argCount; ++i) {
-          variable_t &arg = *(func.args[i]);
-          vartype_t &type = arg.vartype;
-          if ((type.isPointerType() ||
-               type.referenceToken)) {
+          vartype_t argType = func.args[i]->vartype;
+          if (argType.referenceToken) {
+            delete argType.referenceToken;
+            argType.referenceToken = NULL;
+          }
+          const bool isPointer = argType.isPointerType();
+          if (!isPointer) {
+            argType += pointer_t();
+          }
+
+          variableNode argsNode(source,
+                                trampolineArgsVar);
+          primitiveNode indexNode(source,
+                                  i);
+          subscriptNode argPtrNode(source,
+                                   argsNode,
+                                   indexNode);
+          parenCastNode castNode(source,
+                                 argType,
+                                 argPtrNode);
+          if (isPointer) {
+            callArgs.push_back(castNode.clone());
             continue;
           }
-          operatorToken opToken(arg.source->origin,
-                                op::bitAnd);
-          type.setReferenceToken(&opToken);
+          parenthesesNode parenNode(source,
+                                    castNode);
+          leftUnaryOpNode valueNode(source,
+                                    op::dereference,
+                                    parenNode);
+          callArgs.push_back(valueNode.clone());
+        }
+
+        functionNode kernelNode(source,
+                                func);
+        callNode call(source,
+                      kernelNode,
+                      callArgs);
+        freeExprNodeVector(callArgs);
+
+        trampolineSmnt.add(
+          *(new expressionStatement(&trampolineSmnt,
+                                    *(call.clone())))
+        );
+
+        parent->addAfter(kernelSmnt,
+                         trampolineSmnt);
+        if (!trampolineSmnt.addFunctionToParentScope()) {
+          success = false;
+          kernelSmnt.printError("Unable to add kernel trampoline ["
+                                + trampoline.name() + "]");
         }
       }
 
+      void serialParser::findOuterMostLoops(statementPtrVector &outerMostSmnts) {
+        statementPtrVector outerSmnts;
+        findStatementsByAttr(statementType::for_,
+                             "outer",
+                             root,
+                             outerSmnts);
+
+        const int count = (int) outerSmnts.size();
+        for (int i = 0; i < count; ++i) {
+          statement_t *outerSmnt = outerSmnts[i];
+          statement_t *smnt = outerSmnt->up;
+          while (smnt) {
+            if (smnt->hasAttribute("outer")) {
+              break;
+            }
+            smnt = smnt->up;
+          }
+          if (!smnt) {
+            outerMostSmnts.push_back(outerSmnt);
+          }
+        }
+      }
+
+      void serialParser::getCollapsedOuterLoops(forStatement &outerSmnt,
+                                                statementPtrVector &loopSmnts) {
+        // Collapse perfectly nested @outer loops with bounds
+        //   independent of the loops around them
+        std::vector<variable_t*> iterators;
+        forStatement *smnt = &outerSmnt;
+        while (true) {
+          loopSmnts.push_back(smnt);
+          iterators.push_back(oklForStatement(*smnt, "", false).iterator);
+          if (smnt->children.size() != 1) {
+            break;
+          }
+          statement_t &child = *(smnt->children[0]);
+          if (!(child.type() & statementType::for_)
+              || !child.hasAttribute("outer")) {
+            break;
+          }
+          oklForStatement oklForSmnt(*((forStatement*) &child), "", false);
+          if (!oklForSmnt.isValid()
+              || usesIterators(oklForSmnt.initValue, iterators)
+              || usesIterators(oklForSmnt.checkValue, iterators)
+              || usesIterators(oklForSmnt.updateValue, iterators)) {
+            break;
+          }
+          smnt = (forStatement*) &child;
+        }
+      }
+
+      bool serialParser::usesIterators(exprNode *expr,
+                                       const std::vector<variable_t*> &iterators) {
+        if (!expr) {
+          return false;
+        }
+        exprNodeVector varNodes;
+        findExprNodesByType(exprNodeType::variable,
+                            *expr,
+                            varNodes);
+        const int varCount = (int) varNodes.size();
+        for (int i = 0; i < varCount; ++i) {
+          variable_t *var = &(((variableNode*) varNodes[i])->value);
+          if (std::find(iterators.begin(), iterators.end(), var) != iterators.end()) {
+            return true;
+          }
+        }
+        return false;
+      }
+
       void serialParser::setupExclusives() {
         // Get @exclusive declarations
         statementExprMap exprMap;
@@ -118,6 +307,26 @@ namespace occa {
                        exclusiveVariableMatcher,
                        exprMap);
 
+        fuseExclusiveInnerLoops(exprMap);
+        if (!success) return;
+
+        // Statements could have moved
+        exprMap.clear();
+        findStatements(exprNodeType::variable,
+                       root,
+                       exclusiveVariableMatcher,
+                       exprMap);
+
+        promoteExclusives(exprMap);
+        if (!success) return;
+
+        // Promoted variables are no longer @exclusive
+        exprMap.clear();
+        findStatements(exprNodeType::variable,
+                       root,
+                       exclusiveVariableMatcher,
+                       exprMap);
+
         setupExclusiveDeclarations(exprMap);
         if (!success) return;
         setupExclusiveIndices();
@@ -127,6 +336,431 @@ namespace occa {
                            updateExclusiveExprNodes);
       }
 
+      void serialParser::fuseExclusiveInnerLoops(statementExprMap &exprMap) {
+        // Blocks declaring @exclusive variables
+        statementPtrVector blockSmnts;
+        statementExprMap::iterator it = exprMap.begin();
+        while (it != exprMap.end()) {
+          statement_t *smnt = it->first;
+          ++it;
+          if ((smnt->type() != statementType::declaration)
+              || !exclusiveIsDeclared(*((declarationStatement*) smnt))
+              || !smnt->up) {
+            continue;
+          }
+          if (std::find(blockSmnts.begin(), blockSmnts.end(), smnt->up) == blockSmnts.end()) {
+            blockSmnts.push_back(smnt->up);
+          }
+        }
+
+        // Fuse neighboring @inner loops sharing @exclusive variables
+        //   - Loops separated by a @barrier are never fused since the
+        //     barrier orders every iteration of the first loop before
+        //     the second one
+        const int blockCount = (int) blockSmnts.size();
+        for (int b = 0; b < blockCount; ++b) {
+          blockStatement &blockSmnt = *((blockStatement*) blockSmnts[b]);
+          int i = 0;
+          while (i < (int) blockSmnt.children.size()) {
+            statement_t &smnt = *(blockSmnt.children[i]);
+            if (!(smnt.type() & statementType::for_)
+                || !smnt.hasAttribute("inner")) {
+              ++i;
+              continue;
+            }
+
+            const int next = i + 1;
+            if (next >= (int) blockSmnt.children.size()) {
+              break;
+            }
+
+            statement_t &nextSmnt = *(blockSmnt.children[next]);
+            if (!(nextSmnt.type() & statementType::for_)
+                || !nextSmnt.hasAttribute("inner")
+                || !sharesExclusives(smnt, nextSmnt)
+                || !canFuseInnerLoops((forStatement&) smnt,
+                                      (forStatement&) nextSmnt)) {
+              i = next;
+              continue;
+            }
+
+            fuseInnerLoops((forStatement&) smnt,
+                           (forStatement&) nextSmnt);
+            if (!success) return;
+          }
+        }
+      }
+
+      bool serialParser::canFuseInnerLoops(forStatement &firstSmnt,
+                                           forStatement &secondSmnt) {
+        // Only fuse single @inner loops with the same iterations
+        statementPtrVector innerSmnts;
+        findStatementsByAttr(statementType::for_,
+                             "inner",
+                             firstSmnt,
+                             innerSmnts);
+        findStatementsByAttr(statementType::for_,
+                             "inner",
+                             secondSmnt,
+                             innerSmnts);
+        if (innerSmnts.size() != 2) {
+          return false;
+        }
+
+        oklForStatement firstOklSmnt(firstSmnt, "", false);
+        oklForStatement secondOklSmnt(secondSmnt, "", false);
+        if (!firstOklSmnt.isValid()
+            || !secondOklSmnt.isValid()
+            || (firstOklSmnt.iterator->vartype != secondOklSmnt.iterator->vartype)
+            || (firstOklSmnt.checkIsInclusive != secondOklSmnt.checkIsInclusive)
+            || (firstOklSmnt.positiveUpdate != secondOklSmnt.positiveUpdate)
+            || (firstOklSmnt.initValue->toString() != secondOklSmnt.initValue->toString())
+            || (firstOklSmnt.checkValue->toString() != secondOklSmnt.checkValue->toString())
+            || (!firstOklSmnt.updateValue != !secondOklSmnt.updateValue)
+            || (firstOklSmnt.updateValue
+                && (firstOklSmnt.updateValue->toString()
+                    != secondOklSmnt.updateValue->toString()))) {
+          return false;
+        }
+
+        // Jumps in the first loop would skip the second loop's body
+        statementPtrVector jumpSmnts;
+        findStatementsByType((statementType::continue_ |
+                              statementType::break_    |
+                              statementType::return_   |
+                              statementType::goto_),
+                             firstSmnt,
+                             jumpSmnts);
+        if (jumpSmnts.size()) {
+          return false;
+        }
+
+        // Iterations of the second loop can read what any iteration
+        //   of the first loop wrote, so the first loop can only update
+        //   @exclusive variables and its own non-pointer variables
+        if (!onlyWritesPrivates(firstSmnt, NULL)) {
+          return false;
+        }
+
+        // Iterations of the first loop can also read what earlier
+        //   iterations of the second loop wrote, so the second loop can
+        //   only write to memory the first loop can't see:
+        //   @restrict pointers the first loop never uses
+        return onlyWritesPrivates(secondSmnt, &firstSmnt);
+      }
+
+      bool serialParser::onlyWritesPrivates(forStatement &loopSmnt,
+                                            statement_t *otherSmnt) {
+        std::vector<variable_t*> localVars;
+        statementPtrVector declSmnts;
+        findStatementsByType(statementType::declaration,
+                             loopSmnt,
+                             declSmnts);
+        const int declSmntCount = (int) declSmnts.size();
+        for (int i = 0; i < declSmntCount; ++i) {
+          declarationStatement &declSmnt = *((declarationStatement*) declSmnts[i]);
+          const int declCount = (int) declSmnt.declarations.size();
+          for (int j = 0; j < declCount; ++j) {
+            localVars.push_back(declSmnt.declarations[j].variable);
+          }
+        }
+
+        // @restrict pointers used by the other loop
+        std::vector<variable_t*> otherVars;
+        if (otherSmnt) {
+          statementExprMap otherMap;
+          findStatements(exprNodeType::variable,
+                         *otherSmnt,
+                         restrictArgMatcher,
+                         otherMap);
+          statementExprMap::iterator it = otherMap.begin();
+          while (it != otherMap.end()) {
+            exprNodeVector &nodes = it->second;
+            const int nodeCount = (int) nodes.size();
+            for (int i = 0; i < nodeCount; ++i) {
+              otherVars.push_back(&(((variableNode*) nodes[i])->value));
+            }
+            ++it;
+          }
+        }
+
+        statementExprMap writeMap;
+        findStatements(exprNodeType::op,
+                       loopSmnt,
+                       updatesVariable,
+                       writeMap);
+        statementExprMap::iterator it = writeMap.begin();
+        while (it != writeMap.end()) {
+          exprNodeVector &nodes = it->second;
+          const int nodeCount = (int) nodes.size();
+          for (int i = 0; i < nodeCount; ++i) {
+            variable_t *var = nodes[i]->getVariable();
+            if (!var) {
+              return false;
+            }
+            if (var->hasAttribute("exclusive")
+                && !var->vartype.pointers.size()) {
+              continue;
+            }
+            if (otherSmnt
+                && var->hasAttribute("restrict")
+                && var->vartype.isPointerType()
+                && (std::find(otherVars.begin(), otherVars.end(), var) == otherVars.end())) {
+              continue;
+            }
+            const bool isLocal = (
+              std::find(localVars.begin(), localVars.end(), var) != localVars.end()
+            );
+            if (!isLocal
+                || var->vartype.pointers.size()
+                || var->vartype.isReference()) {
+              return false;
+            }
+          }
+          ++it;
+        }
+
+        // Functions could write through pointer arguments
+        statementExprMap callMap;
+        findStatements(exprNodeType::call,
+                       loopSmnt,
+                       passesPointer,
+                       callMap);
+        return !callMap.size();
+      }
+
+      void serialParser::fuseInnerLoops(forStatement &firstSmnt,
+                                        forStatement &secondSmnt) {
+        // Replace
+        //   for (...; @inner) {A}
+        //   for (...; @inner) {B}
+        // with
+        //   for (...; @inner) {{A} {B}}
+        oklForStatement firstOklSmnt(firstSmnt);
+        oklForStatement secondOklSmnt(secondSmnt);
+        replaceVariables(secondSmnt,
+                         *(secondOklSmnt.iterator),
+                         *(firstOklSmnt.iterator));
+
+        blockStatement &firstBody = *(new blockStatement(&firstSmnt,
+                                                         firstSmnt.source));
+        firstBody.swapChildren(firstSmnt);
+
+        // Keep the second loop's scope with its statements
+        blockStatement &secondBody = *(new blockStatement(&firstSmnt,
+                                                          secondSmnt.source));
+        secondBody.swapScope(secondSmnt);
+        secondBody.swapChildren(secondSmnt);
+
+        firstSmnt.add(firstBody);
+        firstSmnt.add(secondBody);
+
+        secondSmnt.removeFromParent();
+        delete &secondSmnt;
+      }
+
+      bool serialParser::sharesExclusives(statement_t &firstSmnt,
+                                          statement_t &secondSmnt) {
+        statementExprMap firstMap, secondMap;
+        findStatements(exprNodeType::variable,
+                       firstSmnt,
+                       exclusiveVariableMatcher,
+                       firstMap);
+        findStatements(exprNodeType::variable,
+                       secondSmnt,
+                       exclusiveVariableMatcher,
+                       secondMap);
+
+        std::vector<variable_t*> firstVars;
+        statementExprMap::iterator it = firstMap.begin();
+        while (it != firstMap.end()) {
+          exprNodeVector &nodes = it->second;
+          const int nodeCount = (int) nodes.size();
+          for (int i = 0; i < nodeCount; ++i) {
+            firstVars.push_back(nodes[i]->getVariable());
+          }
+          ++it;
+        }
+
+        it = secondMap.begin();
+        while (it != secondMap.end()) {
+          exprNodeVector &nodes = it->second;
+          const int nodeCount = (int) nodes.size();
+          for (int i = 0; i < nodeCount; ++i) {
+            variable_t *var = nodes[i]->getVariable();
+            if (std::find(firstVars.begin(), firstVars.end(), var) != firstVars.end()) {
+              return true;
+            }
+          }
+          ++it;
+        }
+        return false;
+      }
+
+      bool serialParser::updatesVariable(exprNode &expr) {
+        if (!(expr.type() & exprNodeType::op)) {
+          return false;
+        }
+        exprOpNode &opNode = (exprOpNode&) expr;
+        return (opNode.opType() & (operatorType::increment |
+                                   operatorType::decrement |
+                                   operatorType::assignment));
+      }
+
+      bool serialParser::passesPointer(exprNode &expr) {
+        if (!(expr.type() & exprNodeType::call)) {
+          return false;
+        }
+        callNode &call = (callNode&) expr;
+        const int argCount = call.argCount();
+        for (int i = 0; i < argCount; ++i) {
+          exprNodeVector varNodes;
+          findExprNodesByType(exprNodeType::variable,
+                              *(call.args[i]),
+                              varNodes);
+          const int varCount = (int) varNodes.size();
+          for (int j = 0; j < varCount; ++j) {
+            vartype_t &vartype = varNodes[j]->getVariable()->vartype;
+            if (vartype.pointers.size()
+                || vartype.arrays.size()
+                || vartype.isReference()) {
+              return true;
+            }
+          }
+          // &value
+          exprNodeVector addressNodes;
+          findExprNodesByType(exprNodeType::leftUnary,
+                              *(call.args[i]),
+                              addressNodes);
+          const int addressCount = (int) addressNodes.size();
+          for (int j = 0; j < addressCount; ++j) {
+            if (((exprOpNode*) addressNodes[j])->opType() & operatorType::address) {
+              return true;
+            }
+          }
+        }
+        return false;
+      }
+
+      void serialParser::promoteExclusives(statementExprMap &exprMap) {
+        statementPtrVector declSmnts;
+        statementExprMap::iterator it = exprMap.begin();
+        while (it != exprMap.end()) {
+          statement_t *smnt = it->first;
+          if ((smnt->type() == statementType::declaration)
+              && exclusiveIsDeclared(*((declarationStatement*) smnt))) {
+            declSmnts.push_back(smnt);
+          }
+          ++it;
+        }
+
+        // @exclusive variables only used inside one inner-most @inner
+        //   loop are declared as regular variables inside of it
+        const int declSmntCount = (int) declSmnts.size();
+        for (int i = 0; i < declSmntCount; ++i) {
+          declarationStatement &declSmnt = *((declarationStatement*) declSmnts[i]);
+          forStatement *innerSmnt = getPromotedExclusiveLoop(declSmnt, exprMap);
+          if (!innerSmnt) {
+            continue;
+          }
+
+          blockStatement &declBlock = *(declSmnt.up);
+          declSmnt.removeFromParent();
+          innerSmnt->addFirst(declSmnt);
+
+          const int declCount = (int) declSmnt.declarations.size();
+          for (int j = 0; j < declCount; ++j) {
+            variable_t &var = *(declSmnt.declarations[j].variable);
+            var.attributes.erase("exclusive");
+            if (declBlock.hasDirectlyInScope(var.name())) {
+              declBlock.removeFromScope(var.name(), false);
+            }
+            innerSmnt->addToScope(var);
+          }
+        }
+      }
+
+      forStatement* serialParser::getPromotedExclusiveLoop(declarationStatement &declSmnt,
+                                                           statementExprMap &exprMap) {
+        // Every declared variable should be @exclusive
+        std::vector<variable_t*> vars;
+        const int declCount = (int) declSmnt.declarations.size();
+        for (int i = 0; i < declCount; ++i) {
+          variable_t *var = declSmnt.declarations[i].variable;
+          if (!var->hasAttribute("exclusive")) {
+            return NULL;
+          }
+          vars.push_back(var);
+        }
+        if (!declSmnt.up) {
+          return NULL;
+        }
+
+        forStatement *innerSmnt = NULL;
+        statementExprMap::iterator it = exprMap.begin();
+        while (it != exprMap.end()) {
+          statement_t *smnt = it->first;
+          exprNodeVector &nodes = it->second;
+          ++it;
+
+          bool usesVars = false;
+          const int nodeCount = (int) nodes.size();
+          for (int i = 0; i < nodeCount; ++i) {
+            if (std::find(vars.begin(), vars.end(), nodes[i]->getVariable()) != vars.end()) {
+              usesVars = true;
+              break;
+            }
+          }
+          if (!usesVars) {
+            continue;
+          }
+          if (smnt == &declSmnt) {
+            // Initial values are only evaluated once for every @inner iteration
+            continue;
+          }
+
+          // Find the @inner loop using the variable
+          statement_t *up = smnt->up;
+          while (up
+                 && !((up->type() & statementType::for_)
+                      && up->hasAttribute("inner"))) {
+            up = up->up;
+          }
+          if (!up) {
+            return NULL;
+          }
+          if (!innerSmnt) {
+            innerSmnt = (forStatement*) up;
+          } else if (innerSmnt != up) {
+            return NULL;
+          }
+        }
+        if (!innerSmnt) {
+          return NULL;
+        }
+
+        // Make sure it's an inner-most @inner loop inside the declaration's block
+        statementPtrVector innerSmnts;
+        findStatementsByAttr(statementType::for_,
+                             "inner",
+                             *innerSmnt,
+                             innerSmnts);
+        if (innerSmnts.size() != 1) {
+          return NULL;
+        }
+        // Regular loops between the declaration and the @inner loop
+        //   need the value to persist across their iterations
+        statement_t *up = innerSmnt->up;
+        while (up && (up != declSmnt.up)) {
+          if (up->type() & (statementType::for_ |
+                            statementType::while_)) {
+            return NULL;
+          }
+          up = up->up;
+        }
+        return (up ? innerSmnt : NULL);
+      }
+
       void serialParser::setupExclusiveDeclarations(statementExprMap &exprMap) {
         statementExprMap::iterator it = exprMap.begin();
         while (it != exprMap.end()) {
@@ -158,6 +792,9 @@ namespace occa {
           smnt = smnt->up;
         }
 
+        setupExclusiveStorage(declSmnt, *innerMostOuterLoop);
+        if (!success) return;
+
         // Check if index variable exists and is valid
         if (innerMostOuterLoop->hasDirectlyInScope(exclusiveIndexName)) {
           keyword_t &keyword = innerMostOuterLoop->getScopeKeyword(exclusiveIndexName);
@@ -196,6 +833,250 @@ namespace occa {
         return false;
       }
 
+      void serialParser::setupExclusiveStorage(declarationStatement &declSmnt,
+                                               forStatement &outerSmnt) {
+        // Every outer-most @inner loop starts the index at 0
+        transforms::smntTreeNode innerRoot;
+        findStatementTree(statementType::for_,
+                          outerSmnt,
+                          innerLoopMatcher,
+                          innerRoot);
+
+        exprNodeVector counts;
+        bool isConstant = true;
+        int maxCount = 1;
+        const int innerCount = innerRoot.size();
+        for (int i = 0; i < innerCount; ++i) {
+          exprNode *count = getInnerLoopCount(*(innerRoot[i]));
+          if (!count) {
+            success = false;
+            freeExprNodeVector(counts);
+            return;
+          }
+          counts.push_back(count);
+          if (isConstant && count->canEvaluate()) {
+            const int value = (int) count->evaluate();
+            maxCount = (value > maxCount) ? value : maxCount;
+          } else {
+            isConstant = false;
+          }
+        }
+
+        // Scalar initial values are copied to every array entry
+        //   since arrays can't be initialized with a scalar
+        std::string initialValues;
+        const std::string &index = exclusiveIndexName;
+        const std::string maxCountStr = occa::toString(maxCount);
+
+        const int declCount = (int) declSmnt.declarations.size();
+        for (int i = 0; i < declCount; ++i) {
+          variableDeclaration &decl = declSmnt.declarations[i];
+          variable_t &var = *(decl.variable);
+          if (!var.hasAttribute("exclusive")) {
+            continue;
+          }
+
+          if (!isConstant) {
+            setupExclusiveVector(decl, innerRoot, counts);
+            continue;
+          }
+
+          if (decl.value && !var.vartype.arrays.size()) {
+            initialValues += (
+              var.name() + "[" + index + "] = " + decl.value->toString() + ";"
+            );
+            delete decl.value;
+            decl.value = NULL;
+          }
+
+          // Add exclusive array to the beginning
+          operatorToken startToken(var.source->origin,
+                                   op::bracketStart);
+          operatorToken endToken(var.source->origin,
+                                 op::bracketEnd);
+          var.vartype.arrays.insert(
+            var.vartype.arrays.begin(),
+            array_t(startToken,
+                    endToken,
+                    new primitiveNode(var.source,
+                                      maxCount))
+          );
+        }
+        freeExprNodeVector(counts);
+
+        if (initialValues.size()) {
+          declSmnt.up->addAfter(
+            declSmnt,
+            *(new expressionStatement(
+                declSmnt.up,
+                *(new identifierNode(declSmnt.source,
+                                     "for (" + index + " = 0; "
+                                     + index + " < " + maxCountStr + "; "
+                                     + "++" + index + ") { "
+                                     + initialValues + " }"))
+              ))
+          );
+        }
+      }
+
+      void serialParser::setupExclusiveVector(variableDeclaration &decl,
+                                              transforms::smntTreeNode &innerRoot,
+                                              exprNodeVector &counts) {
+        // @inner loop bounds are only known at runtime
+        //   -> std::vector<value> grown before @inner loops using it
+        variable_t &var = *(decl.variable);
+        const fileOrigin &origin = var.source->origin;
+
+        vartype_t valueType = var.vartype;
+        valueType.arrays.clear();
+        printer pout;
+        valueType.printDeclaration(pout, "", true);
+        std::string valueTypeName = pout.str();
+
+        const int arrayCount = (int) var.vartype.arrays.size();
+        for (int i = arrayCount - 1; i >= 0; --i) {
+          array_t &array = var.vartype.arrays[i];
+          if (!array.size) {
+            var.printError("[@exclusive] arrays need a size");
+            success = false;
+            return;
+          }
+          valueTypeName = (
+            "std::array<" + valueTypeName + ", "
+            + array.size->toString() + ">"
+          );
+        }
+        if (arrayCount) {
+          setupArrayHeader();
+        }
+
+        // Types are freed after the variables using them when added to the root
+        const std::string vectorTypeName = "std::vector<" + valueTypeName + " >";
+        type_t *vectorType;
+        if (root.hasDirectlyInScope(vectorTypeName)) {
+          keyword_t &keyword = root.getScopeKeyword(vectorTypeName);
+          vectorType = &(((typeKeyword&) keyword).type_);
+        } else {
+          identifierToken vectorTypeSource(origin, vectorTypeName);
+          vectorType = new typedef_t(vartype_t(), vectorTypeSource);
+          root.addToScope(*vectorType);
+        }
+        var.vartype = vartype_t(*vectorType);
+
+        // New values start with the initial value
+        std::string initialValue;
+        if (decl.value) {
+          initialValue = ", " + decl.value->toString();
+          delete decl.value;
+          decl.value = NULL;
+        }
+
+        // Grow the vector before @inner loops using it
+        const std::string &name = var.name();
+        const int innerCount = innerRoot.size();
+        for (int i = 0; i < innerCount; ++i) {
+          statement_t &innerSmnt = *(innerRoot[i]->smnt);
+          statementExprMap exprMap;
+          findStatements(exprNodeType::variable,
+                         innerSmnt,
+                         exclusiveVariableMatcher,
+                         exprMap);
+
+          bool usesVar = false;
+          statementExprMap::iterator it = exprMap.begin();
+          while (!usesVar && (it != exprMap.end())) {
+            exprNodeVector &nodes = it->second;
+            const int nodeCount = (int) nodes.size();
+            for (int j = 0; j < nodeCount; ++j) {
+              if (nodes[j]->getVariable() == &var) {
+                usesVar = true;
+                break;
+              }
+            }
+            ++it;
+          }
+          if (!usesVar) {
+            continue;
+          }
+
+          const std::string count = counts[i]->toString();
+          innerSmnt.up->addBefore(
+            innerSmnt,
+            *(new expressionStatement(
+                innerSmnt.up,
+                *(new identifierNode(innerSmnt.source,
+                                     "if (" + name + ".size() < (size_t) (" + count + ")) "
+                                     + name + ".resize(" + count + initialValue + ")"))
+              ))
+          );
+        }
+      }
+
+      void serialParser::setupArrayHeader() {
+        const std::string header = "include <array>";
+        const int childCount = (int) root.children.size();
+        for (int i = 0; i < childCount; ++i) {
+          statement_t &smnt = *(root.children[i]);
+          if ((smnt.type() & statementType::directive)
+              && (((directiveStatement&) smnt).token.value == header)) {
+            return;
+          }
+        }
+        directiveToken token(root.source->origin,
+                             header);
+        root.addFirst(
+          *(new directiveStatement(&root, token))
+        );
+      }
+
+      exprNode* serialParser::getInnerLoopCount(transforms::smntTreeNode &innerNode) {
+        // Iterations times the iterations of nested @inner loops
+        forStatement &forSmnt = *((forStatement*) innerNode.smnt);
+        oklForStatement oklForSmnt(forSmnt);
+        if (!oklForSmnt.isValid()) {
+          return NULL;
+        }
+        exprNode *count = oklForSmnt.getIterationCount();
+
+        const int childCount = innerNode.size();
+        if (!childCount) {
+          return count;
+        }
+
+        exprNode *childrenCount = NULL;
+        for (int i = 0; i < childCount; ++i) {
+          exprNode *childCount_ = getInnerLoopCount(*(innerNode[i]));
+          if (!childCount_) {
+            delete count;
+            delete childrenCount;
+            return NULL;
+          }
+          if (!childrenCount) {
+            childrenCount = childCount_;
+            continue;
+          }
+          exprNode *sum = new binaryOpNode(forSmnt.source,
+                                           op::add,
+                                           *childrenCount,
+                                           *childCount_);
+          delete childrenCount;
+          delete childCount_;
+          childrenCount = sum;
+        }
+
+        exprNode *countInParen = count->wrapInParentheses();
+        exprNode *childrenInParen = childrenCount->wrapInParentheses();
+        exprNode *total = new binaryOpNode(forSmnt.source,
+                                           op::mult,
+                                           *countInParen,
+                                           *childrenInParen);
+        delete count;
+        delete childrenCount;
+        delete countInParen;
+        delete childrenInParen;
+        return total;
+      }
+
       void serialParser::setupExclusiveIndices() {
         transforms::smntTreeNode innerRoot;
         findStatementTree(statementType::for_,
@@ -259,6 +1140,10 @@ namespace occa {
         return expr.hasAttribute("exclusive");
       }
 
+      bool serialParser::innerLoopMatcher(statement_t &smnt) {
+        return smnt.hasAttribute("inner");
+      }
+
       bool serialParser::exclusiveInnerLoopMatcher(statement_t &smnt) {
         return (
           smnt.hasAttribute("inner")
@@ -281,6 +1166,203 @@ namespace occa {
         }
       }
 
+      void serialParser::setupSimdLoops() {
+        transforms::smntTreeNode innerRoot;
+        findStatementTree(statementType::for_,
+                          root,
+                          innerLoopMatcher,
+                          innerRoot);
+
+        statementPtrVector innerSmnts;
+        getInnerMostLoops(innerRoot, innerSmnts);
+
+        const bool verbose = settings.get("verbose", false);
+        const int innerCount = (int) innerSmnts.size();
+        for (int i = 0; i < innerCount; ++i) {
+          forStatement &innerSmnt = *((forStatement*) innerSmnts[i]);
+          const fileOrigin &origin = innerSmnt.source->origin;
+
+          std::string location;
+          if (verbose) {
+            std::stringstream ss;
+            ss << (origin.file ? origin.file->filename : "(source)")
+               << ':' << origin.position.line;
+            location = ss.str();
+          }
+
+          std::string reason;
+          if (!canVectorizeInnerLoop(innerSmnt, reason)) {
+            if (verbose) {
+              io::stdout << "Not vectorizing [@inner] loop in ["
+                         << location << "]: " << reason << '\n';
+            }
+            continue;
+          }
+
+          const std::string pragma = getSimdPragma(innerSmnt);
+          innerSmnt.up->addBefore(
+            innerSmnt,
+            *(new pragmaStatement(innerSmnt.up,
+                                  pragmaToken(origin, pragma)))
+          );
+          if (verbose) {
+            io::stdout << "Vectorizing [@inner] loop in ["
+                       << location << "] with [#pragma " << pragma << "]\n";
+          }
+        }
+      }
+
+      bool serialParser::canVectorizeInnerLoop(forStatement &innerSmnt,
+                                               std::string &reason) {
+        // SIMD loops can't be left early
+        statementPtrVector jumpSmnts;
+        findStatementsByType((statementType::break_  |
+                              statementType::return_ |
+                              statementType::goto_),
+                             innerSmnt,
+                             jumpSmnts);
+        if (jumpSmnts.size()) {
+          reason = "Contains a break, return, or goto statement";
+          return false;
+        }
+
+        // Variables declared in the loop are private to each iteration
+        std::vector<variable_t*> localVars;
+        statementPtrVector declSmnts;
+        findStatementsByType(statementType::declaration,
+                             innerSmnt,
+                             declSmnts);
+        const int declSmntCount = (int) declSmnts.size();
+        for (int i = 0; i < declSmntCount; ++i) {
+          declarationStatement &declSmnt = *((declarationStatement*) declSmnts[i]);
+          const int declCount = (int) declSmnt.declarations.size();
+          for (int j = 0; j < declCount; ++j) {
+            localVars.push_back(declSmnt.declarations[j].variable);
+          }
+        }
+
+        // Updating a variable shared between iterations would need a reduction
+        statementExprMap writeMap;
+        findStatements(exprNodeType::op,
+                       innerSmnt,
+                       updatesVariable,
+                       writeMap);
+        statementExprMap::iterator it = writeMap.begin();
+        while (it != writeMap.end()) {
+          exprNodeVector &nodes = it->second;
+          const int nodeCount = (int) nodes.size();
+          for (int i = 0; i < nodeCount; ++i) {
+            exprNode *target = NULL;
+            if (nodes[i]->type() & exprNodeType::binary) {
+              target = ((binaryOpNode*) nodes[i])->leftValue;
+            } else if (nodes[i]->type() & exprNodeType::leftUnary) {
+              target = ((leftUnaryOpNode*) nodes[i])->value;
+            } else if (nodes[i]->type() & exprNodeType::rightUnary) {
+              target = ((rightUnaryOpNode*) nodes[i])->value;
+            }
+            if (!target
+                || !(target->type() & exprNodeType::variable)) {
+              continue;
+            }
+
+            variable_t &var = ((variableNode*) target)->value;
+            const bool isLocal = (
+              std::find(localVars.begin(), localVars.end(), &var) != localVars.end()
+            );
+            if (!isLocal
+                && (var.name() != exclusiveIndexName)) {
+              reason = "Updates [" + var.name() + "] which is shared between iterations";
+              return false;
+            }
+          }
+          ++it;
+        }
+        return true;
+      }
+
+      std::string serialParser::getSimdPragma(forStatement &innerSmnt) {
+        std::stringstream ss;
+        ss << "omp simd";
+
+        // The @exclusive index is incremented once per iteration
+        if (innerSmnt.hasInScope(exclusiveIndexName)) {
+          ss << " linear(" << exclusiveIndexName << ": 1)";
+        }
+
+        strVector argNames;
+        getAlignedArgs(innerSmnt, argNames);
+        const int argCount = (int) argNames.size();
+        if (argCount) {
+          ss << " aligned(";
+          for (int i = 0; i < argCount; ++i) {
+            if (i) {
+              ss << ", ";
+            }
+            ss << argNames[i];
+          }
+          ss << ": " << env::OCCA_MEM_BYTE_ALIGN << ')';
+        }
+
+        return ss.str();
+      }
+
+      void serialParser::getAlignedArgs(forStatement &innerSmnt,
+                                        strVector &argNames) {
+        // Memory offsets can break the allocation alignment so
+        //   aligned arguments need to be requested
+        if (!settings.get("serial/simd_aligned", false)) {
+          return;
+        }
+
+        statement_t *smnt = innerSmnt.up;
+        while (smnt
+               && !(smnt->type() & statementType::functionDecl)) {
+          smnt = smnt->up;
+        }
+        if (!smnt) {
+          return;
+        }
+        function_t &func = ((functionDeclStatement*) smnt)->function;
+
+        // Only list @restrict pointers used in the loop
+        statementExprMap exprMap;
+        findStatements(exprNodeType::variable,
+                       innerSmnt,
+                       restrictArgMatcher,
+                       exprMap);
+
+        const int argCount = (int) func.args.size();
+        for (int i = 0; i < argCount; ++i) {
+          variable_t *arg = func.args[i];
+          if (!arg
+              || !arg->hasAttribute("restrict")
+              || !arg->vartype.isPointerType()) {
+            continue;
+          }
+          bool isUsed = false;
+          statementExprMap::iterator it = exprMap.begin();
+          while (!isUsed && (it != exprMap.end())) {
+            exprNodeVector &nodes = it->second;
+            const int nodeCount = (int) nodes.size();
+            for (int j = 0; j < nodeCount; ++j) {
+              if (&(((variableNode*) nodes[j])->value) == arg) {
+                isUsed = true;
+                break;
+              }
+            }
+            ++it;
+          }
+          if (isUsed) {
+            argNames.push_back(arg->name());
+          }
+        }
+      }
+
+      bool serialParser::restrictArgMatcher(exprNode &expr) {
+        return ((expr.type() & exprNodeType::variable)
+                && expr.hasAttribute("restrict"));
+      }
+
       exprNode* serialParser::updateExclusiveExprNodes(statement_t &smnt,
                                                        exprNode &expr,
                                                        const bool isBeingDeclared) {
@@ -289,19 +1371,8 @@ namespace occa {
           return &expr;
         }
 
+        // Storage is set up with the declaration
         if (isBeingDeclared) {
-          operatorToken startToken(var.source->origin,
-                                   op::bracketStart);
-          operatorToken endToken(var.source->origin,
-                                 op::bracketEnd);
-          // Add exclusive array to the beginning
-          var.vartype.arrays.insert(
-            var.vartype.arrays.begin(),
-            array_t(startToken,
-                    endToken,
-                    new primitiveNode(var.source,
-                                      256))
-          );
           return &expr;
         }
 
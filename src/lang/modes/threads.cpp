@@ -0,0 +1,268 @@
+#include <occa/lang/modes/threads.hpp>
+#include <occa/lang/modes/oklForStatement.hpp>
+#include <occa/lang/builtins/types.hpp>
+
+namespace occa {
+  namespace lang {
+    namespace okl {
+      //---[ Lambda Call ]----------------
+      lambdaCallStatement::lambdaCallStatement(blockStatement *up_,
+                                               token_t *source_,
+                                               const std::string &call_,
+                                               const std::string &args_) :
+        blockStatement(up_, source_),
+        call(call_),
+        args(args_) {}
+
+      lambdaCallStatement::lambdaCallStatement(blockStatement *up_,
+                                               const lambdaCallStatement &other) :
+        blockStatement(up_, other),
+        call(other.call),
+        args(other.args) {}
+
+      statement_t& lambdaCallStatement::clone_(blockStatement *up_) const {
+        return *(new lambdaCallStatement(up_, *this));
+      }
+
+      std::string lambdaCallStatement::statementName() const {
+        return "lambda call";
+      }
+
+      void lambdaCallStatement::print(printer &pout) const {
+        pout.printStartIndentation();
+        pout << call << "[&](" << args << ") {\n";
+        pout.pushInlined(false);
+        pout.addIndentation();
+
+        printChildren(pout);
+
+        pout.removeIndentation();
+        pout.popInlined();
+        pout.printNewline();
+        pout.printIndentation();
+        pout << "});\n";
+      }
+      //==================================
+
+      const std::string threadsParser::outerChunkName = "_occa_outer_chunk";
+      const std::string threadsParser::outerIndexName = "_occa_outer_index";
+
+      threadsParser::threadsParser(const occa::properties &settings_) :
+        serialParser(settings_) {}
+
+      void threadsParser::afterParsing() {
+        serialParser::afterParsing();
+
+        if (!success) return;
+        setupThreadsHeader();
+
+        statementPtrVector outerSmnts;
+        findOuterMostLoops(outerSmnts);
+
+        const int count = (int) outerSmnts.size();
+        for (int i = 0; i < count; ++i) {
+          setupOuterLoop(*((forStatement*) outerSmnts[i]));
+          if (!success) return;
+        }
+      }
+
+      void threadsParser::setupThreadsHeader() {
+        directiveToken token(root.source->origin,
+                             "include <occa/modes/threads/pool.hpp>");
+        root.addFirst(
+          *(new directiveStatement(&root, token))
+        );
+      }
+
+      void threadsParser::setupOuterLoop(forStatement &outerSmnt) {
+        // Replace the collapsed @outer loops with
+        //   occa::threads::outerLoop(N0 * N1, [&](occa::threads::outerChunk_t &chunk) {
+        //     while (occa::threads::outerLoopNext(chunk)) {
+        //       for (int64_t index = chunk.start; index < chunk.end; ++index) {
+        //         { o0 = ...; { o1 = ...; ... } }
+        //       }
+        //     }
+        //   });
+        statement_t *parent = outerSmnt.up;
+        if (!parent
+            || !parent->is<blockStatement>()) {
+          success = false;
+          outerSmnt.printError("Unable to split [@outer] loop into chunks");
+          return;
+        }
+        blockStatement &parentBlock = *((blockStatement*) parent);
+        const int childIndex = outerSmnt.childIndex();
+
+        statementPtrVector loopSmnts;
+        getCollapsedOuterLoops(outerSmnt, loopSmnts);
+
+        // The loops are replaced below so keep our own source token
+        token_t *source = outerSmnt.source->clone();
+        const fileOrigin origin = source->origin;
+        identifierNode outerIndex(source, outerIndexName);
+
+        // Collapsed iteration counts can go past 32-bit integers
+        // Types are freed after the variables using them when added to the root
+        type_t *indexTypePtr;
+        if (root.hasDirectlyInScope("int64_t")) {
+          keyword_t &keyword = root.getScopeKeyword("int64_t");
+          indexTypePtr = &(((typeKeyword&) keyword).type_);
+        } else {
+          identifierToken indexTypeSource(origin, "int64_t");
+          indexTypePtr = new typedef_t(vartype_t(), indexTypeSource);
+          root.addToScope(*indexTypePtr);
+        }
+        type_t &indexType = *indexTypePtr;
+
+        // Get iteration counts
+        const int loopCount = (int) loopSmnts.size();
+        exprNodeVector iterationCounts;
+        for (int i = 0; i < loopCount; ++i) {
+          oklForStatement oklForSmnt(*((forStatement*) loopSmnts[i]));
+          if (!oklForSmnt.isValid()) {
+            success = false;
+            freeExprNodeVector(iterationCounts);
+            delete source;
+            return;
+          }
+          exprNode *count = oklForSmnt.getIterationCount();
+          exprNode *countInParen = count->wrapInParentheses();
+          parenCastNode countCast(source,
+                                  vartype_t(indexType),
+                                  *countInParen);
+          iterationCounts.push_back(countCast.wrapInParentheses());
+          delete countInParen;
+          delete count;
+        }
+
+        // The inner-most collapsed loop moves fastest
+        exprNode *stride = NULL;
+        for (int i = loopCount - 1; i >= 0; --i) {
+          exprNode *loopIndex = (
+            stride
+            ? new binaryOpNode(source, op::div, outerIndex, *stride)
+            : outerIndex.clone()
+          );
+          if (i > 0) {
+            exprNode *loopIndexInParen = loopIndex->wrapInParentheses();
+            delete loopIndex;
+            loopIndex = new binaryOpNode(source,
+                                         op::mod,
+                                         *loopIndexInParen,
+                                         *(iterationCounts[i]));
+            delete loopIndexInParen;
+          }
+
+          replaceOuterLoop(*((forStatement*) loopSmnts[i]),
+                           *loopIndex);
+          delete loopIndex;
+
+          exprNode *newStride = (
+            stride
+            ? new binaryOpNode(source, op::mult, *stride, *(iterationCounts[i]))
+            : iterationCounts[i]->clone()
+          );
+          delete stride;
+          stride = newStride;
+        }
+        // [stride] is now the total iteration count
+        const std::string iterations = stride->toString();
+        delete stride;
+        freeExprNodeVector(iterationCounts);
+
+        // The outer-most loop was replaced by a block
+        statement_t &outerBlock = *(parentBlock.children[childIndex]);
+
+        lambdaCallStatement &loopSmnt = *(new lambdaCallStatement(
+          &parentBlock,
+          source,
+          "occa::threads::outerLoop(" + iterations + ", ",
+          "occa::threads::outerChunk_t &" + outerChunkName
+        ));
+        parentBlock.children[childIndex] = &loopSmnt;
+
+        // while (occa::threads::outerLoopNext(chunk))
+        whileStatement &whileSmnt = *(new whileStatement(&loopSmnt,
+                                                         source));
+        identifierNode nextFunc(source, "occa::threads::outerLoopNext");
+        identifierNode chunkNode(source, outerChunkName);
+        exprNodeVector nextArgs;
+        nextArgs.push_back(&chunkNode);
+        callNode nextCall(source, nextFunc, nextArgs);
+        whileSmnt.setCondition(
+          new expressionStatement(&whileSmnt,
+                                  *(nextCall.clone()),
+                                  false)
+        );
+        loopSmnt.add(whileSmnt);
+
+        // for (int64_t index = chunk.start; index < chunk.end; ++index)
+        forStatement &indexSmnt = *(new forStatement(&whileSmnt,
+                                                     source));
+        identifierToken indexSource(origin, outerIndexName);
+        variable_t &indexVar = *(new variable_t(
+          vartype_t(indexType),
+          &indexSource
+        ));
+
+        identifierNode chunkStart(source, outerChunkName + ".start");
+        identifierNode chunkEnd(source, outerChunkName + ".end");
+
+        declarationStatement &indexDeclSmnt = (
+          *(new declarationStatement(&indexSmnt, source))
+        );
+        indexDeclSmnt.addDeclaration(
+          variableDeclaration(indexVar,
+                              chunkStart.clone())
+        );
+
+        binaryOpNode indexCheck(source,
+                                op::lessThan,
+                                outerIndex,
+                                chunkEnd);
+        leftUnaryOpNode indexUpdate(source,
+                                    op::leftIncrement,
+                                    outerIndex);
+        indexSmnt.setLoopStatements(
+          &indexDeclSmnt,
+          new expressionStatement(&indexSmnt,
+                                  *(indexCheck.clone())),
+          new expressionStatement(&indexSmnt,
+                                  *(indexUpdate.clone()),
+                                  false)
+        );
+        whileSmnt.add(indexSmnt);
+
+        indexSmnt.add(outerBlock);
+        delete source;
+      }
+
+      void threadsParser::replaceOuterLoop(forStatement &forSmnt,
+                                           exprNode &outerIndex) {
+        oklForStatement oklForSmnt(forSmnt);
+
+        // Create iterator declaration
+        variableDeclaration decl;
+        decl.variable = oklForSmnt.iterator;
+        decl.value = oklForSmnt.makeDeclarationValue(outerIndex);
+
+        // Replace for-loops with blocks
+        const int childIndex = forSmnt.childIndex();
+        blockStatement &blockSmnt = *(new blockStatement(forSmnt.up,
+                                                         forSmnt.source));
+        blockSmnt.swap(forSmnt);
+        blockSmnt.up->children[childIndex] = &blockSmnt;
+
+        // Add declaration before block
+        declarationStatement &declSmnt = (
+          *(new declarationStatement(&blockSmnt,
+                                     forSmnt.source))
+        );
+        declSmnt.declarations.push_back(decl);
+
+        blockSmnt.addFirst(declSmnt);
+        delete &forSmnt;
+      }
+    }
+  }
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <occa/tools/string.hpp>
 #include <occa/lang/modes/withLauncher.hpp>
 #include <occa/lang/modes/okl.hpp>
@@ -9,15 +11,54 @@
 namespace occa {
   namespace lang {
     namespace okl {
+      //---[ Shared Accesses ]----------
+      void sharedAccesses_t::add(const sharedAccesses_t &other) {
+        accesses.insert(other.accesses.begin(), other.accesses.end());
+        writes.insert(other.writes.begin(), other.writes.end());
+      }
+
+      void sharedAccesses_t::clear() {
+        accesses.clear();
+        writes.clear();
+      }
+
+      static bool intersects(const std::set<std::string> &a,
+                             const std::set<std::string> &b) {
+        std::set<std::string>::const_iterator ait = a.begin();
+        std::set<std::string>::const_iterator bit = b.begin();
+        while ((ait != a.end()) && (bit != b.end())) {
+          if (*ait < *bit) {
+            ++ait;
+          } else if (*bit < *ait) {
+            ++bit;
+          } else {
+            return true;
+          }
+        }
+        return false;
+      }
+
+      bool sharedAccesses_t::conflictsWith(const sharedAccesses_t &other) const {
+        return (intersects(writes, other.accesses)
+                || intersects(accesses, other.writes));
+      }
+      //================================
+
+      static bool isInStatement(statement_t &smnt,
+                                statement_t &parent) {
+        statement_t *up = smnt.up;
+        while (up && (up != &parent)) {
+          up = up->up;
+        }
+        return (up != NULL);
+      }
+
       withLauncher::withLauncher(const occa::properties &settings_) :
         parser_t(settings_),
-        launcherParser(settings["launcher"]) {
+        launcherParser(settings["launcher"]),
+        memoryType(NULL),
+        kernelType(NULL) {
         launcherParser.settings["okl/validate"] = false;
-
-        identifierToken memoryTypeSource(originSource::builtin,
-                                         "occa::modeMemory_t");
-        memoryType = new typedef_t(vartype_t(),
-                                   memoryTypeSource);
       }
 
       //---[ Public ]-------------------
@@ -40,8 +81,6 @@ namespace occa {
           success = checkKernels(root);
         }
 
-        root.addToScope(*memoryType);
-
         if (!success) return;
         setOKLLoopIndices();
 
@@ -88,6 +127,20 @@ namespace occa {
 
         launcherParser.root.swap(rootClone);
         delete &rootClone;
+
+        // Launcher kernel arguments and their trampolines use these types,
+        //   let the launcher root free them after both
+        identifierToken memoryTypeSource(originSource::builtin,
+                                         "occa::modeMemory_t");
+        memoryType = new typedef_t(vartype_t(),
+                                   memoryTypeSource);
+        launcherParser.root.addToScope(*memoryType);
+
+        identifierToken kernelTypeSource(originSource::builtin,
+                                         "occa::modeKernel_t");
+        kernelType = new typedef_t(vartype_t(),
+                                   kernelTypeSource);
+        launcherParser.root.addToScope(*kernelType);
         launcherParser.setupKernels();
 
         // Remove outer loops
@@ -108,6 +161,12 @@ namespace occa {
           if (!success) return;
         }
 
+        launcherParser.setupKernelTrampolines();
+        if (!launcherParser.success) {
+          success = false;
+          return;
+        }
+
         setupLauncherHeaders();
       }
 
@@ -286,12 +345,6 @@ namespace occa {
       void withLauncher::setupLauncherKernelArgs(functionDeclStatement &kernelSmnt) {
         function_t &func = kernelSmnt.function;
 
-        // Create new types
-        identifierToken kernelTypeSource(kernelSmnt.source->origin,
-                                         "occa::modeKernel_t");
-        type_t &kernelType = *(new typedef_t(vartype_t(),
-                                             kernelTypeSource));
-
         // Convert pointer arguments to modeMemory_t
         int argCount = (int) func.args.size();
         for (int i = 0; i < argCount; ++i) {
@@ -305,15 +358,15 @@ namespace occa {
 
         // Add kernel array as the first argument
         identifierToken kernelVarSource(kernelSmnt.source->origin,
-                                        "*deviceKernel");
-        variable_t &kernelVar = *(new variable_t(kernelType,
+                                        "deviceKernel");
+        variable_t &kernelVar = *(new variable_t(*kernelType,
                                                  &kernelVarSource));
         kernelVar += pointer_t();
+        kernelVar += pointer_t();
 
         func.args.insert(func.args.begin(),
                          &kernelVar);
 
-        kernelSmnt.addToScope(kernelType);
         kernelSmnt.addToScope(kernelVar);
       }
 
@@ -489,7 +542,7 @@ namespace occa {
       }
 
       void withLauncher::setupOccaFors(functionDeclStatement &kernelSmnt) {
-        statementPtrVector outerSmnts, innerSmnts;
+        statementPtrVector outerSmnts, innerSmnts, barrierSmnts;
         findStatementsByAttr(statementType::for_,
                              "outer",
                              kernelSmnt,
@@ -499,20 +552,23 @@ namespace occa {
                              kernelSmnt,
                              innerSmnts);
 
+        // Find where barriers are needed before loops are replaced
+        if (usesBarriers()) {
+          getBarrierInnerLoops(kernelSmnt, barrierSmnts);
+        }
+
         const int outerCount = (int) outerSmnts.size();
         for (int i = 0; i < outerCount; ++i) {
           replaceOccaFor(*((forStatement*) outerSmnts[i]));
         }
 
-        const bool applyBarriers = usesBarriers();
-
         const int innerCount = (int) innerSmnts.size();
         for (int i = 0; i < innerCount; ++i) {
           forStatement &innerSmnt = *((forStatement*) innerSmnts[i]);
-          // TODO 1.1: Only apply barriers when needed in the last inner-loop
-          if (applyBarriers &&
-              isOuterMostInnerLoop(innerSmnt)) {
-            addBarriersAfterInnerLoop(innerSmnt);
+          if (std::find(barrierSmnts.begin(),
+                        barrierSmnts.end(),
+                        &innerSmnt) != barrierSmnts.end()) {
+            addBarrierAfterInnerLoop(innerSmnt);
             if (!success) return;
           }
 
@@ -521,18 +577,219 @@ namespace occa {
         }
       }
 
-      void withLauncher::addBarriersAfterInnerLoop(forStatement &forSmnt) {
+      void withLauncher::getBarrierInnerLoops(functionDeclStatement &kernelSmnt,
+                                              statementPtrVector &barrierSmnts) {
+        // Outer-most @inner loops and @barrier statements in program order
+        statementPtrVector smnts;
+        findStatements(statementType::for_ | statementType::empty,
+                       kernelSmnt,
+                       isInnerLoopOrBarrier,
+                       smnts);
+
+        // Each outer-most @inner loop is a phase that synchronizes
+        //   with the others through @shared memory
+        statementPtrVector phases;
+        std::vector<sharedAccesses_t> phaseAccesses;
+        std::vector<bool> hasBarrier, needsBarrier;
+
+        const int smntCount = (int) smnts.size();
+        for (int i = 0; i < smntCount; ++i) {
+          statement_t &smnt = *(smnts[i]);
+          if (smnt.type() & statementType::empty) {
+            if (phases.size() && !isInInnerLoop(smnt)) {
+              hasBarrier.back() = true;
+            }
+            continue;
+          }
+          if (!isOuterMostInnerLoop((forStatement&) smnt)) {
+            continue;
+          }
+          phases.push_back(&smnt);
+          phaseAccesses.push_back(sharedAccesses_t());
+          getSharedAccesses(smnt, phaseAccesses.back());
+          hasBarrier.push_back(false);
+          needsBarrier.push_back(false);
+        }
+
+        const int phaseCount = (int) phases.size();
+
+        // Fall back to a barrier after every phase using @shared memory
+        //   if we can't follow all accesses
+        if (hasUntrackedSharedAccesses(kernelSmnt)) {
+          for (int i = 0; i < phaseCount; ++i) {
+            if (phaseAccesses[i].accesses.size()) {
+              barrierSmnts.push_back(phases[i]);
+            }
+          }
+          return;
+        }
+
+        // Add a barrier between phases when one writes what the other uses
+        sharedAccesses_t pending;
+        for (int i = 0; i < phaseCount; ++i) {
+          if (i) {
+            if (!hasBarrier[i - 1]
+                && pending.conflictsWith(phaseAccesses[i])) {
+              hasBarrier[i - 1] = needsBarrier[i - 1] = true;
+            }
+            if (hasBarrier[i - 1]) {
+              pending.clear();
+            }
+          }
+          pending.add(phaseAccesses[i]);
+        }
+
+        // Phases inside regular loops also run after the last phase
+        //   of the previous iteration
+        std::vector<std::pair<int, int> > loopRanges;
+        for (int i = 0; i < phaseCount; ++i) {
+          statement_t *smnt = phases[i]->up;
+          while (smnt && (smnt != &kernelSmnt)) {
+            const bool isLoop = (
+              (smnt->type() & (statementType::for_ | statementType::while_))
+              && !smnt->hasAttribute("outer")
+            );
+            if (!isLoop) {
+              smnt = smnt->up;
+              continue;
+            }
+            // Phases in a loop are contiguous, start from the first one
+            if (!i || !isInStatement(*(phases[i - 1]), *smnt)) {
+              int last = i;
+              while (((last + 1) < phaseCount)
+                     && isInStatement(*(phases[last + 1]), *smnt)) {
+                ++last;
+              }
+              loopRanges.push_back(std::pair<int, int>(i, last));
+            }
+            smnt = smnt->up;
+          }
+        }
+
+        // Adding a barrier can change enclosing loops, repeat until stable
+        const int loopCount = (int) loopRanges.size();
+        bool addedBarrier = true;
+        while (addedBarrier) {
+          addedBarrier = false;
+          for (int l = 0; l < loopCount; ++l) {
+            const int first = loopRanges[l].first;
+            const int last = loopRanges[l].second;
+            if (hasBarrier[last]) {
+              continue;
+            }
+            // Accesses before the first barrier and after the last one
+            sharedAccesses_t head, tail;
+            for (int i = first; i <= last; ++i) {
+              head.add(phaseAccesses[i]);
+              if (hasBarrier[i]) {
+                break;
+              }
+            }
+            for (int i = last; i >= first; --i) {
+              if (hasBarrier[i]) {
+                break;
+              }
+              tail.add(phaseAccesses[i]);
+            }
+            if (tail.conflictsWith(head)) {
+              hasBarrier[last] = needsBarrier[last] = true;
+              addedBarrier = true;
+            }
+          }
+        }
+
+        for (int i = 0; i < phaseCount; ++i) {
+          if (needsBarrier[i]) {
+            barrierSmnts.push_back(phases[i]);
+          }
+        }
+      }
+
+      bool withLauncher::hasUntrackedSharedAccesses(functionDeclStatement &kernelSmnt) {
+        // @shared memory used outside of @inner loops
         statementExprMap exprMap;
+        findStatements(exprNodeType::variable,
+                       kernelSmnt,
+                       isSharedVariable,
+                       exprMap);
+
+        statementExprMap::iterator it = exprMap.begin();
+        while (it != exprMap.end()) {
+          if (it->second.size()
+              && !isInInnerLoop(*(it->first))) {
+            return true;
+          }
+          ++it;
+        }
+
+        // @shared pointers that could be aliased
+        statementExprMap pointerMap, subscriptMap, addressMap;
+        findStatements(exprNodeType::variable,
+                       kernelSmnt,
+                       isSharedPointer,
+                       pointerMap);
+        findStatements(exprNodeType::subscript,
+                       kernelSmnt,
+                       isSharedPointerSubscript,
+                       subscriptMap);
+        findStatements(exprNodeType::leftUnary,
+                       kernelSmnt,
+                       takesSharedAddress,
+                       addressMap);
+
+        if (addressMap.size()) {
+          return true;
+        }
+
+        int pointerCount = 0;
+        for (it = pointerMap.begin(); it != pointerMap.end(); ++it) {
+          pointerCount += (int) it->second.size();
+        }
+        int subscriptCount = 0;
+        for (it = subscriptMap.begin(); it != subscriptMap.end(); ++it) {
+          subscriptCount += (int) it->second.size();
+        }
+        return (pointerCount != subscriptCount);
+      }
+
+      void withLauncher::getSharedAccesses(statement_t &smnt,
+                                           sharedAccesses_t &sharedAccesses) {
+        statementExprMap accessMap, writeMap;
+        findStatements(exprNodeType::variable,
+                       smnt,
+                       isSharedVariable,
+                       accessMap);
         findStatements(exprNodeType::op,
-                       forSmnt,
+                       smnt,
                        writesToShared,
-                       exprMap);
+                       writeMap);
+
+        statementExprMap::iterator it = accessMap.begin();
+        while (it != accessMap.end()) {
+          exprNodeVector &nodes = it->second;
+          const int nodeCount = (int) nodes.size();
+          for (int i = 0; i < nodeCount; ++i) {
+            sharedAccesses.accesses.insert(
+              nodes[i]->getVariable()->name()
+            );
+          }
+          ++it;
+        }
 
-        // No need to add barriers
-        if (!exprMap.size()) {
-          return;
+        it = writeMap.begin();
+        while (it != writeMap.end()) {
+          exprNodeVector &nodes = it->second;
+          const int nodeCount = (int) nodes.size();
+          for (int i = 0; i < nodeCount; ++i) {
+            sharedAccesses.writes.insert(
+              nodes[i]->getVariable()->name()
+            );
+          }
+          ++it;
         }
+      }
 
+      void withLauncher::addBarrierAfterInnerLoop(forStatement &forSmnt) {
         statement_t &barrierSmnt = (
           *(new emptyStatement(forSmnt.up,
                                forSmnt.source))
@@ -550,21 +807,72 @@ namespace occa {
                              barrierSmnt);
       }
 
-      bool withLauncher::writesToShared(exprNode &expr) {
-        // TODO 1.1: Propertly check read<-->write or write<-->write ordering
-        // exprOpNode &opNode = (exprOpNode&) expr;
-        // if (!(opNode.opType() & (operatorType::increment |
-        //                          operatorType::decrement |
-        //                          operatorType::assignment))) {
-        //   return false;
-        // }
+      bool withLauncher::isInnerLoopOrBarrier(statement_t &smnt) {
+        if (smnt.type() & statementType::for_) {
+          return smnt.hasAttribute("inner");
+        }
+        return smnt.hasAttribute("barrier");
+      }
 
-        // Get updated variable
+      bool withLauncher::isInInnerLoop(statement_t &smnt) {
+        statement_t *up = smnt.up;
+        while (up) {
+          if ((up->type() & statementType::for_)
+              && up->hasAttribute("inner")) {
+            return true;
+          }
+          up = up->up;
+        }
+        return false;
+      }
+
+      bool withLauncher::isSharedVariable(exprNode &expr) {
         variable_t *var = expr.getVariable();
         return (var &&
                 var->hasAttribute("shared"));
       }
 
+      bool withLauncher::isSharedPointer(exprNode &expr) {
+        variable_t *var = expr.getVariable();
+        return (var &&
+                var->hasAttribute("shared") &&
+                var->vartype.isPointerType());
+      }
+
+      bool withLauncher::isSharedPointerSubscript(exprNode &expr) {
+        // Declared variables are also checked
+        if (!(expr.type() & exprNodeType::subscript)) {
+          return false;
+        }
+        exprNode &value = *(((subscriptNode&) expr).value);
+        return ((value.type() & exprNodeType::variable)
+                && isSharedPointer(value));
+      }
+
+      bool withLauncher::takesSharedAddress(exprNode &expr) {
+        if (!(expr.type() & exprNodeType::leftUnary)) {
+          return false;
+        }
+        exprOpNode &opNode = (exprOpNode&) expr;
+        return ((opNode.opType() & operatorType::address)
+                && isSharedVariable(expr));
+      }
+
+      bool withLauncher::writesToShared(exprNode &expr) {
+        if (!(expr.type() & exprNodeType::op)) {
+          return false;
+        }
+        exprOpNode &opNode = (exprOpNode&) expr;
+        if (!(opNode.opType() & (operatorType::increment |
+                                 operatorType::decrement |
+                                 operatorType::assignment))) {
+          return false;
+        }
+
+        // Get updated variable
+        return isSharedVariable(expr);
+      }
+
       void withLauncher::replaceOccaFor(forStatement &forSmnt) {
         oklForStatement oklForSmnt(forSmnt);
 
@@ -7,6 +7,7 @@
 #include <occa/lang/transforms/builtins.hpp>
 #include <occa/lang/builtins/types.hpp>
 #include <occa/tools/hash.hpp>
+#include <occa/tools/trace.hpp>
 
 namespace occa {
   namespace lang {
@@ -273,12 +274,20 @@ namespace occa {
     }
 
     void parser_t::parseTokens() {
+      const bool tracing = trace::isEnabled();
+      double start = tracing ? trace::now() : 0;
+
       beforeParsing();
       if (!success) return;
 
       loadAllStatements();
       if (!success) return;
 
+      if (tracing) {
+        trace::record(trace::category::build, "parse", start);
+        start = trace::now();
+      }
+
       if (restrictQualifier) {
         success &= transforms::applyRestrictTransforms(root,
                                                        *restrictQualifier);
@@ -292,6 +301,10 @@ namespace occa {
       if (!success) return;
 
       afterParsing();
+
+      if (tracing) {
+        trace::record(trace::category::build, "translate", start);
+      }
     }
     //==================================
 
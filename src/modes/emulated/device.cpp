@@ -0,0 +1,109 @@
+#include <occa/modes/emulated/device.hpp>
+#include <occa/modes/emulated/memory.hpp>
+
+namespace occa {
+  namespace emulated {
+    transferStats_t::transferStats_t() :
+      hostToDeviceBytes(0),
+      deviceToHostBytes(0),
+      deviceToDeviceBytes(0),
+      hostToDeviceTransfers(0),
+      deviceToHostTransfers(0),
+      deviceToDeviceTransfers(0),
+      transferTime(0) {}
+
+    udim_t transferStats_t::bytes() const {
+      return (hostToDeviceBytes
+              + deviceToHostBytes
+              + deviceToDeviceBytes);
+    }
+
+    udim_t transferStats_t::transfers() const {
+      return (hostToDeviceTransfers
+              + deviceToHostTransfers
+              + deviceToDeviceTransfers);
+    }
+
+    device::device(const occa::properties &properties_) :
+      serial::device(properties_) {
+
+      bandwidth = properties.get("bandwidth", 0.0);
+      latency = properties.get("latency", 0.0);
+
+      OCCA_ERROR("[Emulated] Bandwidth must be non-negative",
+                 bandwidth >= 0);
+      OCCA_ERROR("[Emulated] Latency must be non-negative",
+                 latency >= 0);
+
+      properties["bandwidth"] = bandwidth;
+      properties["latency"] = latency;
+    }
+
+    device::~device() {
+      statsMutex.free();
+    }
+
+    bool device::hasSeparateMemorySpace() const {
+      return true;
+    }
+
+    void device::addTransfer(const int type,
+                             const udim_t bytes) {
+      // [bandwidth] is in GB/s and [latency] in microseconds
+      double transferTime = 1e-6 * latency;
+      if (bandwidth > 0) {
+        transferTime += bytes / (1e9 * bandwidth);
+      }
+
+      statsMutex.lock();
+      switch (type) {
+      case transferType::hostToDevice:
+        stats.hostToDeviceBytes += bytes;
+        ++stats.hostToDeviceTransfers;
+        break;
+      case transferType::deviceToHost:
+        stats.deviceToHostBytes += bytes;
+        ++stats.deviceToHostTransfers;
+        break;
+      default:
+        stats.deviceToDeviceBytes += bytes;
+        ++stats.deviceToDeviceTransfers;
+      }
+      stats.transferTime += transferTime;
+      statsMutex.unlock();
+
+      if (transferTime > 0) {
+        const double end = sys::currentTime() + transferTime;
+        while (sys::currentTime() < end) {}
+      }
+    }
+
+    transferStats_t device::getTransferStats() {
+      statsMutex.lock();
+      transferStats_t stats_ = stats;
+      statsMutex.unlock();
+      return stats_;
+    }
+
+    void device::resetTransferStats() {
+      statsMutex.lock();
+      stats = transferStats_t();
+      statsMutex.unlock();
+    }
+
+    //---[ Memory ]-------------------
+    modeMemory_t* device::malloc(const udim_t bytes,
+                                 const void *src,
+                                 const occa::properties &props) {
+      // Device allocations never alias host pointers
+      memory *mem = new memory(this, bytes, props);
+      mem->ptr = (char*) sys::malloc(bytes,
+                                     props.get("alignment", (udim_t) 0));
+      if (src) {
+        mem->copyFrom(src, bytes, 0, props);
+      }
+      return mem;
+    }
+    //================================
+  }
+}
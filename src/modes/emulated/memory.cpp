@@ -0,0 +1,48 @@
+#include <occa/modes/emulated/device.hpp>
+#include <occa/modes/emulated/memory.hpp>
+
+namespace occa {
+  namespace emulated {
+    memory::memory(modeDevice_t *modeDevice_,
+                   udim_t size_,
+                   const occa::properties &properties_) :
+      serial::memory(modeDevice_, size_, properties_) {}
+
+    device& memory::getDevice() const {
+      return *((device*) modeDevice);
+    }
+
+    modeMemory_t* memory::addOffset(const dim_t offset) {
+      memory *m = new memory(modeDevice,
+                             size - offset,
+                             properties);
+      m->ptr = ptr + offset;
+      return m;
+    }
+
+    void memory::copyTo(void *dest,
+                        const udim_t bytes,
+                        const udim_t offset,
+                        const occa::properties &props) const {
+      serial::memory::copyTo(dest, bytes, offset, props);
+      getDevice().addTransfer(transferType::deviceToHost, bytes);
+    }
+
+    void memory::copyFrom(const void *src,
+                          const udim_t bytes,
+                          const udim_t offset,
+                          const occa::properties &props) {
+      serial::memory::copyFrom(src, bytes, offset, props);
+      getDevice().addTransfer(transferType::hostToDevice, bytes);
+    }
+
+    void memory::copyFrom(const modeMemory_t *src,
+                          const udim_t bytes,
+                          const udim_t destOffset,
+                          const udim_t srcOffset,
+                          const occa::properties &props) {
+      serial::memory::copyFrom(src, bytes, destOffset, srcOffset, props);
+      getDevice().addTransfer(transferType::deviceToDevice, bytes);
+    }
+  }
+}
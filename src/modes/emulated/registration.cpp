@@ -0,0 +1,14 @@
+#include <occa/modes/emulated/registration.hpp>
+
+namespace occa {
+  namespace emulated {
+    modeInfo::modeInfo() {}
+
+    bool modeInfo::init() {
+      return true;
+    }
+
+    occa::mode<emulated::modeInfo,
+               emulated::device> mode("Emulated");
+  }
+}
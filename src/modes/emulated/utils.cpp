@@ -0,0 +1,20 @@
+#include <occa/modes/emulated/utils.hpp>
+
+namespace occa {
+  namespace emulated {
+    static device& getEmulatedDevice(occa::device device_) {
+      OCCA_ERROR("Device is not in [Emulated] mode",
+                 device_.isInitialized()
+                 && (device_.mode() == "Emulated"));
+      return *((emulated::device*) device_.getModeDevice());
+    }
+
+    transferStats_t getTransferStats(occa::device device_) {
+      return getEmulatedDevice(device_).getTransferStats();
+    }
+
+    void resetTransferStats(occa::device device_) {
+      getEmulatedDevice(device_).resetTransferStats();
+    }
+  }
+}
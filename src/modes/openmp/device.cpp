@@ -1,13 +1,20 @@
 #include <occa/io/output.hpp>
 #include <occa/lang/modes/openmp.hpp>
 #include <occa/modes/serial/device.hpp>
+#include <occa/modes/serial/memory.hpp>
 #include <occa/modes/openmp/device.hpp>
 #include <occa/modes/openmp/utils.hpp>
+#include <occa/tools/dirtyPages.hpp>
 
 namespace occa {
   namespace openmp {
     device::device(const occa::properties &properties_) :
-      serial::device(properties_) {}
+      serial::device(properties_),
+      numaTopology(getSystemNumaTopology()) {}
+
+    device::~device() {
+      lastCompilerMutex.free();
+    }
 
     hash_t device::kernelHash(const occa::properties &props) const {
       return (
@@ -60,6 +67,8 @@ namespace occa {
         vendor = sys::compilerVendor(compiler);
       }
 
+      // Kernels can be built from multiple threads
+      lastCompilerMutex.lock();
       if (compiler != lastCompiler) {
         lastCompiler = compiler;
         lastCompilerOpenMPFlag = openmp::compilerFlag(vendor, compiler);
@@ -70,9 +79,12 @@ namespace occa {
         }
       }
 
-      const bool usingOpenMP = (lastCompilerOpenMPFlag != openmp::notSupported);
+      const std::string compilerOpenMPFlag = lastCompilerOpenMPFlag;
+      lastCompilerMutex.unlock();
+
+      const bool usingOpenMP = (compilerOpenMPFlag != openmp::notSupported);
       if (usingOpenMP) {
-        allKernelProps["compiler_flags"] += " " + lastCompilerOpenMPFlag;
+        allKernelProps["compiler_flags"] += " " + compilerOpenMPFlag;
       }
 
       modeKernel_t *k = serial::device::buildKernel(filename,
@@ -88,5 +100,39 @@ namespace occa {
 
       return k;
     }
+
+    //---[ Memory ]-------------------
+    modeMemory_t* device::malloc(const udim_t bytes,
+                                 const void *src,
+                                 const occa::properties &props) {
+      const int policy = getNumaPolicy(props);
+      if ((policy == numaPolicy::none)
+          || (src && props.get("use_host_pointer", false))) {
+        return serial::device::malloc(bytes, src, props);
+      }
+
+      const int node = props.get("numa_node", 0);
+      OCCA_ERROR("NUMA node [" << node << "] doesn't exist",
+                 (policy != numaPolicy::bind) || numaTopology.hasNode(node));
+
+      // Policies are applied to whole pages so we can't share them
+      const udim_t pageSize = dirtyPageTracker_t::getPageSize();
+      udim_t alignment = props.get("alignment", (udim_t) 0);
+      if (alignment < pageSize) {
+        alignment = pageSize;
+      }
+
+      serial::memory *mem = new serial::memory(this, bytes, props);
+      mem->ptr = (char*) sys::malloc(pageSize * ((bytes + pageSize - 1) / pageSize),
+                                     alignment);
+
+      if (policy != numaPolicy::firstTouch) {
+        setNumaPolicy(mem->ptr, bytes, policy, node);
+      }
+      parallelFirstTouch(mem->ptr, src, bytes);
+
+      return mem;
+    }
+    //================================
   }
 }
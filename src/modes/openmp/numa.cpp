@@ -0,0 +1,265 @@
+#include <cstring>
+#include <fstream>
+
+#include <occa/defines.hpp>
+
+#if (OCCA_OS & OCCA_LINUX_OS)
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+#if OCCA_OPENMP_ENABLED
+#  include <omp.h>
+#endif
+
+#include <occa/core/device.hpp>
+#include <occa/modes/openmp/device.hpp>
+#include <occa/modes/openmp/numa.hpp>
+#include <occa/tools/dirtyPages.hpp>
+#include <occa/tools/string.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  namespace openmp {
+#if (OCCA_OS & OCCA_LINUX_OS)
+    // From <numaif.h>, which needs libnuma headers
+    static const int MPOL_DEFAULT_    = 0;
+    static const int MPOL_BIND_       = 2;
+    static const int MPOL_INTERLEAVE_ = 3;
+    static const unsigned int MPOL_MF_MOVE_ = (1 << 1);
+    static const unsigned long MPOL_F_NODE_ = (1 << 0);
+    static const unsigned long MPOL_F_ADDR_ = (1 << 1);
+
+    static const int maxNumaNodes = 1024;
+    static const int bitsPerLong  = 8 * sizeof(unsigned long);
+
+    static std::string readSysFile(const std::string &filename) {
+      std::ifstream fs(filename.c_str());
+      std::string content;
+      std::getline(fs, content);
+      return content;
+    }
+
+    // Parses lists like "0-3,8,10-11"
+    static std::vector<int> parseIdList(const std::string &list) {
+      std::vector<int> ids;
+      strVector parts = split(list, ',');
+      const int partCount = (int) parts.size();
+      for (int i = 0; i < partCount; ++i) {
+        const std::string part = strip(parts[i]);
+        if (part.empty()) {
+          continue;
+        }
+        const size_t dash = part.find('-');
+        const int first = (int) occa::atoi(part.substr(0, dash));
+        const int last = ((dash == std::string::npos)
+                          ? first
+                          : (int) occa::atoi(part.substr(dash + 1)));
+        for (int id = first; id <= last; ++id) {
+          ids.push_back(id);
+        }
+      }
+      return ids;
+    }
+
+    // "Node 0 MemTotal:  5209848 kB"
+    static udim_t readNodeMemory(const int id) {
+      std::ifstream fs(("/sys/devices/system/node/node"
+                        + toString(id)
+                        + "/meminfo").c_str());
+      std::string line;
+      while (std::getline(fs, line)) {
+        const size_t pos = line.find("MemTotal:");
+        if (pos != std::string::npos) {
+          return 1024 * occa::atoi(strip(line.substr(pos + 9)));
+        }
+      }
+      return 0;
+    }
+#endif
+
+    //---[ Topology ]-------------------
+    numaNode_t::numaNode_t() :
+      id(0),
+      memoryBytes(0) {}
+
+    numaTopology_t::numaTopology_t() :
+      policiesSupported(false) {}
+
+    int numaTopology_t::nodeCount() const {
+      return (int) nodes.size();
+    }
+
+    bool numaTopology_t::hasNode(const int id) const {
+      const int count = nodeCount();
+      for (int i = 0; i < count; ++i) {
+        if (nodes[i].id == id) {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    int numaTopology_t::getCpuNode(const int cpu) const {
+      const int count = nodeCount();
+      for (int i = 0; i < count; ++i) {
+        const std::vector<int> &cpus = nodes[i].cpus;
+        for (int c = 0; c < (int) cpus.size(); ++c) {
+          if (cpus[c] == cpu) {
+            return nodes[i].id;
+          }
+        }
+      }
+      return -1;
+    }
+
+    static numaTopology_t loadNumaTopology() {
+      numaTopology_t topology;
+
+#if (OCCA_OS & OCCA_LINUX_OS)
+      const std::vector<int> ids = parseIdList(
+        readSysFile("/sys/devices/system/node/online")
+      );
+      const int idCount = (int) ids.size();
+      for (int i = 0; i < idCount; ++i) {
+        numaNode_t node;
+        node.id = ids[i];
+        node.cpus = parseIdList(
+          readSysFile("/sys/devices/system/node/node" + toString(node.id) + "/cpulist")
+        );
+        node.memoryBytes = readNodeMemory(node.id);
+        topology.nodes.push_back(node);
+      }
+
+      int mode;
+      topology.policiesSupported = !syscall(SYS_get_mempolicy,
+                                            &mode, NULL, 0, NULL, 0);
+#endif
+
+      if (topology.nodes.empty()) {
+        numaNode_t node;
+        const int cores = sys::getCoreCount();
+        for (int i = 0; i < cores; ++i) {
+          node.cpus.push_back(i);
+        }
+        node.memoryBytes = sys::installedRAM();
+        topology.nodes.push_back(node);
+      }
+
+      return topology;
+    }
+
+    const numaTopology_t& getSystemNumaTopology() {
+      static numaTopology_t topology = loadNumaTopology();
+      return topology;
+    }
+
+    numaTopology_t getNumaTopology(occa::device device_) {
+      OCCA_ERROR("Device is not in [OpenMP] mode",
+                 device_.isInitialized()
+                 && (device_.mode() == "OpenMP"));
+      return ((openmp::device*) device_.getModeDevice())->numaTopology;
+    }
+    //==================================
+
+    //---[ Placement ]------------------
+    int getNumaPolicy(const occa::properties &props) {
+      const std::string policy = props.get<std::string>("numa", "");
+      if (policy.empty()) {
+        return numaPolicy::none;
+      }
+      if (policy == "first_touch") {
+        return numaPolicy::firstTouch;
+      }
+      if (policy == "interleave") {
+        return numaPolicy::interleave;
+      }
+      if (policy == "bind") {
+        return numaPolicy::bind;
+      }
+      OCCA_FORCE_ERROR("Unknown NUMA policy [" << policy << "],"
+                       << " expected first_touch, interleave or bind");
+      return numaPolicy::none;
+    }
+
+    bool setNumaPolicy(void *ptr,
+                       const udim_t bytes,
+                       const int policy,
+                       const int node) {
+#if (OCCA_OS & OCCA_LINUX_OS)
+      const numaTopology_t &topology = getSystemNumaTopology();
+      OCCA_ERROR("NUMA node [" << node << "] doesn't exist",
+                 (policy != numaPolicy::bind) || topology.hasNode(node));
+      if (!topology.policiesSupported || !bytes) {
+        return false;
+      }
+
+      unsigned long nodeMask[maxNumaNodes / bitsPerLong];
+      ::memset(nodeMask, 0, sizeof(nodeMask));
+
+      int mode = MPOL_DEFAULT_;
+      if (policy == numaPolicy::interleave) {
+        mode = MPOL_INTERLEAVE_;
+        for (int i = 0; i < topology.nodeCount(); ++i) {
+          const int id = topology.nodes[i].id;
+          nodeMask[id / bitsPerLong] |= (1UL << (id % bitsPerLong));
+        }
+      } else if (policy == numaPolicy::bind) {
+        mode = MPOL_BIND_;
+        nodeMask[node / bitsPerLong] |= (1UL << (node % bitsPerLong));
+      }
+
+      // Pages that were already touched are migrated
+      return !syscall(SYS_mbind,
+                      ptr, bytes, mode,
+                      (mode == MPOL_DEFAULT_) ? NULL : nodeMask,
+                      (unsigned long) maxNumaNodes,
+                      MPOL_MF_MOVE_);
+#else
+      return false;
+#endif
+    }
+
+    void parallelFirstTouch(void *ptr,
+                            const void *src,
+                            const udim_t bytes) {
+      const dim_t pageSize = (dim_t) dirtyPageTracker_t::getPageSize();
+      const dim_t pageCount = (dim_t) ((bytes + pageSize - 1) / pageSize);
+      char *cPtr = (char*) ptr;
+      const char *cSrc = (const char*) src;
+
+      // Static schedule gives each thread one contiguous range of pages,
+      //   the same split as a static @outer loop over the buffer
+#if OCCA_OPENMP_ENABLED
+#  pragma omp parallel for schedule(static)
+#endif
+      for (dim_t page = 0; page < pageCount; ++page) {
+        const dim_t offset = page * pageSize;
+        const dim_t pageBytes = (((offset + pageSize) <= (dim_t) bytes)
+                                 ? pageSize
+                                 : ((dim_t) bytes - offset));
+        if (cSrc) {
+          ::memcpy(cPtr + offset, cSrc + offset, pageBytes);
+        } else {
+          ::memset(cPtr + offset, 0, pageBytes);
+        }
+      }
+    }
+
+    int getPtrNumaNode(const void *ptr) {
+#if (OCCA_OS & OCCA_LINUX_OS)
+      int node = -1;
+      if (syscall(SYS_get_mempolicy,
+                  &node, NULL, 0,
+                  const_cast<void*>(ptr),
+                  MPOL_F_NODE_ | MPOL_F_ADDR_)) {
+        return -1;
+      }
+      return node;
+#else
+      return -1;
+#endif
+    }
+    //==================================
+  }
+}
@@ -2,6 +2,7 @@
 #include <occa/tools/env.hpp>
 #include <occa/io.hpp>
 #include <occa/tools/sys.hpp>
+#include <occa/tools/trace.hpp>
 #include <occa/modes/serial/device.hpp>
 #include <occa/modes/serial/kernel.hpp>
 #include <occa/modes/serial/memory.hpp>
@@ -11,8 +12,15 @@
 
 namespace occa {
   namespace serial {
+    sharedBinary_t::sharedBinary_t() :
+      dlHandle(NULL),
+      refs(0),
+      hasMetadata(false) {}
+
     device::device(const occa::properties &properties_) :
-      occa::modeDevice_t(properties_) {
+      occa::modeDevice_t(properties_),
+      asyncStreamCount(0),
+      hasInitialStream(false) {
 
       occa::json &kernelProps = properties["kernel"];
       std::string compiler, compilerFlags, compilerEnvScript;
@@ -86,9 +94,19 @@ namespace occa {
       kernelProps["compiler_env_script"] = compilerEnvScript;
     }
 
-    device::~device() {}
+    device::~device() {
+      sharedBinaryMutex.free();
+      asyncStreamMutex.free();
+    }
 
-    void device::finish() const {}
+    void device::finish() const {
+      stream *s = getAsyncStream(const_cast<device*>(this));
+      if (s) {
+        s->finish();
+      } else {
+        finishAsyncStreams();
+      }
+    }
 
     bool device::hasSeparateMemorySpace() const {
       return false;
@@ -112,14 +130,77 @@ namespace occa {
 
     //---[ Stream ]---------------------
     modeStream_t* device::createStream(const occa::properties &props) {
-      return new stream(this, props);
+      // The initial stream stays synchronous unless asked otherwise
+      const bool isAsync = props.get("async", hasInitialStream);
+      hasInitialStream = true;
+      return new stream(this, props, isAsync);
+    }
+
+    void device::addAsyncStream(stream *s) {
+      asyncStreamMutex.lock();
+      asyncStreams.push_back(s);
+      ++asyncStreamCount;
+      asyncStreamMutex.unlock();
+    }
+
+    void device::removeAsyncStream(stream *s) {
+      asyncStreamMutex.lock();
+      const int count = (int) asyncStreams.size();
+      for (int i = 0; i < count; ++i) {
+        if (asyncStreams[i] == s) {
+          asyncStreams.erase(asyncStreams.begin() + i);
+          --asyncStreamCount;
+          break;
+        }
+      }
+      asyncStreamMutex.unlock();
+    }
+
+    void device::finishAsyncStreams() const {
+      if (!asyncStreamCount) {
+        return;
+      }
+
+      asyncStreamMutex.lock();
+      std::vector<stream*> streams = asyncStreams;
+      asyncStreamMutex.unlock();
+
+      // Finish every stream before reporting the first error
+      std::exception_ptr error;
+      const int count = (int) streams.size();
+      for (int i = 0; i < count; ++i) {
+        try {
+          streams[i]->finish();
+        } catch (...) {
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      }
+      if (error) {
+        std::rethrow_exception(error);
+      }
     }
 
     occa::streamTag device::tagStream() {
-      return new occa::serial::streamTag(this, sys::currentTime());
+      stream *s = getAsyncStream(this);
+      if (!s) {
+        return new occa::serial::streamTag(this, sys::currentTime());
+      }
+      // The tag completes once the work queued before it ran
+      streamEvent_t *event = new streamEvent_t();
+      s->enqueue(new eventTask_t(s, event));
+      return new occa::serial::streamTag(this, event);
     }
 
-    void device::waitFor(occa::streamTag tag) {}
+    void device::waitFor(occa::streamTag tag) {
+      occa::serial::streamTag *srTag = (
+        dynamic_cast<occa::serial::streamTag*>(tag.getModeStreamTag())
+      );
+      if (srTag) {
+        srTag->wait();
+      }
+    }
 
     double device::timeBetween(const occa::streamTag &startTag,
                                const occa::streamTag &endTag) {
@@ -130,11 +211,15 @@ namespace occa {
         dynamic_cast<occa::serial::streamTag*>(endTag.getModeStreamTag())
       );
 
-      return (srEndTag->time - srStartTag->time);
+      return (srEndTag->getTime() - srStartTag->getTime());
     }
     //==================================
 
     //---[ Kernel ]---------------------
+    bool device::hasThreadSafeKernelBuilds() const {
+      return true;
+    }
+
     bool device::parseFile(const std::string &filename,
                            const std::string &outputFile,
                            const occa::properties &kernelProps,
@@ -190,10 +275,7 @@ namespace occa {
       std::string binaryFilename = hashDir + kcBinaryFile;
 
       // Check if binary exists and is finished
-      bool foundBinary = (
-        io::cachedFileIsComplete(hashDir, kcBinaryFile)
-        && io::isFile(binaryFilename)
-      );
+      bool foundBinary = io::cachedFileIsComplete(hashDir, kcBinaryFile);
 
       io::lock_t lock;
       if (!foundBinary) {
@@ -261,6 +343,14 @@ namespace occa {
 
       sys::addSharedBinaryFlags(vendor, compilerFlags);
       sys::addCpp11Flags(vendor, compilerFlags);
+      if (kernelProps.get("serial/simd", true)) {
+        sys::addSimdFlags(vendor, compilerFlags);
+        // Report which loops the compiler was able to vectorize
+        if (verbose) {
+          sys::addCompilerFlags(compilerFlags,
+                                sys::compilerVectorizationReportFlags(vendor));
+        }
+      }
 
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
       command << (std::string) kernelProps["compiler"]
@@ -290,12 +380,21 @@ namespace occa {
         io::stdout << "Compiling [" << kernelName << "]\n" << sCommand << "\n";
       }
 
+      const bool tracing = trace::isEnabled();
+      const double start = tracing ? trace::now() : 0;
+
 #if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
       const int compileError = system(sCommand.c_str());
 #else
       const int compileError = system(("\"" +  sCommand + "\"").c_str());
 #endif
 
+      if (tracing) {
+        occa::json args;
+        args["command"] = sCommand;
+        trace::record(trace::category::build, "compile", start, 0, args);
+      }
+
       lock.release();
       if (compileError) {
         OCCA_FORCE_ERROR("Error compiling [" << kernelName << "],"
@@ -316,13 +415,22 @@ namespace occa {
     modeKernel_t* device::buildKernelFromBinary(const std::string &filename,
                                                 const std::string &kernelName,
                                                 const occa::properties &kernelProps) {
-      std::string buildFile = io::dirname(filename);
-      buildFile += kc::buildFile;
+      // Avoid parsing the build file for every kernel in the binary
+      lang::sourceMetadata_t sourceMetadata;
+      if (!getSharedBinaryMetadata(filename, sourceMetadata)) {
+        std::string buildFile = io::dirname(filename);
+        buildFile += kc::buildFile;
+
+        if (io::isFile(buildFile)) {
+          sourceMetadata = lang::sourceMetadata_t::fromBuildFile(buildFile);
+          setSharedBinaryMetadata(filename, sourceMetadata);
+        }
+      }
 
       lang::kernelMetadata_t metadata;
-      if (io::isFile(buildFile)) {
-        lang::sourceMetadata_t sourceMetadata = lang::sourceMetadata_t::fromBuildFile(buildFile);
-        metadata = sourceMetadata.kernelsMetadata[kernelName];
+      lang::kernelMetadataMap::iterator it = sourceMetadata.kernelsMetadata.find(kernelName);
+      if (it != sourceMetadata.kernelsMetadata.end()) {
+        metadata = it->second;
       }
 
       return buildKernelFromBinary(filename,
@@ -335,19 +443,103 @@ namespace occa {
                                                 const std::string &kernelName,
                                                 const occa::properties &kernelProps,
                                                 lang::kernelMetadata_t &metadata) {
-      kernel &k = *(new kernel(this,
-                               kernelName,
-                               filename,
-                               kernelProps));
+      kernel &k = *(newKernel(kernelName,
+                              filename,
+                              kernelProps));
 
       k.binaryFilename = filename;
       k.metadata = metadata;
 
-      k.dlHandle = sys::dlopen(filename);
+      k.dlHandle = openSharedBinary(filename);
       k.function = sys::dlsym(k.dlHandle, kernelName);
 
+      // Binaries built from OKL export a trampoline taking packed arguments
+      k.trampoline = (trampolinePtr_t) sys::dlsymIfExists(
+        k.dlHandle,
+        lang::okl::serialParser::trampolineName(kernelName)
+      );
+
       return &k;
     }
+
+    kernel* device::newKernel(const std::string &kernelName,
+                              const std::string &filename,
+                              const occa::properties &kernelProps) {
+      return new kernel(this,
+                        kernelName,
+                        filename,
+                        kernelProps);
+    }
+
+    void* device::openSharedBinary(const std::string &filename) {
+      sharedBinaryMutex.lock();
+      sharedBinary_t &binary = sharedBinaries[filename];
+      if (!binary.dlHandle) {
+        const bool tracing = trace::isEnabled();
+        const double start = tracing ? trace::now() : 0;
+        try {
+          binary.dlHandle = sys::dlopen(filename);
+        } catch (...) {
+          sharedBinaries.erase(filename);
+          sharedBinaryMutex.unlock();
+          throw;
+        }
+        if (tracing) {
+          occa::json args;
+          args["binary"] = filename;
+          trace::record(trace::category::build, "dlopen", start, 0, args);
+        }
+      }
+      ++binary.refs;
+      void *dlHandle = binary.dlHandle;
+      sharedBinaryMutex.unlock();
+      return dlHandle;
+    }
+
+    void device::closeSharedBinary(const std::string &filename) {
+      sharedBinaryMutex.lock();
+      sharedBinaryMapIterator it = sharedBinaries.find(filename);
+      if (it != sharedBinaries.end()) {
+        sharedBinary_t &binary = it->second;
+        if (--binary.refs <= 0) {
+          sys::dlclose(binary.dlHandle);
+          sharedBinaries.erase(it);
+        }
+      }
+      sharedBinaryMutex.unlock();
+    }
+
+    int device::sharedBinaryRefs(const std::string &filename) {
+      sharedBinaryMutex.lock();
+      sharedBinaryMapIterator it = sharedBinaries.find(filename);
+      const int refs = (it != sharedBinaries.end()) ? it->second.refs : 0;
+      sharedBinaryMutex.unlock();
+      return refs;
+    }
+
+    bool device::getSharedBinaryMetadata(const std::string &filename,
+                                         lang::sourceMetadata_t &metadata) {
+      sharedBinaryMutex.lock();
+      sharedBinaryMapIterator it = sharedBinaries.find(filename);
+      const bool found = (
+        (it != sharedBinaries.end())
+        && it->second.hasMetadata
+      );
+      if (found) {
+        metadata = it->second.metadata;
+      }
+      sharedBinaryMutex.unlock();
+      return found;
+    }
+
+    void device::setSharedBinaryMetadata(const std::string &filename,
+                                         const lang::sourceMetadata_t &metadata) {
+      sharedBinaryMutex.lock();
+      sharedBinary_t &binary = sharedBinaries[filename];
+      binary.metadata = metadata;
+      binary.hasMetadata = true;
+      sharedBinaryMutex.unlock();
+    }
     //==================================
 
     //---[ Memory ]-------------------
@@ -360,7 +552,8 @@ namespace occa {
         mem->ptr = (char*) const_cast<void*>(src);
         mem->isOrigin = props.get("own_host_pointer", false);
       } else {
-        mem->ptr = (char*) sys::malloc(bytes);
+        mem->ptr = (char*) sys::malloc(bytes,
+                                       props.get("alignment", (udim_t) 0));
         if (src) {
           ::memcpy(mem->ptr, src, bytes);
         }
@@ -1,7 +1,9 @@
 #include <occa/core/base.hpp>
 #include <occa/tools/env.hpp>
 #include <occa/io.hpp>
+#include <occa/modes/serial/device.hpp>
 #include <occa/modes/serial/kernel.hpp>
+#include <occa/modes/serial/stream.hpp>
 #include <occa/lang/modes/serial.hpp>
 
 namespace occa {
@@ -13,11 +15,23 @@ namespace occa {
       occa::modeKernel_t(modeDevice_, name_, sourceFilename_, properties_),
       dlHandle(NULL),
       function(NULL),
+      trampoline(NULL),
       isLauncherKernel(false) {}
 
     kernel::~kernel() {
+      device *dev = dynamic_cast<device*>(modeDevice);
+      if (dev) {
+        // Queued launches could still use the kernel
+        dev->finishAsyncStreams();
+      }
+
       if (dlHandle) {
-        sys::dlclose(dlHandle);
+        // Other kernels could still be using the binary
+        if (dev) {
+          dev->closeSharedBinary(binaryFilename);
+        } else {
+          sys::dlclose(dlHandle);
+        }
         dlHandle = NULL;
       }
     }
@@ -34,11 +48,16 @@ namespace occa {
       return dim(-1,-1,-1);
     }
 
+    int kernel::maxArgs() const {
+      // Only kernels without a trampoline go through sys::runFunction
+      return trampoline ? -1 : OCCA_MAX_ARGS;
+    }
+
     const lang::kernelMetadata_t& kernel::getMetadata() const {
       return metadata;
     }
 
-    void kernel::run() const {
+    void** kernel::getArgumentPointers() const {
       const int args = (int) arguments.size();
       if (!args) {
         vArgs.resize(1);
@@ -50,8 +69,30 @@ namespace occa {
       for (int i = 0; i < args; ++i) {
         vArgs[i] = arguments[i].ptr();
       }
+      return &(vArgs[0]);
+    }
 
-      sys::runFunction(function, args, &(vArgs[0]));
+    void kernel::run() const {
+      stream *s = isLauncherKernel ? NULL : getAsyncStream(modeDevice);
+      if (s) {
+        s->enqueue(new kernelTask_t(this, arguments));
+        return;
+      }
+
+      device *dev = dynamic_cast<device*>(modeDevice);
+      if (dev) {
+        dev->finishAsyncStreams();
+      }
+      launch((int) arguments.size(), getArgumentPointers());
+    }
+
+    void kernel::launch(const int argc,
+                        void **args) const {
+      if (trampoline) {
+        trampoline(args);
+      } else {
+        sys::runFunction(function, argc, args);
+      }
     }
   }
 }
@@ -1,15 +1,46 @@
+#include <occa/modes/serial/device.hpp>
 #include <occa/modes/serial/memory.hpp>
+#include <occa/modes/serial/stream.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/core/device.hpp>
 
 namespace occa {
   namespace serial {
+    // Copies with [async: true] are queued on the current stream when it
+    //   is async, other copies wait for all queued work first
+    static void streamMemcpy(modeDevice_t *modeDevice,
+                             void *dest,
+                             const void *src,
+                             const udim_t bytes,
+                             const occa::properties &props) {
+      device *dev = dynamic_cast<device*>(modeDevice);
+      if (dev) {
+        stream *s = (props.get("async", false)
+                     ? getAsyncStream(dev)
+                     : NULL);
+        if (s) {
+          s->enqueue(new memcpyTask_t(dest, src, bytes));
+          return;
+        }
+        dev->finishAsyncStreams();
+      }
+      ::memcpy(dest, src, bytes);
+    }
+
     memory::memory(modeDevice_t *modeDevice_,
                    udim_t size_,
                    const occa::properties &properties_) :
       occa::modeMemory_t(modeDevice_, size_, properties_) {}
 
     memory::~memory() {
+      // Queued work could still use the memory, including pooled
+      //   slices whose block is handed to the next allocation
+      if (ptr && (isOrigin || poolBlock)) {
+        device *dev = dynamic_cast<device*>(modeDevice);
+        if (dev) {
+          dev->finishAsyncStreams();
+        }
+      }
       if (ptr && isOrigin) {
         sys::free(ptr);
       }
@@ -42,7 +73,7 @@ namespace occa {
                         const occa::properties &props) const {
       const void *srcPtr = ptr + offset;
 
-      ::memcpy(dest, srcPtr, bytes);
+      streamMemcpy(modeDevice, dest, srcPtr, bytes, props);
     }
 
     void memory::copyFrom(const void *src,
@@ -53,7 +84,7 @@ namespace occa {
       void *destPtr      = ptr + offset;
       const void *srcPtr = src;
 
-      ::memcpy(destPtr, srcPtr, bytes);
+      streamMemcpy(modeDevice, destPtr, srcPtr, bytes, props);
     }
 
     void memory::copyFrom(const modeMemory_t *src,
@@ -65,7 +96,7 @@ namespace occa {
       void *destPtr      = ptr + destOffset;
       const void *srcPtr = src->ptr + srcOffset;
 
-      ::memcpy(destPtr, srcPtr, bytes);
+      streamMemcpy(modeDevice, destPtr, srcPtr, bytes, props);
     }
 
     void memory::detach() {
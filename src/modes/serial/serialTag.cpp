@@ -1,5 +1,6 @@
 #include <occa/defines.hpp>
 
+#include <occa/modes/serial/stream.hpp>
 #include <occa/modes/serial/streamTag.hpp>
 
 namespace occa {
@@ -7,8 +8,34 @@ namespace occa {
     streamTag::streamTag(modeDevice_t *modeDevice_,
                          double time_) :
       modeStreamTag_t(modeDevice_),
-      time(time_) {}
+      time(time_),
+      event(NULL) {}
 
-    streamTag::~streamTag() {}
+    streamTag::streamTag(modeDevice_t *modeDevice_,
+                         streamEvent_t *event_) :
+      modeStreamTag_t(modeDevice_),
+      time(0),
+      event(event_) {}
+
+    streamTag::~streamTag() {
+      if (event) {
+        event->removeRef();
+      }
+    }
+
+    void streamTag::wait() {
+      if (event) {
+        time = event->wait();
+        std::exception_ptr error = event->getError();
+        if (error) {
+          std::rethrow_exception(error);
+        }
+      }
+    }
+
+    double streamTag::getTime() {
+      wait();
+      return time;
+    }
   }
 }
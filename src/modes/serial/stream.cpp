@@ -1,11 +1,284 @@
+#include <cstring>
+
+#include <occa/core/device.hpp>
+#include <occa/modes/serial/device.hpp>
+#include <occa/modes/serial/kernel.hpp>
 #include <occa/modes/serial/stream.hpp>
 
 namespace occa {
   namespace serial {
+    //---[ Events ]---------------------
+    streamEvent_t::streamEvent_t() :
+      refs(1),
+      done(false),
+      time(0) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_init(&condition, NULL);
+#endif
+    }
+
+    streamEvent_t::~streamEvent_t() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_destroy(&condition);
+#endif
+      mutex.free();
+    }
+
+    void streamEvent_t::addRef() {
+      mutex.lock();
+      ++refs;
+      mutex.unlock();
+    }
+
+    void streamEvent_t::removeRef() {
+      mutex.lock();
+      const bool isLastRef = !(--refs);
+      mutex.unlock();
+      if (isLastRef) {
+        delete this;
+      }
+    }
+
+    void streamEvent_t::complete(const std::exception_ptr &error_) {
+      mutex.lock();
+      time = sys::currentTime();
+      error = error_;
+      done = true;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_broadcast(&condition);
+#endif
+      mutex.unlock();
+    }
+
+    bool streamEvent_t::isDone() {
+      mutex.lock();
+      const bool isDone_ = done;
+      mutex.unlock();
+      return isDone_;
+    }
+
+    double streamEvent_t::wait() {
+      mutex.lock();
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      while (!done) {
+        pthread_cond_wait(&condition, &(mutex.mutexHandle));
+      }
+#endif
+      const double time_ = time;
+      mutex.unlock();
+      return time_;
+    }
+
+    std::exception_ptr streamEvent_t::getError() {
+      mutex.lock();
+      std::exception_ptr error_ = error;
+      mutex.unlock();
+      return error_;
+    }
+    //==================================
+
+    //---[ Tasks ]----------------------
+    streamTask_t::~streamTask_t() {}
+
+    kernelTask_t::kernelTask_t(const serial::kernel *kernel_,
+                               const kArgVector &arguments_) :
+      kernel(kernel_),
+      arguments(arguments_) {
+      const int argc = (int) arguments.size();
+      args.resize(argc ? argc : 1);
+      for (int i = 0; i < argc; ++i) {
+        args[i] = arguments[i].ptr();
+      }
+    }
+
+    void kernelTask_t::run() {
+      kernel->launch((int) arguments.size(), &(args[0]));
+    }
+
+    memcpyTask_t::memcpyTask_t(void *dest_,
+                               const void *src_,
+                               const udim_t bytes_) :
+      dest(dest_),
+      src(src_),
+      bytes(bytes_) {}
+
+    void memcpyTask_t::run() {
+      ::memcpy(dest, src, bytes);
+    }
+
+    eventTask_t::eventTask_t(stream *owner_,
+                             streamEvent_t *event_) :
+      owner(owner_),
+      event(event_) {
+      event->addRef();
+    }
+
+    eventTask_t::~eventTask_t() {
+      event->removeRef();
+    }
+
+    void eventTask_t::run() {
+      event->complete(owner->getError());
+    }
+    //==================================
+
+    //---[ Stream ]---------------------
     stream::stream(modeDevice_t *modeDevice_,
-                   const occa::properties &properties_) :
-      modeStream_t(modeDevice_, properties_) {}
+                   const occa::properties &properties_,
+                   const bool isAsync_) :
+      modeStream_t(modeDevice_, properties_),
+      isAsync(isAsync_),
+      hasThread(false),
+      stopping(false) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_init(&taskCondition, NULL);
+      pthread_cond_init(&doneCondition, NULL);
+#else
+      // Host streams need pthreads to run asynchronously
+      isAsync = false;
+#endif
+      if (isAsync) {
+        ((serial::device*) modeDevice)->addAsyncStream(this);
+      }
+    }
+
+    stream::~stream() {
+      if (isAsync) {
+        ((serial::device*) modeDevice)->removeAsyncStream(this);
+      }
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      if (hasThread) {
+        // Queued work still runs before the worker exits
+        mutex.lock();
+        stopping = true;
+        pthread_cond_signal(&taskCondition);
+        mutex.unlock();
+
+        pthread_join(thread, NULL);
+      }
+      pthread_cond_destroy(&taskCondition);
+      pthread_cond_destroy(&doneCondition);
+#endif
+      mutex.free();
+    }
+
+    void stream::startThread() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_create(&thread, NULL, workerMain, this);
+      hasThread = true;
+#endif
+    }
+
+    void* stream::workerMain(void *streamPtr) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      stream &s = *((stream*) streamPtr);
+
+      s.mutex.lock();
+      while (true) {
+        while (s.tasks.empty() && !s.stopping) {
+          pthread_cond_wait(&s.taskCondition, &(s.mutex.mutexHandle));
+        }
+        if (s.tasks.empty()) {
+          break;
+        }
+
+        // The task stays queued while it runs so finish() waits for it
+        streamTask_t *task = s.tasks.front();
+        s.mutex.unlock();
+
+        // Exceptions can't leave the worker, report them on finish()
+        try {
+          task->run();
+        } catch (...) {
+          s.mutex.lock();
+          if (!s.error) {
+            s.error = std::current_exception();
+          }
+          s.mutex.unlock();
+        }
+        delete task;
+
+        s.mutex.lock();
+        s.tasks.pop_front();
+        if (s.tasks.empty()) {
+          pthread_cond_broadcast(&s.doneCondition);
+        }
+      }
+      s.mutex.unlock();
+#endif
+      return NULL;
+    }
+
+    void stream::enqueue(streamTask_t *task) {
+      if (!isAsync) {
+        task->run();
+        delete task;
+        return;
+      }
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      mutex.lock();
+      if (!hasThread) {
+        startThread();
+      }
+      tasks.push_back(task);
+      pthread_cond_signal(&taskCondition);
+      mutex.unlock();
+#endif
+    }
+
+    void stream::finish() {
+      // Tasks can't wait on their own stream
+      if (!isAsync || isWorkerThread()) {
+        return;
+      }
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      mutex.lock();
+      while (!tasks.empty()) {
+        pthread_cond_wait(&doneCondition, &(mutex.mutexHandle));
+      }
+      std::exception_ptr error_ = error;
+      error = std::exception_ptr();
+      mutex.unlock();
+
+      if (error_) {
+        std::rethrow_exception(error_);
+      }
+#endif
+    }
+
+    bool stream::isFinished() {
+      mutex.lock();
+      const bool isFinished_ = tasks.empty();
+      mutex.unlock();
+      return isFinished_;
+    }
+
+    std::exception_ptr stream::getError() {
+      mutex.lock();
+      std::exception_ptr error_ = error;
+      mutex.unlock();
+      return error_;
+    }
+
+    bool stream::isWorkerThread() const {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      return (hasThread
+              && pthread_equal(thread, pthread_self()));
+#else
+      return false;
+#endif
+    }
 
-    stream::~stream() {}
+    stream* getAsyncStream(modeDevice_t *modeDevice) {
+      modeStream_t *modeStream = modeDevice->currentStream.getModeStream();
+      if (!modeStream) {
+        return NULL;
+      }
+      stream *s = (stream*) modeStream;
+      return s->isAsync ? s : NULL;
+    }
+    //==================================
   }
 }
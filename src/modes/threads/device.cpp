@@ -0,0 +1,80 @@
+#include <occa/io/output.hpp>
+#include <occa/lang/modes/threads.hpp>
+#include <occa/modes/threads/device.hpp>
+#include <occa/modes/threads/kernel.hpp>
+
+namespace occa {
+  namespace threads {
+    device::device(const occa::properties &properties_) :
+      serial::device(properties_) {
+
+      const int threadCount = properties.get("threads",
+                                             sys::getCoreCount());
+      const int chunkSize = properties.get("chunk_size", 0);
+      const bool pinned = properties.get("pinned", false);
+
+      OCCA_ERROR("[Threads] Thread count must be positive",
+                 threadCount > 0);
+      OCCA_ERROR("[Threads] Chunk size must be non-negative",
+                 chunkSize >= 0);
+
+      pool = new pool_t(threadCount, chunkSize, pinned);
+
+      // Report the pool that was actually created
+      properties["threads"] = pool->threadCount;
+      properties["chunk_size"] = chunkSize;
+      properties["pinned"] = pinned;
+    }
+
+    device::~device() {
+      delete pool;
+    }
+
+    hash_t device::kernelHash(const occa::properties &props) const {
+      // [Threads] kernels are generated differently from [Serial] ones
+      //   and link against the pool's outer-loop runtime, so the tag
+      //   changes whenever that runtime's interface does
+      return (
+        serial::device::kernelHash(props)
+        ^ occa::hash("threads:outerLoop")
+      );
+    }
+
+    bool device::parseFile(const std::string &filename,
+                           const std::string &outputFile,
+                           const occa::properties &kernelProps,
+                           lang::sourceMetadata_t &metadata) {
+      lang::okl::threadsParser parser(kernelProps);
+      parser.parseFile(filename);
+
+      // Verify if parsing succeeded
+      if (!parser.succeeded()) {
+        if (!kernelProps.get("silent", false)) {
+          OCCA_FORCE_ERROR("Unable to transform OKL kernel");
+        }
+        return false;
+      }
+
+      if (!io::isFile(outputFile)) {
+        hash_t hash = occa::hash(outputFile);
+        io::lock_t lock(hash, "threads-parser");
+        if (lock.isMine()) {
+          parser.writeToFile(outputFile);
+        }
+      }
+
+      parser.setSourceMetadata(metadata);
+
+      return true;
+    }
+
+    serial::kernel* device::newKernel(const std::string &kernelName,
+                                      const std::string &filename,
+                                      const occa::properties &kernelProps) {
+      return new kernel(this,
+                        kernelName,
+                        filename,
+                        kernelProps);
+    }
+  }
+}
@@ -0,0 +1,23 @@
+#include <occa/modes/threads/device.hpp>
+#include <occa/modes/threads/kernel.hpp>
+
+namespace occa {
+  namespace threads {
+    kernel::kernel(modeDevice_t *modeDevice_,
+                   const std::string &name_,
+                   const std::string &sourceFilename_,
+                   const occa::properties &properties_) :
+      serial::kernel(modeDevice_, name_, sourceFilename_, properties_) {}
+
+    void kernel::launch(const int argc,
+                        void **args) const {
+      // Non-OKL kernels have no outer loops to share
+      if (!trampoline || isLauncherKernel) {
+        serial::kernel::launch(argc, args);
+        return;
+      }
+      device &dev = *((device*) modeDevice);
+      dev.pool->run(trampoline, args);
+    }
+  }
+}
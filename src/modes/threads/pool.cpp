@@ -0,0 +1,304 @@
+#include <occa/modes/threads/pool.hpp>
+#include <occa/tools/tls.hpp>
+
+namespace occa {
+  namespace threads {
+    static poolMember_t*& currentMember() {
+      static tls<poolMember_t*> member_;
+      return member_.value();
+    }
+
+    //---[ Outer Loops ]----------------
+    outerChunk_t::outerChunk_t() :
+      start(0),
+      end(0),
+      chunkSize(0),
+      remaining(0),
+      member(NULL) {}
+
+    void runOuterLoop(const int64_t iterations,
+                      outerLoopFunction_t func,
+                      void *loop) {
+      poolMember_t *member = currentMember();
+
+      // Kernels run outside of a pool get all iterations at once
+      if (!member || member->pool->inOuterLoop) {
+        outerChunk_t chunk;
+        chunk.remaining = (iterations > 0) ? iterations : 0;
+        func(chunk, loop);
+        return;
+      }
+      member->pool->runOuterLoop(iterations, func, loop);
+    }
+
+    bool outerLoopNext(outerChunk_t &chunk) {
+      poolMember_t *member = chunk.member;
+      if (!member) {
+        chunk.start = 0;
+        chunk.end = chunk.remaining;
+        chunk.remaining = 0;
+        return (chunk.start < chunk.end);
+      }
+
+      if (member->takeChunk(chunk.chunkSize, chunk.start, chunk.end)) {
+        return true;
+      }
+
+      // Steal half of another member's remaining iterations
+      pool_t &pool = *(member->pool);
+      const int threadCount = pool.threadCount;
+      for (int i = 1; i < threadCount; ++i) {
+        poolMember_t &victim = *(pool.members[(member->id + i) % threadCount]);
+        int64_t stolenStart, stolenEnd;
+        if (!victim.stealHalf(stolenStart, stolenEnd)) {
+          continue;
+        }
+        // Keep the stolen range visible to other thieves
+        member->setRange(stolenStart, stolenEnd);
+        if (member->takeChunk(chunk.chunkSize, chunk.start, chunk.end)) {
+          return true;
+        }
+      }
+      return false;
+    }
+    //==================================
+
+    //---[ Pool ]-----------------------
+    poolMember_t::poolMember_t(pool_t *pool_,
+                               const int id_) :
+      pool(pool_),
+      id(id_),
+      start(0),
+      end(0) {}
+
+    poolMember_t::~poolMember_t() {
+      rangeMutex.free();
+    }
+
+    void poolMember_t::setRange(const int64_t start_,
+                                const int64_t end_) {
+      rangeMutex.lock();
+      start = start_;
+      end = end_;
+      rangeMutex.unlock();
+    }
+
+    bool poolMember_t::takeChunk(const int64_t chunkSize,
+                                 int64_t &chunkStart,
+                                 int64_t &chunkEnd) {
+      rangeMutex.lock();
+      const bool hasWork = (start < end);
+      if (hasWork) {
+        chunkStart = start;
+        chunkEnd = ((end - start) > chunkSize) ? (start + chunkSize) : end;
+        start = chunkEnd;
+      }
+      rangeMutex.unlock();
+      return hasWork;
+    }
+
+    bool poolMember_t::stealHalf(int64_t &stolenStart,
+                                 int64_t &stolenEnd) {
+      rangeMutex.lock();
+      const int64_t remaining = end - start;
+      const bool hasWork = (remaining > 0);
+      if (hasWork) {
+        // The owner works from the front, thieves take from the back
+        stolenEnd = end;
+        stolenStart = end - ((remaining + 1) / 2);
+        end = stolenStart;
+      }
+      rangeMutex.unlock();
+      return hasWork;
+    }
+
+    pool_t::pool_t(const int threadCount_,
+                   const int chunkSize_,
+                   const bool pinned_) :
+      threadCount(threadCount_ > 0 ? threadCount_ : 1),
+      chunkSize(chunkSize_ > 0 ? chunkSize_ : 0),
+      pinned(pinned_),
+      inOuterLoop(false),
+      taskGeneration(0),
+      task(NULL),
+      taskLoop(NULL),
+      taskChunkSize(0),
+      activeMembers(0),
+      stopping(false) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_init(&taskCondition, NULL);
+      pthread_cond_init(&doneCondition, NULL);
+#else
+      // Workers are only supported with pthreads
+      threadCount = 1;
+#endif
+
+      for (int i = 0; i < threadCount; ++i) {
+        members.push_back(new poolMember_t(this, i));
+      }
+      startThreads();
+    }
+
+    pool_t::~pool_t() {
+      stopThreads();
+
+      const int memberCount = (int) members.size();
+      for (int i = 0; i < memberCount; ++i) {
+        delete members[i];
+      }
+      members.clear();
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      pthread_cond_destroy(&taskCondition);
+      pthread_cond_destroy(&doneCondition);
+#endif
+      runMutex.free();
+      mutex.free();
+    }
+
+    void pool_t::startThreads() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      // Member 0 is the thread launching the kernel
+      for (int i = 1; i < threadCount; ++i) {
+        poolMember_t &member = *(members[i]);
+        if (pthread_create(&member.thread, NULL, workerMain, &member)) {
+          // Run with the workers we were able to create
+          for (int j = i; j < threadCount; ++j) {
+            delete members[j];
+          }
+          members.resize(i);
+          threadCount = i;
+          break;
+        }
+      }
+#endif
+    }
+
+    void pool_t::stopThreads() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      mutex.lock();
+      stopping = true;
+      pthread_cond_broadcast(&taskCondition);
+      mutex.unlock();
+
+      for (int i = 1; i < threadCount; ++i) {
+        pthread_join(members[i]->thread, NULL);
+      }
+#endif
+    }
+
+    void* pool_t::workerMain(void *memberPtr) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      poolMember_t &member = *((poolMember_t*) memberPtr);
+      pool_t &pool = *(member.pool);
+
+      if (pool.pinned) {
+        sys::pinToCore(member.id % sys::getCoreCount());
+      }
+      currentMember() = &member;
+
+      int generation = 0;
+      while (true) {
+        pool.mutex.lock();
+        while (!pool.stopping
+               && (generation == pool.taskGeneration)) {
+          pthread_cond_wait(&pool.taskCondition, &(pool.mutex.mutexHandle));
+        }
+        if (pool.stopping) {
+          pool.mutex.unlock();
+          break;
+        }
+        generation = pool.taskGeneration;
+        outerLoopFunction_t task_ = pool.task;
+        void *loop = pool.taskLoop;
+        const int64_t chunkSize_ = pool.taskChunkSize;
+        pool.mutex.unlock();
+
+        pool.runChunks(member, task_, loop, chunkSize_);
+
+        pool.mutex.lock();
+        if (--pool.activeMembers == 0) {
+          pthread_cond_signal(&pool.doneCondition);
+        }
+        pool.mutex.unlock();
+      }
+#endif
+      return NULL;
+    }
+
+    int64_t pool_t::getChunkSize(const int64_t iterations) const {
+      if (chunkSize) {
+        return chunkSize;
+      }
+      // Split each member's share into a few chunks to leave work to steal
+      const int64_t autoChunkSize = iterations / (4 * threadCount);
+      return (autoChunkSize > 0) ? autoChunkSize : 1;
+    }
+
+    void pool_t::run(taskFunction_t task_,
+                     void **args) {
+      runMutex.lock();
+
+      // Code outside of @outer loops runs once, on the launching thread
+      poolMember_t *&current = currentMember();
+      poolMember_t *previous = current;
+      current = members[0];
+      task_(args);
+      current = previous;
+
+      runMutex.unlock();
+    }
+
+    void pool_t::runOuterLoop(const int64_t iterations,
+                              outerLoopFunction_t task_,
+                              void *loop) {
+      const int64_t chunkSize_ = getChunkSize(iterations);
+
+      // Start with an even share of the iterations
+      const int64_t totalIterations = (iterations > 0) ? iterations : 0;
+      for (int i = 0; i < threadCount; ++i) {
+        members[i]->setRange((totalIterations * i) / threadCount,
+                             (totalIterations * (i + 1)) / threadCount);
+      }
+
+      inOuterLoop = true;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      if (threadCount > 1) {
+        mutex.lock();
+        task = task_;
+        taskLoop = loop;
+        taskChunkSize = chunkSize_;
+        activeMembers = threadCount - 1;
+        ++taskGeneration;
+        pthread_cond_broadcast(&taskCondition);
+        mutex.unlock();
+      }
+#endif
+
+      runChunks(*(members[0]), task_, loop, chunkSize_);
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      // Later code can use results from any iteration
+      if (threadCount > 1) {
+        mutex.lock();
+        while (activeMembers) {
+          pthread_cond_wait(&doneCondition, &(mutex.mutexHandle));
+        }
+        mutex.unlock();
+      }
+#endif
+      inOuterLoop = false;
+    }
+
+    void pool_t::runChunks(poolMember_t &member,
+                           outerLoopFunction_t task_,
+                           void *loop,
+                           const int64_t chunkSize_) {
+      outerChunk_t chunk;
+      chunk.member = &member;
+      chunk.chunkSize = chunkSize_;
+      task_(chunk, loop);
+    }
+    //==================================
+  }
+}
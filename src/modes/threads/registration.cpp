@@ -0,0 +1,18 @@
+#include <occa/modes/threads/registration.hpp>
+
+namespace occa {
+  namespace threads {
+    modeInfo::modeInfo() {}
+
+    bool modeInfo::init() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      return true;
+#else
+      return false;
+#endif
+    }
+
+    occa::mode<threads::modeInfo,
+               threads::device> mode("Threads");
+  }
+}
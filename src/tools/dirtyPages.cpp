@@ -0,0 +1,502 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include <occa/defines.hpp>
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <fcntl.h>
+#  include <signal.h>
+#  include <stdint.h>
+#  include <stdlib.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+#include <occa/core/memory.hpp>
+#include <occa/tools/dirtyPages.hpp>
+#include <occa/tools/misc.hpp>
+#include <occa/tools/sys.hpp>
+
+namespace occa {
+  //---[ Stats ]------------------------
+  static std::atomic<udim_t> faultCount(0);
+  static std::atomic<udim_t> partialSyncCount(0);
+  static std::atomic<udim_t> fullSyncCount(0);
+  static std::atomic<udim_t> pagesSyncedCount(0);
+  static std::atomic<udim_t> bytesSyncedCount(0);
+  static std::atomic<udim_t> bytesSkippedCount(0);
+
+  dirtyPageStats_t::dirtyPageStats_t() :
+    faults(0),
+    partialSyncs(0),
+    fullSyncs(0),
+    pagesSynced(0),
+    bytesSynced(0),
+    bytesSkipped(0) {}
+
+  dirtyPageStats_t getDirtyPageStats() {
+    dirtyPageStats_t stats;
+    stats.faults       = faultCount;
+    stats.partialSyncs = partialSyncCount;
+    stats.fullSyncs    = fullSyncCount;
+    stats.pagesSynced  = pagesSyncedCount;
+    stats.bytesSynced  = bytesSyncedCount;
+    stats.bytesSkipped = bytesSkippedCount;
+    return stats;
+  }
+
+  void resetDirtyPageStats() {
+    faultCount        = 0;
+    partialSyncCount  = 0;
+    fullSyncCount     = 0;
+    pagesSyncedCount  = 0;
+    bytesSyncedCount  = 0;
+    bytesSkippedCount = 0;
+  }
+  //====================================
+
+  //---[ Registry ]---------------------
+  // Trackers are published in a fixed-size table the fault handler
+  //   reads without locks, the mutex only serializes updates
+  static const int maxTrackers = 4096;
+  static std::atomic<dirtyPageTracker_t*> trackerTable[maxTrackers];
+  // Slots at or past [trackerSlots] were never used
+  static std::atomic<int> trackerSlots(0);
+
+  static occa::mutex& getTrackerMutex() {
+    static occa::mutex trackerMutex;
+    return trackerMutex;
+  }
+
+  // Returns -1 if the table is full
+  static int registerTracker(dirtyPageTracker_t *tracker) {
+    occa::mutex &trackerMutex = getTrackerMutex();
+    trackerMutex.lock();
+    int slot = -1;
+    for (int i = 0; i < maxTrackers; ++i) {
+      if (!trackerTable[i].load()) {
+        slot = i;
+        break;
+      }
+    }
+    if (slot >= 0) {
+      trackerTable[slot].store(tracker);
+      if (slot >= trackerSlots.load()) {
+        trackerSlots.store(slot + 1);
+      }
+    }
+    trackerMutex.unlock();
+    return slot;
+  }
+
+  static void unregisterTracker(const int slot) {
+    if (slot < 0) {
+      return;
+    }
+    occa::mutex &trackerMutex = getTrackerMutex();
+    trackerMutex.lock();
+    trackerTable[slot].store(NULL);
+    trackerMutex.unlock();
+  }
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+  static struct sigaction previousSegvAction;
+  static struct sigaction previousBusAction;
+
+  // Only uses atomic loads so it's safe to call from the signal handler
+  //   - Trackers stop tracking before they are unregistered, so
+  //     faults on their pages can't come in after they're destroyed
+  static bool handleTrackedFault(void *addr) {
+    const int slots = trackerSlots.load();
+    for (int i = 0; i < slots; ++i) {
+      dirtyPageTracker_t *tracker = trackerTable[i].load();
+      if (tracker && tracker->handleFault(addr)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static void forwardSignal(const int sig,
+                            siginfo_t *info,
+                            void *context,
+                            struct sigaction &previous) {
+    if (previous.sa_flags & SA_SIGINFO) {
+      previous.sa_sigaction(sig, info, context);
+      return;
+    }
+    if ((previous.sa_handler == SIG_DFL)
+        || (previous.sa_handler == SIG_IGN)) {
+      // Restore the previous action and let the fault happen again
+      sigaction(sig, &previous, NULL);
+      return;
+    }
+    previous.sa_handler(sig);
+  }
+
+  static void dirtyPageFaultHandler(int sig,
+                                    siginfo_t *info,
+                                    void *context) {
+    if (handleTrackedFault(info->si_addr)) {
+      return;
+    }
+    forwardSignal(sig, info, context,
+                  (sig == SIGSEGV) ? previousSegvAction : previousBusAction);
+  }
+
+  static void installFaultHandler() {
+    static bool installed = false;
+    if (installed) {
+      return;
+    }
+    installed = true;
+
+    struct sigaction action;
+    ::memset(&action, 0, sizeof(action));
+    action.sa_sigaction = dirtyPageFaultHandler;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+
+    sigaction(SIGSEGV, &action, &previousSegvAction);
+    // macOS reports write-protection faults as SIGBUS
+    sigaction(SIGBUS, &action, &previousBusAction);
+  }
+#endif
+
+#if (OCCA_OS & OCCA_LINUX_OS)
+  static void clearSoftDirtyBits() {
+    const int fd = ::open("/proc/self/clear_refs", O_WRONLY);
+    if (fd < 0) {
+      return;
+    }
+    // "4" only clears the soft-dirty bits
+    ignoreResult( ::write(fd, "4", 1) );
+    ::close(fd);
+  }
+
+  static bool readPagemapBits(const void *ptr,
+                              const udim_t pageSize,
+                              const udim_t pageCount,
+                              std::vector<char> &dirty) {
+    const int fd = ::open("/proc/self/pagemap", O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+
+    std::vector<uint64_t> entries(pageCount, 0);
+    const off_t offset = (off_t) (sizeof(uint64_t)
+                                  * (((uintptr_t) ptr) / pageSize));
+    const ssize_t entryBytes = (ssize_t) (sizeof(uint64_t) * pageCount);
+    const bool success = (::pread(fd, &(entries[0]), entryBytes, offset)
+                          == entryBytes);
+    ::close(fd);
+
+    if (success) {
+      for (udim_t i = 0; i < pageCount; ++i) {
+        // Bit 55 is the soft-dirty bit
+        if ((entries[i] >> 55) & 1) {
+          dirty[i] = 1;
+        }
+      }
+    }
+    return success;
+  }
+
+  static bool softDirtyIsSupported() {
+    const udim_t pageSize = dirtyPageTracker_t::getPageSize();
+    void *ptr = NULL;
+    if (posix_memalign(&ptr, pageSize, pageSize)) {
+      return false;
+    }
+    volatile char *page = (volatile char*) ptr;
+    page[0] = 1;
+
+    // The bit needs to be cleared and then set again by a write
+    std::vector<char> clearedBit(1, 0), writtenBit(1, 0);
+    clearSoftDirtyBits();
+    bool supported = readPagemapBits(ptr, pageSize, 1, clearedBit);
+    page[0] = 2;
+    supported = (supported
+                 && readPagemapBits(ptr, pageSize, 1, writtenBit)
+                 && !clearedBit[0]
+                 && writtenBit[0]);
+
+    ::free(ptr);
+    return supported;
+  }
+#endif
+  //====================================
+
+  //---[ Tracker ]----------------------
+  dirtyPageTracker_t::dirtyPageTracker_t(void *ptr,
+                                         const udim_t bytes_,
+                                         const int method_) :
+    start((char*) ptr),
+    bytes(bytes_),
+    pageSize(getPageSize()),
+    pageCount((bytes_ + pageSize - 1) / pageSize),
+    method(method_),
+    tracking(false),
+    dirty(pageCount, 0),
+    slot(-1) {
+
+    OCCA_ERROR("Dirty page tracking method is not supported",
+               isSupported(method));
+    OCCA_ERROR("Tracked memory must be page-aligned",
+               (((udim_t) start) % pageSize) == 0);
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    if (method == dirtyPageMethod::writeFaults) {
+      occa::mutex &trackerMutex = getTrackerMutex();
+      trackerMutex.lock();
+      installFaultHandler();
+      trackerMutex.unlock();
+    }
+    // Untracked buffers fall back to full syncs if the table is full
+    slot = registerTracker(this);
+#endif
+  }
+
+  dirtyPageTracker_t::~dirtyPageTracker_t() {
+    stopTracking();
+    unregisterTracker(slot);
+  }
+
+  bool dirtyPageTracker_t::isSupported(const int method_) {
+#if (OCCA_OS & OCCA_LINUX_OS)
+    if (method_ == dirtyPageMethod::softDirty) {
+      // Requires a kernel built with CONFIG_MEM_SOFT_DIRTY
+      static const bool supported = softDirtyIsSupported();
+      return supported;
+    }
+#endif
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    return (method_ == dirtyPageMethod::writeFaults);
+#else
+    return false;
+#endif
+  }
+
+  udim_t dirtyPageTracker_t::getPageSize() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    static const udim_t pageSize = (udim_t) ::sysconf(_SC_PAGESIZE);
+    return pageSize;
+#else
+    return 4096;
+#endif
+  }
+
+  udim_t dirtyPageTracker_t::getTrackedBytes(const udim_t bytes_) {
+    const udim_t pageSize_ = getPageSize();
+    return pageSize_ * ((bytes_ + pageSize_ - 1) / pageSize_);
+  }
+
+  void* dirtyPageTracker_t::malloc(const udim_t bytes_) {
+    void *ptr = NULL;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    ignoreResult( posix_memalign(&ptr, getPageSize(), getTrackedBytes(bytes_)) );
+#endif
+    return ptr;
+  }
+
+  void dirtyPageTracker_t::startTracking() {
+    startTracking(dirtyPageTrackerVector(1, this));
+  }
+
+  void dirtyPageTracker_t::startTracking(const dirtyPageTrackerVector &trackers) {
+    const int trackerCount = (int) trackers.size();
+    bool hasSoftDirty = false;
+    for (int i = 0; i < trackerCount; ++i) {
+      dirtyPageTracker_t &tracker = *(trackers[i]);
+      if (tracker.slot < 0) {
+        continue;
+      }
+      if (tracker.method == dirtyPageMethod::softDirty) {
+        hasSoftDirty = true;
+        continue;
+      }
+      ::memset(&(tracker.dirty[0]), 0, tracker.pageCount);
+      // Faults can come in as soon as pages are protected
+      tracker.tracking = true;
+      tracker.protect();
+    }
+#if (OCCA_OS & OCCA_LINUX_OS)
+    if (!hasSoftDirty) {
+      return;
+    }
+    occa::mutex &trackerMutex = getTrackerMutex();
+    trackerMutex.lock();
+
+    // Clearing is process-wide and writes to other buffers could land
+    //   between reading their bits and the clear, so they go back to
+    //   full syncs instead of missing those pages
+    const int slots = trackerSlots.load();
+    for (int i = 0; i < slots; ++i) {
+      dirtyPageTracker_t *tracker = trackerTable[i].load();
+      if (tracker
+          && tracker->tracking
+          && (tracker->method == dirtyPageMethod::softDirty)
+          && (std::find(trackers.begin(), trackers.end(), tracker) == trackers.end())) {
+        tracker->tracking = false;
+      }
+    }
+    clearSoftDirtyBits();
+
+    for (int i = 0; i < trackerCount; ++i) {
+      dirtyPageTracker_t &tracker = *(trackers[i]);
+      if ((tracker.slot >= 0)
+          && (tracker.method == dirtyPageMethod::softDirty)) {
+        ::memset(&(tracker.dirty[0]), 0, tracker.pageCount);
+        tracker.tracking = true;
+      }
+    }
+    trackerMutex.unlock();
+#endif
+  }
+
+  void dirtyPageTracker_t::stopTracking() {
+    if (!tracking) {
+      return;
+    }
+    if (method == dirtyPageMethod::writeFaults) {
+      unprotect();
+    }
+    tracking = false;
+  }
+
+  bool dirtyPageTracker_t::isDirty(const udim_t page) {
+    readSoftDirtyBits();
+    return ((page < pageCount) && dirty[page]);
+  }
+
+  udim_t dirtyPageTracker_t::dirtyPageCount() {
+    readSoftDirtyBits();
+    udim_t count = 0;
+    for (udim_t i = 0; i < pageCount; ++i) {
+      count += (dirty[i] != 0);
+    }
+    return count;
+  }
+
+  void dirtyPageTracker_t::getDirtyRanges(std::vector<udim_t> &offsets,
+                                          std::vector<udim_t> &rangeBytes) {
+    readSoftDirtyBits();
+
+    udim_t page = 0;
+    while (page < pageCount) {
+      if (!dirty[page]) {
+        ++page;
+        continue;
+      }
+      const udim_t rangeStart = page;
+      while ((page < pageCount) && dirty[page]) {
+        ++page;
+      }
+      const udim_t offset = rangeStart * pageSize;
+      const udim_t end = ((page * pageSize) < bytes) ? (page * pageSize) : bytes;
+      offsets.push_back(offset);
+      rangeBytes.push_back(end - offset);
+    }
+  }
+
+  bool dirtyPageTracker_t::handleFault(void *addr) {
+    char *c = (char*) addr;
+    if (!tracking
+        || (method != dirtyPageMethod::writeFaults)
+        || (c < start)
+        || (c >= (start + (pageCount * pageSize)))) {
+      return false;
+    }
+    const udim_t page = (c - start) / pageSize;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    ::mprotect(start + (page * pageSize), pageSize, PROT_READ | PROT_WRITE);
+#endif
+    dirty[page] = 1;
+    ++faultCount;
+    return true;
+  }
+
+  void dirtyPageTracker_t::protect() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    ::mprotect(start, pageCount * pageSize, PROT_READ);
+#endif
+  }
+
+  void dirtyPageTracker_t::unprotect() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    ::mprotect(start, pageCount * pageSize, PROT_READ | PROT_WRITE);
+#endif
+  }
+
+  void dirtyPageTracker_t::readSoftDirtyBits() {
+#if (OCCA_OS & OCCA_LINUX_OS)
+    if (tracking && (method == dirtyPageMethod::softDirty)) {
+      readPagemapBits(start, pageSize, pageCount, dirty);
+    }
+#endif
+  }
+  //====================================
+
+  //---[ UVA Syncs ]--------------------
+  int getDirtyPageMethod(const occa::properties &props) {
+    if (!props.get("dirty_pages", false)) {
+      return dirtyPageMethod::none;
+    }
+
+    const std::string methodName = props.get<std::string>("dirty_page_method",
+                                                          "soft_dirty");
+    OCCA_ERROR("Unknown [dirty_page_method] [" << methodName << "],"
+               << " expected [write_faults] or [soft_dirty]",
+               (methodName == "write_faults") || (methodName == "soft_dirty"));
+
+    int method = ((methodName == "soft_dirty")
+                  ? dirtyPageMethod::softDirty
+                  : dirtyPageMethod::writeFaults);
+    if (!dirtyPageTracker_t::isSupported(method)) {
+      method = dirtyPageMethod::writeFaults;
+    }
+    if (!dirtyPageTracker_t::isSupported(method)) {
+      method = dirtyPageMethod::none;
+    }
+    return method;
+  }
+
+  void copyDirtyPagesToDevice(modeMemory_t *mem,
+                              dirtyPageTrackerVector &syncedPages) {
+    dirtyPageTracker_t *pages = mem->dirtyPages;
+
+    if (!pages || !pages->isTracking()) {
+      mem->copyFrom(mem->uvaPtr, mem->size);
+      ++fullSyncCount;
+      bytesSyncedCount += mem->size;
+      // The device now matches the host
+      if (pages) {
+        syncedPages.push_back(pages);
+      }
+      return;
+    }
+
+    std::vector<udim_t> offsets, rangeBytes;
+    pages->getDirtyRanges(offsets, rangeBytes);
+
+    udim_t syncedBytes = 0;
+    udim_t syncedPageCount = 0;
+    const int rangeCount = (int) offsets.size();
+    for (int i = 0; i < rangeCount; ++i) {
+      mem->copyFrom(mem->uvaPtr + offsets[i],
+                    rangeBytes[i],
+                    offsets[i]);
+      syncedBytes += rangeBytes[i];
+      syncedPageCount += (rangeBytes[i] + pages->pageSize - 1) / pages->pageSize;
+    }
+
+    ++partialSyncCount;
+    pagesSyncedCount  += syncedPageCount;
+    bytesSyncedCount  += syncedBytes;
+    bytesSkippedCount += (mem->size - syncedBytes);
+
+    syncedPages.push_back(pages);
+  }
+  //====================================
+}
@@ -5,6 +5,7 @@
 #include <occa/tools/env.hpp>
 #include <occa/tools/sys.hpp>
 #include <occa/tools/tls.hpp>
+#include <occa/tools/trace.hpp>
 
 namespace occa {
   properties& settings() {
@@ -66,6 +67,12 @@ namespace occa {
         settings_["kernel/verbose"] = true;
         settings_["memory/verbose"] = true;
       }
+
+      if (env::get<bool>("OCCA_TRACE", false)) {
+        const std::string traceFile = env::var("OCCA_TRACE_FILE");
+        trace::enable();
+        trace::setExitFile(traceFile.size() ? traceFile : "occa_trace.json");
+      }
     }
 
     void envInitializer_t::initEnvironment() {
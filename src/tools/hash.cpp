@@ -1,6 +1,13 @@
-#include <sstream>
+#include <cstdio>
+#include <cstring>
 #include <stdint.h>
 
+#if defined(__AVX2__)
+#  include <immintrin.h>
+#elif defined(__SSE4_1__)
+#  include <smmintrin.h>
+#endif
+
 #include <occa/types.hpp>
 #include <occa/tools/hash.hpp>
 #include <occa/tools/env.hpp>
@@ -126,26 +133,170 @@ namespace occa {
     return out;
   }
 
-  hash_t hash(const void *ptr, udim_t bytes) {
-    std::stringstream ss;
-    const char *c = (char*) ptr;
+  //---[ hasher_t ]---------------------
+  namespace {
+    const uint32_t PRIME1 = 0x9E3779B1U;
+    const uint32_t PRIME2 = 0x85EBCA77U;
+    const uint32_t PRIME3 = 0xC2B2AE3DU;
+    const uint32_t PRIME4 = 0x27D4EB2FU;
 
-    hash_t hash;
-    int *h = hash.h;
+    inline uint32_t rotl32(const uint32_t x, const int r) {
+      return (x << r) | (x >> (32 - r));
+    }
 
-    const int p[8] = {
-      102679, 102701, 102761, 102763,
-      102769, 102793, 102797, 102811
-    };
+    inline uint32_t avalanche32(uint32_t h) {
+      h ^= h >> 15;
+      h *= PRIME2;
+      h ^= h >> 13;
+      h *= PRIME3;
+      h ^= h >> 16;
+      return h;
+    }
 
-    for (udim_t i = 0; i < bytes; ++i) {
-      for (int j = 0; j < 8; ++j) {
-        h[j] = (h[j] * p[j]) ^ c[i];
+    // acc[i] = rotl(acc[i] + word[i] * PRIME2, 13) * PRIME1
+    //   for each 32-byte stripe
+    void hashStripes(uint32_t *acc,
+                     const unsigned char *c,
+                     const udim_t stripes) {
+#if defined(__AVX2__)
+      const __m256i p1 = _mm256_set1_epi32((int) PRIME1);
+      const __m256i p2 = _mm256_set1_epi32((int) PRIME2);
+      __m256i a = _mm256_loadu_si256((const __m256i*) acc);
+      for (udim_t s = 0; s < stripes; ++s, c += hasher_t::stripeBytes) {
+        const __m256i w = _mm256_loadu_si256((const __m256i*) c);
+        a = _mm256_add_epi32(a, _mm256_mullo_epi32(w, p2));
+        a = _mm256_or_si256(_mm256_slli_epi32(a, 13),
+                            _mm256_srli_epi32(a, 19));
+        a = _mm256_mullo_epi32(a, p1);
+      }
+      _mm256_storeu_si256((__m256i*) acc, a);
+#elif defined(__SSE4_1__)
+      const __m128i p1 = _mm_set1_epi32((int) PRIME1);
+      const __m128i p2 = _mm_set1_epi32((int) PRIME2);
+      __m128i a0 = _mm_loadu_si128((const __m128i*) acc);
+      __m128i a1 = _mm_loadu_si128((const __m128i*) (acc + 4));
+      for (udim_t s = 0; s < stripes; ++s, c += hasher_t::stripeBytes) {
+        const __m128i w0 = _mm_loadu_si128((const __m128i*) c);
+        const __m128i w1 = _mm_loadu_si128((const __m128i*) (c + 16));
+        a0 = _mm_add_epi32(a0, _mm_mullo_epi32(w0, p2));
+        a1 = _mm_add_epi32(a1, _mm_mullo_epi32(w1, p2));
+        a0 = _mm_or_si128(_mm_slli_epi32(a0, 13), _mm_srli_epi32(a0, 19));
+        a1 = _mm_or_si128(_mm_slli_epi32(a1, 13), _mm_srli_epi32(a1, 19));
+        a0 = _mm_mullo_epi32(a0, p1);
+        a1 = _mm_mullo_epi32(a1, p1);
       }
+      _mm_storeu_si128((__m128i*) acc, a0);
+      _mm_storeu_si128((__m128i*) (acc + 4), a1);
+#else
+      // Independent lanes, left for the compiler to vectorize
+      uint32_t a[hasher_t::lanes];
+      ::memcpy(a, acc, sizeof(a));
+      for (udim_t s = 0; s < stripes; ++s, c += hasher_t::stripeBytes) {
+        uint32_t w[hasher_t::lanes];
+        ::memcpy(w, c, sizeof(w));
+        for (int i = 0; i < hasher_t::lanes; ++i) {
+          a[i] = rotl32(a[i] + (w[i] * PRIME2), 13) * PRIME1;
+        }
+      }
+      ::memcpy(acc, a, sizeof(a));
+#endif
     }
-    hash.initialized = true;
+  }
 
-    return hash;
+  hasher_t::hasher_t() {
+    reset();
+  }
+
+  void hasher_t::reset() {
+    // Same seeds as the default hash_t
+    const hash_t seed;
+    for (int i = 0; i < lanes; ++i) {
+      acc[i] = (uint32_t) seed.h[i];
+    }
+    bufferBytes = 0;
+    totalBytes = 0;
+  }
+
+  hasher_t& hasher_t::update(const void *ptr, udim_t bytes) {
+    const unsigned char *c = (const unsigned char*) ptr;
+    totalBytes += bytes;
+
+    // Finish the partial stripe from the previous update
+    if (bufferBytes) {
+      const udim_t missing = stripeBytes - bufferBytes;
+      const udim_t copyBytes = (bytes < missing) ? bytes : missing;
+      ::memcpy(buffer + bufferBytes, c, copyBytes);
+      bufferBytes += (int) copyBytes;
+      c += copyBytes;
+      bytes -= copyBytes;
+
+      if (bufferBytes < stripeBytes) {
+        return *this;
+      }
+      hashStripes(acc, buffer, 1);
+      bufferBytes = 0;
+    }
+
+    const udim_t stripes = bytes / stripeBytes;
+    if (stripes) {
+      hashStripes(acc, c, stripes);
+      c += stripes * stripeBytes;
+      bytes -= stripes * stripeBytes;
+    }
+
+    if (bytes) {
+      ::memcpy(buffer, c, bytes);
+      bufferBytes = (int) bytes;
+    }
+    return *this;
+  }
+
+  hasher_t& hasher_t::update(const std::string &str) {
+    return update(str.c_str(), str.size());
+  }
+
+  hash_t hasher_t::digest() const {
+    uint32_t h[lanes];
+    ::memcpy(h, acc, sizeof(h));
+
+    // Tail bytes are spread across lanes
+    for (int i = 0; i < bufferBytes; ++i) {
+      uint32_t &hi = h[i % lanes];
+      hi = rotl32(hi + (buffer[i] * PRIME4), 11) * PRIME1;
+    }
+
+    const uint64_t length = (uint64_t) totalBytes;
+    for (int i = 0; i < lanes; ++i) {
+      h[i] ^= (uint32_t) ((i & 1)
+                          ? (length >> 32)
+                          : length);
+      h[i] += (uint32_t) i * PRIME3;
+    }
+
+    // Mix lanes so each output word depends on every input word
+    //   (offsets {0, 1, 3} reach all 8 lanes after 3 rounds)
+    for (int round = 0; round < 3; ++round) {
+      uint32_t mixed[lanes];
+      for (int i = 0; i < lanes; ++i) {
+        mixed[i] = avalanche32(
+          (h[i] + rotl32(h[(i + 1) % lanes], 7))
+          ^ rotl32(h[(i + 3) % lanes], 19)
+        );
+      }
+      ::memcpy(h, mixed, sizeof(h));
+    }
+
+    hash_t ret;
+    for (int i = 0; i < lanes; ++i) {
+      ret.h[i] = (int) h[i];
+    }
+    ret.initialized = true;
+    return ret;
+  }
+  //====================================
+
+  hash_t hash(const void *ptr, udim_t bytes) {
+    return hasher_t().update(ptr, bytes).digest();
   }
 
   hash_t hash(const char *c) {
@@ -157,9 +308,20 @@ namespace occa {
   }
 
   hash_t hashFile(const std::string &filename) {
-    const char *c = io::c_read(io::filename(filename));
-    hash_t ret = hash(c);
-    delete [] c;
-    return ret;
+    const std::string expFilename = io::filename(filename);
+
+    FILE *fp = fopen(expFilename.c_str(), "rb");
+    OCCA_ERROR("Failed to open [" << io::shortname(expFilename) << "]",
+               fp != NULL);
+
+    hasher_t hasher;
+    char buffer[16384];
+    size_t nread;
+    while ((nread = fread(buffer, sizeof(char), sizeof(buffer), fp))) {
+      hasher.update(buffer, nread);
+    }
+    fclose(fp);
+
+    return hasher.digest();
   }
 }
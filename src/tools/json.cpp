@@ -20,8 +20,14 @@ namespace occa {
   }
 
   json& json::operator = (const json &j) {
+    // [j] might live inside our array/object, copy it before replacing them
+    jsonValue_t value = j.value_;
     type = j.type;
-    value_ = j.value_;
+    value_.boolean = value.boolean;
+    value_.number = value.number;
+    value_.string.swap(value.string);
+    value_.array.swap(value.array);
+    value_.object.swap(value.object);
     return *this;
   }
 
@@ -412,7 +418,9 @@ namespace occa {
       break;
     }
     case array_: {
-      value_.array.push_back(j);
+      // Copy [j] first in case we're appending ourselves
+      json value = j;
+      value_.array.push_back(value);
       break;
     }
     case object_: {
@@ -429,17 +437,20 @@ namespace occa {
       const json &val = it->second;
       ++it;
 
+      // Find the key and its insert position in one lookup
+      jsonObject::iterator oldIt = value_.object.lower_bound(key);
+      if ((oldIt == value_.object.end())
+          || (oldIt->first != key)) {
+        value_.object.insert(oldIt, jsonObject::value_type(key, val));
+        continue;
+      }
+
       // If we're merging two json objects, recursively merge them
-      if (val.isObject() && has(key)) {
-        // Reuse prefetch
-        json &oldVal = value_.object[key];
-        if (oldVal.isObject()) {
-          oldVal += val;
-        } else {
-          oldVal = val;
-        }
+      json &oldVal = oldIt->second;
+      if (val.isObject() && oldVal.isObject()) {
+        oldVal += val;
       } else {
-        value_.object[key] = val;
+        oldVal = val;
       }
     }
   }
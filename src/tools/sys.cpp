@@ -770,6 +770,47 @@ namespace occa {
       );
     }
 
+    std::string compilerSimdFlags(const std::string &compiler) {
+      return compilerSimdFlags( sys::compilerVendor(compiler) );
+    }
+
+    std::string compilerSimdFlags(const int vendor_) {
+      // Enables [#pragma omp simd] without the OpenMP runtime
+      if (vendor_ & (sys::vendor::GNU |
+                     sys::vendor::LLVM)) {
+        return "-fopenmp-simd";
+      } else if (vendor_ & sys::vendor::Intel) {
+        return "-qopenmp-simd";
+      }
+      return "";
+    }
+
+    void addSimdFlags(const std::string &compiler, std::string &compilerFlags) {
+      addSimdFlags(sys::compilerVendor(compiler), compilerFlags);
+    }
+
+    void addSimdFlags(const int vendor_, std::string &compilerFlags) {
+      addCompilerFlags(
+        compilerFlags,
+        sys::compilerSimdFlags(vendor_)
+      );
+    }
+
+    std::string compilerVectorizationReportFlags(const std::string &compiler) {
+      return compilerVectorizationReportFlags( sys::compilerVendor(compiler) );
+    }
+
+    std::string compilerVectorizationReportFlags(const int vendor_) {
+      if (vendor_ & sys::vendor::GNU) {
+        return "-fopt-info-vec-optimized";
+      } else if (vendor_ & sys::vendor::LLVM) {
+        return "-Rpass=loop-vectorize";
+      } else if (vendor_ & sys::vendor::Intel) {
+        return "-qopt-report-phase=vec";
+      }
+      return "";
+    }
+
     void addCompilerFlags(std::string &compilerFlags, const std::string &flags) {
       strVector compilerFlagsVec = split(compilerFlags, ' ');
       const strVector flagsVec = split(flags, ' ');
@@ -786,11 +827,20 @@ namespace occa {
 
     //---[ Dynamic Methods ]------------
     void* malloc(udim_t bytes) {
+      return malloc(bytes, env::OCCA_MEM_BYTE_ALIGN);
+    }
+
+    void* malloc(udim_t bytes, udim_t alignment) {
       void* ptr;
 
+      if (alignment < (udim_t) env::OCCA_MEM_BYTE_ALIGN) {
+        alignment = env::OCCA_MEM_BYTE_ALIGN;
+      }
+
 #if   (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
-      ignoreResult( posix_memalign(&ptr, env::OCCA_MEM_BYTE_ALIGN, bytes) );
+      ignoreResult( posix_memalign(&ptr, alignment, bytes) );
 #elif (OCCA_OS == OCCA_WINDOWS_OS)
+      // Pointers are released with ::free so we can't use _aligned_malloc
       ptr = ::malloc(bytes);
 #endif
 
@@ -861,6 +911,21 @@ namespace occa {
       return sym2;
     }
 
+    functionPtr_t dlsymIfExists(void *dlHandle,
+                                const std::string &functionName) {
+      if (!dlHandle) {
+        return NULL;
+      }
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+      void *sym = ::dlsym(dlHandle, functionName.c_str());
+#else
+      void *sym = GetProcAddress((HMODULE) dlHandle, functionName.c_str());
+#endif
+      functionPtr_t sym2;
+      ::memcpy(&sym2, &sym, sizeof(sym));
+      return sym2;
+    }
+
     void dlclose(void *dlHandle) {
       if (!dlHandle) {
         return;
@@ -0,0 +1,195 @@
+#include <atomic>
+#include <cstdlib>
+
+#include <occa/io/utils.hpp>
+#include <occa/tools/sys.hpp>
+#include <occa/tools/tls.hpp>
+#include <occa/tools/trace.hpp>
+
+namespace occa {
+  namespace trace {
+    namespace category {
+      const std::string build  = "build";
+      const std::string launch = "launch";
+      const std::string malloc = "malloc";
+      const std::string free   = "free";
+      const std::string copy   = "copy";
+    }
+
+    // Constant-initialized, so OCCA_TRACE can enable it during static
+    //   initialization
+    std::atomic<bool> enabled(false);
+
+    // Function statics since tracing can be enabled during static
+    //   initialization through OCCA_TRACE
+    class traceState_t {
+    public:
+      occa::mutex mutex;
+      std::vector<event_t> events;
+      double startTime;
+      std::string exitFile;
+      bool registeredExitDump;
+
+      traceState_t() :
+        startTime(0),
+        registeredExitDump(false) {}
+    };
+
+    static traceState_t& getState() {
+      static traceState_t state;
+      return state;
+    }
+
+    static std::atomic<int> threadCount(0);
+
+    event_t::event_t() :
+      start(0),
+      duration(0),
+      threadId(0),
+      bytes(0) {}
+
+    // Small ids read better than pthread handles in trace viewers
+    static int getThreadId() {
+      // Starts at 0 in every thread, so ids are stored shifted by 1
+      static tls<int> threadId;
+      int &id = threadId.value();
+      if (!id) {
+        id = ++threadCount;
+      }
+      return id - 1;
+    }
+
+    static void writeExitFile() {
+      traceState_t &state = getState();
+      state.mutex.lock();
+      const std::string filename = state.exitFile;
+      state.mutex.unlock();
+
+      if (filename.size()) {
+        writeChromeTrace(filename);
+      }
+    }
+
+    void enable() {
+      traceState_t &state = getState();
+      state.mutex.lock();
+      if (!state.startTime) {
+        state.startTime = sys::currentTime();
+      }
+      if (!state.registeredExitDump) {
+        state.registeredExitDump = true;
+        std::atexit(writeExitFile);
+      }
+      state.mutex.unlock();
+      enabled.store(true);
+    }
+
+    void disable() {
+      enabled.store(false);
+    }
+
+    void setExitFile(const std::string &filename) {
+      traceState_t &state = getState();
+      state.mutex.lock();
+      state.exitFile = filename;
+      state.mutex.unlock();
+    }
+
+    double now() {
+      return sys::currentTime();
+    }
+
+    void record(const std::string &category_,
+                const std::string &name,
+                const double start,
+                const udim_t bytes,
+                const occa::json &args) {
+      traceState_t &state = getState();
+
+      event_t event;
+      event.name     = name;
+      event.category = category_;
+      event.start    = start - state.startTime;
+      event.duration = sys::currentTime() - start;
+      event.threadId = getThreadId();
+      event.bytes    = bytes;
+      event.args     = args;
+
+      state.mutex.lock();
+      state.events.push_back(event);
+      state.mutex.unlock();
+    }
+
+    std::vector<event_t> getEvents() {
+      traceState_t &state = getState();
+      state.mutex.lock();
+      std::vector<event_t> events = state.events;
+      state.mutex.unlock();
+      return events;
+    }
+
+    std::vector<event_t> getEvents(const std::string &category_) {
+      traceState_t &state = getState();
+      std::vector<event_t> categoryEvents;
+
+      state.mutex.lock();
+      const int eventCount = (int) state.events.size();
+      for (int i = 0; i < eventCount; ++i) {
+        if (state.events[i].category == category_) {
+          categoryEvents.push_back(state.events[i]);
+        }
+      }
+      state.mutex.unlock();
+
+      return categoryEvents;
+    }
+
+    void clear() {
+      traceState_t &state = getState();
+      state.mutex.lock();
+      state.events.clear();
+      state.mutex.unlock();
+    }
+
+    occa::json toChromeTrace() {
+      const std::vector<event_t> events = getEvents();
+      const int eventCount = (int) events.size();
+
+      occa::json traceEvents(json::array_);
+      for (int i = 0; i < eventCount; ++i) {
+        const event_t &event = events[i];
+
+        // Complete events with microsecond timestamps
+        occa::json chromeEvent;
+        chromeEvent["name"] = event.name;
+        chromeEvent["cat"]  = event.category;
+        chromeEvent["ph"]   = "X";
+        chromeEvent["ts"]   = 1e6 * event.start;
+        chromeEvent["dur"]  = 1e6 * event.duration;
+        chromeEvent["pid"]  = 0;
+        chromeEvent["tid"]  = event.threadId;
+
+        occa::json args = event.args;
+        if (!args.isObject()) {
+          args = occa::json(json::object_);
+        }
+        // 64-bit integers are written with an L suffix, which isn't JSON
+        if (event.bytes) {
+          args["bytes"] = (double) event.bytes;
+        }
+        chromeEvent["args"] = args;
+
+        traceEvents += chromeEvent;
+      }
+
+      occa::json trace;
+      trace["traceEvents"] = traceEvents;
+      trace["displayTimeUnit"] = "ms";
+      return trace;
+    }
+
+    void writeChromeTrace(const std::string &filename) {
+      io::write(filename, toChromeTrace().dump(0));
+    }
+  }
+}
@@ -1,12 +1,11 @@
-#include <map>
-
 #include <occa/core/base.hpp>
 #include <occa/tools/misc.hpp>
 #include <occa/tools/sys.hpp>
+#include <occa/tools/tls.hpp>
 #include <occa/tools/uva.hpp>
 
 namespace occa {
-  ptrRangeMap uvaMap;
+  uvaIndex_t uvaMap;
   memoryVector uvaStaleMemory;
 
   //---[ ptrRange ]---------------------
@@ -53,13 +52,169 @@ namespace occa {
   //====================================
 
 
+  //---[ uvaIndex_t ]------------------
+  // Versions are unique across indices so a cached hit can't be
+  //   mistaken for one from another index
+  static std::atomic<udim_t> uvaIndexVersion(0);
+
+  class uvaIndexCache_t {
+  public:
+    const uvaIndex_t *index;
+    udim_t version;
+    uvaIndexEntry_t entry;
+
+    uvaIndexCache_t() :
+      index(NULL),
+      version(0) {
+      entry.start = entry.end = NULL;
+      entry.modeMemory = NULL;
+    }
+  };
+
+  static uvaIndexCache_t& getUvaIndexCache() {
+    // Never freed since memory can be released during static destruction
+    static tls<uvaIndexCache_t> *cache = new tls<uvaIndexCache_t>();
+    return cache->value();
+  }
+
+  uvaIndex_t::uvaIndex_t() :
+    version(++uvaIndexVersion) {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_rwlock_init(&rwlock, NULL);
+#endif
+  }
+
+  uvaIndex_t::~uvaIndex_t() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_rwlock_destroy(&rwlock);
+#else
+    rwlock.free();
+#endif
+  }
+
+  void uvaIndex_t::lockShared() const {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_rwlock_rdlock(&rwlock);
+#else
+    rwlock.lock();
+#endif
+  }
+
+  void uvaIndex_t::lockExclusive() const {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_rwlock_wrlock(&rwlock);
+#else
+    rwlock.lock();
+#endif
+  }
+
+  void uvaIndex_t::unlock() const {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    pthread_rwlock_unlock(&rwlock);
+#else
+    rwlock.unlock();
+#endif
+  }
+
+  size_t uvaIndex_t::lowerBound(const char *ptr) const {
+    size_t low = 0;
+    size_t high = entries.size();
+    while (low < high) {
+      const size_t mid = low + ((high - low) / 2);
+      if (entries[mid].end <= ptr) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
+
+  void uvaIndex_t::insert(void *ptr,
+                          const udim_t bytes,
+                          occa::modeMemory_t *modeMemory) {
+    uvaIndexEntry_t entry;
+    entry.start = (char*) ptr;
+    entry.end = entry.start + (bytes ? bytes : 1);
+    entry.modeMemory = modeMemory;
+
+    lockExclusive();
+
+    size_t first = lowerBound(entry.start);
+    size_t last = first;
+    while ((last < entries.size())
+           && (entries[last].start < entry.end)) {
+      ++last;
+    }
+    if (first < last) {
+      entries.erase(entries.begin() + first,
+                    entries.begin() + last);
+    }
+    entries.insert(entries.begin() + first, entry);
+
+    version = ++uvaIndexVersion;
+    unlock();
+  }
+
+  bool uvaIndex_t::erase(void *ptr) {
+    const char *c = (const char*) ptr;
+
+    lockExclusive();
+
+    const size_t index = lowerBound(c);
+    const bool found = ((index < entries.size())
+                        && (entries[index].start <= c));
+    if (found) {
+      entries.erase(entries.begin() + index);
+      version = ++uvaIndexVersion;
+    }
+
+    unlock();
+    return found;
+  }
+
+  occa::modeMemory_t* uvaIndex_t::find(const void *ptr) const {
+    const char *c = (const char*) ptr;
+
+    uvaIndexCache_t &cache = getUvaIndexCache();
+    if ((cache.index == this)
+        && (cache.version == version)
+        && (cache.entry.start <= c)
+        && (c < cache.entry.end)) {
+      return cache.entry.modeMemory;
+    }
+
+    lockShared();
+
+    const size_t index = lowerBound(c);
+    occa::modeMemory_t *modeMemory = NULL;
+    if ((index < entries.size())
+        && (entries[index].start <= c)) {
+      cache.index = this;
+      cache.version = version;
+      cache.entry = entries[index];
+      modeMemory = cache.entry.modeMemory;
+    }
+
+    unlock();
+    return modeMemory;
+  }
+
+  size_t uvaIndex_t::size() const {
+    lockShared();
+    const size_t entryCount = entries.size();
+    unlock();
+    return entryCount;
+  }
+  //====================================
+
+
   //---[ UVA ]--------------------------
   occa::modeMemory_t* uvaToMemory(void *ptr) {
     if (!ptr) {
       return NULL;
     }
-    ptrRangeMap::iterator it = uvaMap.find(ptr);
-    return (it == uvaMap.end()) ? NULL : it->second;
+    return uvaMap.find(ptr);
   }
 
   bool isManaged(void *ptr) {
@@ -137,12 +292,12 @@ namespace occa {
   }
 
   void removeFromStaleMap(void *ptr) {
-    ptrRangeMap::iterator it = uvaMap.find(ptr);
-    if (it == uvaMap.end()) {
+    modeMemory_t *mem = uvaMap.find(ptr);
+    if (!mem) {
       return;
     }
 
-    memory m(it->second);
+    memory m(mem);
     if (!m.uvaIsStale()) {
       return;
     }
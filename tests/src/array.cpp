@@ -0,0 +1,442 @@
+#include <cmath>
+
+#include <occa.hpp>
+#include <occa/array/linalg.hpp>
+#include <occa/tools/testing.hpp>
+
+void testMultiReduce();
+void testMultiReduceStreams();
+void testMultiReduceErrors();
+void testIndexTypes();
+void testLargeVectors();
+void testExpressions();
+void testExpressionFusion();
+void testExpressionErrors();
+void testTunedReductions();
+
+namespace linalg = occa::linalg;
+namespace reductionType = occa::linalg::reductionType;
+
+const int entries = 10000;
+
+int main(const int argc, const char **argv) {
+  testMultiReduce();
+  testMultiReduceStreams();
+  testMultiReduceErrors();
+  testIndexTypes();
+  testLargeVectors();
+  testExpressions();
+  testExpressionFusion();
+  testExpressionErrors();
+  testTunedReductions();
+
+  return 0;
+}
+
+bool isClose(const double a, const double b) {
+  return std::fabs(a - b) <= (1e-10 * (1 + std::fabs(b)));
+}
+
+void fillVectors(std::vector<double> &a,
+                 std::vector<double> &b) {
+  a.resize(entries);
+  b.resize(entries);
+  for (int i = 0; i < entries; ++i) {
+    a[i] = std::sin((double) i);
+    b[i] = (i % 7) - 3.5 + (i / 1000.0);
+  }
+}
+
+void testMultiReduce() {
+  occa::device device("mode: 'Serial'");
+
+  std::vector<double> a, b;
+  fillVectors(a, b);
+
+  std::vector<occa::memory> vecs;
+  vecs.push_back(device.malloc<double>(entries, &(a[0])));
+  vecs.push_back(device.malloc<double>(entries, &(b[0])));
+
+  linalg::reductionVector reductions;
+  reductions.push_back(linalg::reduction_t(reductionType::dot, 0, 1));
+  reductions.push_back(linalg::reduction_t(reductionType::l2Norm, 0));
+  reductions.push_back(linalg::reduction_t(reductionType::sum, 1));
+  reductions.push_back(linalg::reduction_t(reductionType::l1Norm, 1));
+  reductions.push_back(linalg::reduction_t(reductionType::lInfNorm, 1));
+  reductions.push_back(linalg::reduction_t(reductionType::max, 0));
+  reductions.push_back(linalg::reduction_t(reductionType::min, 0));
+  reductions.push_back(linalg::reduction_t(reductionType::distance, 0, 1));
+
+  double dot = 0, l2Norm = 0, sum = 0, l1Norm = 0, lInfNorm = 0, distance = 0;
+  double max = a[0], min = a[0];
+  for (int i = 0; i < entries; ++i) {
+    dot      += a[i] * b[i];
+    l2Norm   += a[i] * a[i];
+    sum      += b[i];
+    l1Norm   += std::fabs(b[i]);
+    lInfNorm  = std::max(lInfNorm, std::fabs(b[i]));
+    max       = std::max(max, a[i]);
+    min       = std::min(min, a[i]);
+    distance += (a[i] - b[i]) * (a[i] - b[i]);
+  }
+  l2Norm = std::sqrt(l2Norm);
+  distance = std::sqrt(distance);
+
+  linalg::reductionFuture<double> future = (
+    linalg::multiReduce<double, double>(reductions, vecs)
+  );
+  ASSERT_EQ(future.size(),
+            (int) reductions.size());
+  ASSERT_EQ((int) future.getMemory().size(),
+            (int) (reductions.size() * sizeof(double)));
+
+  std::vector<double> results = future.getAll();
+  ASSERT_TRUE(isClose(results[0], dot));
+  ASSERT_TRUE(isClose(results[1], l2Norm));
+  ASSERT_TRUE(isClose(results[2], sum));
+  ASSERT_TRUE(isClose(results[3], l1Norm));
+  ASSERT_TRUE(isClose(results[4], lInfNorm));
+  ASSERT_TRUE(isClose(results[5], max));
+  ASSERT_TRUE(isClose(results[6], min));
+  ASSERT_TRUE(isClose(results[7], distance));
+
+  ASSERT_TRUE(isClose(future.get(0), dot));
+
+  // Matches the single reductions
+  ASSERT_TRUE(isClose(results[0],
+                      linalg::dot<double, double, double>(vecs[0], vecs[1])));
+  ASSERT_TRUE(isClose(results[1],
+                      linalg::l2Norm<double, double>(vecs[0])));
+
+  // The cached kernels handle other sizes
+  std::vector<occa::memory> smallVecs;
+  smallVecs.push_back(vecs[0].slice(0, 10));
+  smallVecs.push_back(vecs[1].slice(0, 10));
+  results = linalg::multiReduce<double, double>(reductions, smallVecs).getAll();
+
+  dot = 0;
+  for (int i = 0; i < 10; ++i) {
+    dot += a[i] * b[i];
+  }
+  ASSERT_TRUE(isClose(results[0], dot));
+
+  vecs[0].free();
+  vecs[1].free();
+}
+
+void testMultiReduceStreams() {
+  occa::device device("mode: 'Serial'");
+
+  std::vector<double> a, b;
+  fillVectors(a, b);
+
+  std::vector<occa::memory> vecs;
+  vecs.push_back(device.malloc<double>(entries, &(a[0])));
+
+  double l2Norm = 0;
+  for (int i = 0; i < entries; ++i) {
+    l2Norm += a[i] * a[i];
+  }
+  l2Norm = std::sqrt(l2Norm);
+
+  linalg::reductionVector reductions;
+  reductions.push_back(linalg::reduction_t(reductionType::l2Norm, 0));
+
+  // Reductions are queued on asynchronous streams
+  occa::stream initialStream = device.getStream();
+  device.setStream(device.createStream());
+
+  linalg::reductionFuture<double> future = (
+    linalg::multiReduce<double, double>(reductions, vecs)
+  );
+
+  device.setStream(initialStream);
+  ASSERT_TRUE(isClose(future.get(0), l2Norm));
+
+  vecs[0].free();
+}
+
+void testMultiReduceErrors() {
+  occa::device device("mode: 'Serial'");
+
+  std::vector<occa::memory> vecs;
+  vecs.push_back(device.malloc<double>(entries));
+
+  linalg::reductionVector reductions;
+  ASSERT_THROW(
+    (linalg::multiReduce<double, double>(reductions, vecs));
+  );
+
+  reductions.push_back(linalg::reduction_t(reductionType::dot, 0, 1));
+  ASSERT_THROW(
+    (linalg::multiReduce<double, double>(reductions, vecs));
+  );
+
+  vecs.push_back(device.malloc<double>(entries + 1));
+  ASSERT_THROW(
+    (linalg::multiReduce<double, double>(reductions, vecs));
+  );
+
+  linalg::reductionFuture<double> future;
+  ASSERT_FALSE(future.isInitialized());
+
+  vecs[0].free();
+  vecs[1].free();
+
+  // max, min and lInfNorm have no value without entries
+  std::vector<occa::memory> emptyVecs;
+  emptyVecs.push_back(device.malloc<double>(entries).slice(0, 0));
+
+  reductions.clear();
+  reductions.push_back(linalg::reduction_t(reductionType::sum, 0));
+  ASSERT_EQ(0.0,
+            (linalg::multiReduce<double, double>(reductions, emptyVecs).get(0)));
+
+  reductions.push_back(linalg::reduction_t(reductionType::max, 0));
+  ASSERT_THROW(
+    (linalg::multiReduce<double, double>(reductions, emptyVecs));
+  );
+}
+
+void testIndexTypes() {
+  const occa::udim_t maxEntries = linalg::max32BitEntries;
+
+  ASSERT_EQ(linalg::getIndexType(0),
+            0);
+  ASSERT_EQ(linalg::getIndexType(maxEntries),
+            0);
+  ASSERT_EQ(linalg::getIndexType(maxEntries + 1),
+            1);
+  ASSERT_EQ(linalg::getIndexType((occa::udim_t) 1 << 40),
+            1);
+
+  // 32-bit kernels are kept for sizes that fit
+  ASSERT_EQ(linalg::indexArg(maxEntries)[0].size,
+            (occa::udim_t) sizeof(int));
+  ASSERT_EQ(linalg::indexArg(maxEntries + 1)[0].size,
+            (occa::udim_t) sizeof(int64_t));
+}
+
+void testLargeVectors() {
+  occa::device device("mode: 'Serial'");
+
+  // Past 2^31 entries, needs 64-bit indices
+  const occa::udim_t largeEntries = ((occa::udim_t) 1 << 31) + 1000;
+  occa::memory vec = device.malloc<char>(largeEntries);
+
+  linalg::operator_eq<char>(vec, 1);
+
+  char lastValues[4];
+  vec.copyTo(lastValues, 4, largeEntries - 4);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ((int) lastValues[i],
+              1);
+  }
+
+  ASSERT_EQ((linalg::sum<char, double>(vec)),
+            (double) largeEntries);
+
+  linalg::reductionVector reductions;
+  reductions.push_back(linalg::reduction_t(reductionType::sum, 0));
+  reductions.push_back(linalg::reduction_t(reductionType::max, 0));
+
+  std::vector<occa::memory> vecs(1, vec);
+  linalg::reductionFuture<double> future = linalg::multiReduce<char, double>(reductions, vecs);
+  ASSERT_EQ(future.get(0),
+            (double) largeEntries);
+  ASSERT_EQ(future.get(1),
+            1.0);
+
+  vec.free();
+}
+
+void testExpressions() {
+  occa::device device("mode: 'Serial'");
+
+  std::vector<double> bValues, cValues;
+  fillVectors(bValues, cValues);
+  std::vector<float> dValues(entries);
+  for (int i = 0; i < entries; ++i) {
+    dValues[i] = (float) (i % 13);
+  }
+
+  occa::array<double> a(device, entries);
+  occa::array<double> b(device, entries, &(bValues[0]));
+  occa::array<double> c(device, entries, &(cValues[0]));
+  occa::array<float> d(device, entries, &(dValues[0]));
+
+  std::vector<double> aValues(entries);
+
+  a = b + 2*c - d;
+  a.memory().copyTo(&(aValues[0]));
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_TRUE(isClose(aValues[i],
+                        bValues[i] + 2*cValues[i] - dValues[i]));
+  }
+
+  // Compound assignment with the output inside the expression
+  a += -(a * b) / 2.5;
+  for (int i = 0; i < entries; ++i) {
+    const double ai = aValues[i];
+    aValues[i] = ai + (-(ai * bValues[i]) / 2.5);
+  }
+  std::vector<double> a2Values(entries);
+  a.memory().copyTo(&(a2Values[0]));
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_TRUE(isClose(a2Values[i],
+                        aValues[i]));
+  }
+
+  // Reused arrays
+  a = b * b - 1.0f;
+  a.memory().copyTo(&(aValues[0]));
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_TRUE(isClose(aValues[i],
+                        (bValues[i] * bValues[i]) - 1.0f));
+  }
+
+  // Expressions can be stored and reused
+  occa::arrayExprBinary<occa::arrayExprVector<double>,
+                        occa::arrayExprConstant<int> > scaled = c * 3;
+  a = scaled;
+  a *= scaled;
+  a.memory().copyTo(&(aValues[0]));
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_TRUE(isClose(aValues[i],
+                        9 * cValues[i] * cValues[i]));
+  }
+
+  a = b - 1;
+  a.memory().copyTo(&(aValues[0]));
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_TRUE(isClose(aValues[i], bValues[i] - 1));
+  }
+
+  a = b + 0.5;
+  a.memory().copyTo(&(aValues[0]));
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_TRUE(isClose(aValues[i], bValues[i] + 0.5));
+  }
+
+  occa::array<double> bOffset = b.offset(10);
+  ASSERT_TRUE(bOffset.ptr() == (b.ptr() + 10));
+  ASSERT_EQ((int) bOffset.size(), entries - 10);
+
+  // array + integer still offsets the array
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#endif
+  bOffset = b + 10;
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  pragma GCC diagnostic pop
+#endif
+  ASSERT_TRUE(bOffset.ptr() == (b.ptr() + 10));
+  ASSERT_EQ((int) bOffset.size(), entries - 10);
+}
+
+void testExpressionFusion() {
+  occa::device device("mode: 'Serial'");
+
+  occa::array<double> a(device, entries);
+  occa::array<double> b(device, entries);
+  occa::array<double> c(device, entries);
+  occa::array<double> d(device, entries);
+  b = 1.0;
+  c = 2.0;
+  d = 3.0;
+
+  occa::trace::enable();
+  occa::trace::clear();
+
+  // One kernel launch per assignment
+  a = b + 2*c - d;
+  ASSERT_EQ((int) occa::trace::getEvents(occa::trace::category::launch).size(),
+            1);
+
+  // Same shape and types reuse the kernel, even with other arrays and constants
+  occa::trace::clear();
+  d = c + 5*a - b;
+  std::vector<occa::trace::event_t> builds = occa::trace::getEvents(occa::trace::category::build);
+  ASSERT_EQ((int) builds.size(),
+            0);
+  ASSERT_EQ((int) occa::trace::getEvents(occa::trace::category::launch).size(),
+            1);
+
+  occa::trace::disable();
+  occa::trace::clear();
+
+  double dValue;
+  d.memory().copyTo(&dValue, sizeof(double));
+  ASSERT_EQ(dValue,
+            2.0 + 5*(1.0 + 4.0 - 3.0) - 1.0);
+}
+
+void testExpressionErrors() {
+  occa::device device("mode: 'Serial'");
+
+  occa::array<double> a(device, entries);
+  occa::array<double> b(device, entries);
+  occa::array<double> small(device, entries / 2);
+  occa::array<double> empty;
+
+  ASSERT_THROW(
+    a = b + small;
+  );
+  ASSERT_THROW(
+    a = 2 * empty;
+  );
+  ASSERT_THROW(
+    empty = 2 * b;
+  );
+}
+
+void testTunedReductions() {
+  occa::device device("mode: 'Serial'");
+
+  std::vector<double> a, b;
+  fillVectors(a, b);
+  occa::memory vec = device.malloc<double>(entries, &(a[0]));
+  occa::memory buffer = device.malloc<double>(linalg::tunedDotOuters[linalg::tunedDotOuterCount - 1]);
+
+  double l1Norm = 0;
+  for (int i = 0; i < entries; ++i) {
+    l1Norm += std::fabs(a[i]);
+  }
+
+  std::vector<occa::kernelArg> args;
+  args.push_back(linalg::indexArg(entries));
+  args.push_back(vec);
+  args.push_back(buffer);
+
+  const occa::properties searchSpace = linalg::reductionSearchSpace(device.mode());
+  ASSERT_TRUE(searchSpace.has("defines/CPU_DOT_OUTER"));
+  ASSERT_FALSE(searchSpace.has("defines/GPU_DOT_INNER"));
+
+  // Force a block count other than the default
+  occa::kernelBuilder builder = linalg::makeLinalgBuilder<double, double>("l1Norm", 0);
+  builder.tune(device, "defines: { CPU_DOT_OUTER: [256] }", args);
+
+  // Reductions pick up the tuned variant and its number of partials
+  occa::kernelBuilderVector builders = linalg::makeLinalgBuilders<double, double>("l1Norm");
+  int partials;
+  double *partialReduction = linalg::reduce<double, double>(vec, builders, partials);
+  ASSERT_EQ(partials,
+            256);
+
+  double tunedL1Norm = 0;
+  for (int i = 0; i < partials; ++i) {
+    tunedL1Norm += partialReduction[i];
+  }
+  delete [] partialReduction;
+  ASSERT_TRUE(isClose(tunedL1Norm, l1Norm));
+  ASSERT_TRUE(isClose(linalg::l1Norm<double, double>(vec), l1Norm));
+
+  builder.clearTuning(device);
+  occa::kernelBuilderVector defaultBuilders = linalg::makeLinalgBuilders<double, double>("l1Norm");
+  ASSERT_EQ(linalg::getReductionPartials(defaultBuilders[0].build(device)),
+            1024);
+
+  vec.free();
+  buffer.free();
+}
@@ -1,4 +1,5 @@
 #include <occa.hpp>
+#include <occa/modes/serial/device.hpp>
 #include <occa/tools/testing.hpp>
 
 occa::kernel addVectors;
@@ -8,9 +9,14 @@ const std::string addVectorsFile = (
 
 void testInit();
 void testInfo();
+void testCache();
+void testAsyncBuild();
+void testSharedBinary();
 void testParsingFailure();
 void testCompilingFailure();
 void testArgumentFailure();
+void testArgPack();
+void testManyArgs();
 void testRun();
 
 int main(const int argc, const char **argv) {
@@ -19,9 +25,14 @@ int main(const int argc, const char **argv) {
 
   testInit();
   testInfo();
+  testCache();
+  testAsyncBuild();
+  testSharedBinary();
   testParsingFailure();
   testCompilingFailure();
   testArgumentFailure();
+  testArgPack();
+  testManyArgs();
   testRun();
 
   return 0;
@@ -72,6 +83,180 @@ void testInfo() {
   addVectors2.maxInnerDims();
 }
 
+void testCache() {
+  // Same source and props should reuse the loaded kernel
+  occa::kernel addVectors2 = occa::buildKernel(addVectorsFile,
+                                               "addVectors");
+  ASSERT_EQ(addVectors2.getModeKernel(),
+            addVectors.getModeKernel());
+
+  // Different props should build a new kernel
+  occa::kernel addVectors3 = occa::buildKernel(addVectorsFile,
+                                               "addVectors",
+                                               "defines: { FOO: 1 }");
+  ASSERT_NEQ(addVectors3.getModeKernel(),
+             addVectors.getModeKernel());
+
+  // Freed kernels should be removed from the cache
+  addVectors3.free();
+  ASSERT_FALSE(addVectors3.isInitialized());
+
+  addVectors3 = occa::buildKernel(addVectorsFile,
+                                  "addVectors",
+                                  "defines: { FOO: 1 }");
+  ASSERT_TRUE(addVectors3.isInitialized());
+
+  const std::string source = (
+    "@kernel void foo(int N) {"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {}"
+    "}"
+  );
+  occa::kernel foo1 = occa::buildKernelFromString(source, "foo");
+  occa::kernel foo2 = occa::buildKernelFromString(source, "foo");
+  ASSERT_EQ(foo1.getModeKernel(),
+            foo2.getModeKernel());
+}
+
+void testAsyncBuild() {
+  occa::device device = occa::host();
+
+  occa::kernelBuildRequestVector requests;
+  // Already loaded
+  requests.push_back(
+    occa::kernelBuildRequest(addVectorsFile, "addVectors")
+  );
+  // Duplicate hashes share a build
+  requests.push_back(
+    occa::kernelBuildRequest(addVectorsFile, "addVectors",
+                             "defines: { ASYNC: 1 }")
+  );
+  requests.push_back(
+    occa::kernelBuildRequest(addVectorsFile, "addVectors",
+                             "defines: { ASYNC: 1 }")
+  );
+  requests.push_back(
+    occa::kernelBuildRequest(addVectorsFile, "addVectors",
+                             "defines: { ASYNC: 2 }")
+  );
+
+  occa::kernelFutureVector futures = device.buildKernelsAsync(requests,
+                                                              "threads: 2");
+  ASSERT_EQ((int) futures.size(),
+            (int) requests.size());
+
+  ASSERT_TRUE(futures[0].isReady());
+  ASSERT_EQ(futures[0].get().getModeKernel(),
+            addVectors.getModeKernel());
+
+  occa::kernel async1 = futures[1].get();
+  occa::kernel async2 = futures[2].get();
+  occa::kernel async3 = futures[3].get();
+  ASSERT_TRUE(futures[1].isReady());
+  ASSERT_TRUE(async1.isInitialized());
+  ASSERT_TRUE(async3.isInitialized());
+  ASSERT_EQ(async1.getModeKernel(),
+            async2.getModeKernel());
+  ASSERT_NEQ(async1.getModeKernel(),
+             async3.getModeKernel());
+
+  // Resolved kernels are cached
+  ASSERT_EQ(occa::buildKernel(addVectorsFile,
+                              "addVectors",
+                              "defines: { ASYNC: 2 }").getModeKernel(),
+            async3.getModeKernel());
+
+  // Errors are raised when fetching the kernel
+  const std::string badFile = occa::io::cachePath() + "tests/asyncBadKernel.okl";
+  occa::io::write(badFile,
+                  "@kernel void foo() {"
+                  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {}"
+                  "}");
+
+  requests.clear();
+  requests.push_back(
+    occa::kernelBuildRequest(badFile, "foo")
+  );
+  futures = device.buildKernelsAsync(requests);
+  ASSERT_THROW(
+    futures[0].get();
+  );
+  occa::sys::rmrf(badFile);
+
+  // Batches share the build workers and freeing the device waits on them
+  occa::device freedDevice("mode: 'Serial'");
+  occa::kernelFutureVector freedFutures;
+  for (int i = 0; i < 3; ++i) {
+    requests.clear();
+    for (int j = 0; j < 2; ++j) {
+      requests.push_back(
+        occa::kernelBuildRequest(addVectorsFile, "addVectors",
+                                 "defines: { ASYNC_BATCH: " + occa::toString(2*i + j) + " }")
+      );
+    }
+    futures = freedDevice.buildKernelsAsync(requests, "threads: 1");
+    freedFutures.insert(freedFutures.end(), futures.begin(), futures.end());
+  }
+  freedDevice.free();
+  for (int i = 0; i < (int) freedFutures.size(); ++i) {
+    ASSERT_TRUE(freedFutures[i].isReady());
+  }
+
+  occa::kernelFuture emptyFuture;
+  ASSERT_FALSE(emptyFuture.isInitialized());
+  ASSERT_FALSE(emptyFuture.isReady());
+}
+
+void testSharedBinary() {
+  const std::string source = (
+    "@kernel void sharedFoo(int N, int *values) {"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {"
+    "    values[i] = 1;"
+    "  }"
+    "}"
+    "@kernel void sharedBar(int N, int *values) {"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {"
+    "    values[i] = 2;"
+    "  }"
+    "}"
+  );
+  occa::kernel foo = occa::buildKernelFromString(source, "sharedFoo");
+  occa::kernel bar = occa::buildKernelFromString(source, "sharedBar");
+
+  // Kernels in the same source are loaded from one binary
+  ASSERT_NEQ(foo.getModeKernel(),
+             bar.getModeKernel());
+  ASSERT_EQ(foo.binaryFilename(),
+            bar.binaryFilename());
+
+  occa::serial::device *hostDevice = (
+    dynamic_cast<occa::serial::device*>(occa::host().getModeDevice())
+  );
+  const std::string binaryFilename = foo.binaryFilename();
+  ASSERT_EQ(hostDevice->sharedBinaryRefs(binaryFilename),
+            2);
+
+  int values[4] = {0, 0, 0, 0};
+  occa::memory o_values = occa::malloc(4 * sizeof(int), values);
+
+  foo(4, o_values);
+  o_values.copyTo(values);
+  ASSERT_EQ(values[3], 1);
+
+  // The binary stays loaded while other kernels use it
+  foo.free();
+  ASSERT_EQ(hostDevice->sharedBinaryRefs(binaryFilename),
+            1);
+
+  bar(4, o_values);
+  o_values.copyTo(values);
+  ASSERT_EQ(values[3], 2);
+
+  bar.free();
+  ASSERT_EQ(hostDevice->sharedBinaryRefs(binaryFilename),
+            0);
+  o_values.free();
+}
+
 void testParsingFailure() {
   occa::kernel badKernel;
   std::string badSource = (
@@ -140,6 +325,117 @@ void testArgumentFailure() {
   );
 }
 
+void testArgPack() {
+  const int entries = 5;
+  float a[entries], b[entries], ab[entries];
+  for (int i = 0; i < entries; ++i) {
+    a[i]  = i;
+    b[i]  = 1 - i;
+    ab[i] = 0;
+  }
+
+  occa::memory o_a  = occa::malloc(entries * sizeof(float), a);
+  occa::memory o_b  = occa::malloc(entries * sizeof(float), b);
+  occa::memory o_ab = occa::malloc(entries * sizeof(float));
+
+  occa::kernelArgPack pack = addVectors.bind(entries, o_a, o_b, o_ab);
+  ASSERT_TRUE(pack.isInitialized());
+  ASSERT_EQ(pack.size(), 4);
+  ASSERT_TRUE(pack.getKernel() == addVectors);
+
+  pack.run();
+  o_ab.copyTo(ab);
+  for (int i = 0; i < entries; ++i) {
+    ASSERT_EQ(ab[i], 1);
+  }
+
+  // Update a scalar in-place
+  o_ab.copyFrom(a);
+  pack.set(0, 2);
+  pack();
+  o_ab.copyTo(ab);
+  ASSERT_EQ(ab[1], 1);
+  ASSERT_EQ(ab[2], 2);
+
+  // Rebind memory
+  pack.set(0, entries);
+  pack.set(2, o_a);
+  pack();
+  o_ab.copyTo(ab);
+  ASSERT_EQ(ab[4], 8);
+
+  // Validation happens at bind time
+  ASSERT_THROW(
+    addVectors.bind(entries, o_a, o_b);
+  );
+  ASSERT_THROW(
+    addVectors.bind(o_a, o_a, o_b, o_ab);
+  );
+  ASSERT_THROW(
+    pack.set(1, entries);
+  );
+  ASSERT_THROW(
+    pack.set(0, (double) 1.0);
+  );
+  // Scalars of the right size but the wrong kind
+  ASSERT_THROW(
+    pack.set(0, (float) 1.0);
+  );
+  pack.set(0, (uint32_t) entries);
+  ASSERT_THROW(
+    pack.set(4, entries);
+  );
+
+  occa::kernelArgPack emptyPack;
+  ASSERT_FALSE(emptyPack.isInitialized());
+  ASSERT_THROW(
+    emptyPack.run();
+  );
+
+  o_a.free();
+  o_b.free();
+  o_ab.free();
+}
+
+void testManyArgs() {
+  // Kernels launched through trampolines are not bound by OCCA_MAX_ARGS
+  const int scalarCount = 2 * OCCA_MAX_ARGS;
+
+  std::stringstream ss;
+  ss << "@kernel void manyArgs(int *sum";
+  for (int i = 0; i < scalarCount; ++i) {
+    ss << ", const int arg" << i;
+  }
+  ss << ") {\n"
+     << "  for (int i = 0; i < 1; ++i; @tile(1, @outer, @inner)) {\n"
+     << "    int total = 0;\n";
+  for (int i = 0; i < scalarCount; ++i) {
+    ss << "    total += arg" << i << ";\n";
+  }
+  ss << "    sum[0] = total;\n"
+     << "  }\n"
+     << "}\n";
+
+  occa::kernel manyArgs = occa::buildKernelFromString(ss.str(),
+                                                      "manyArgs");
+  ASSERT_TRUE(manyArgs.getModeKernel()->maxArgs() < 0);
+
+  int sum = 0;
+  occa::memory o_sum = occa::malloc(1 * sizeof(int), &sum);
+
+  manyArgs.clearArgs();
+  manyArgs.pushArg(o_sum);
+  for (int i = 0; i < scalarCount; ++i) {
+    manyArgs.pushArg(i);
+  }
+  manyArgs.run();
+
+  o_sum.copyTo(&sum);
+  ASSERT_EQ(sum, (scalarCount * (scalarCount - 1)) / 2);
+
+  o_sum.free();
+}
+
 void testRun() {
   std::string argKernelFile = (
     occa::env::OCCA_DIR + "tests/files/argKernel.okl"
@@ -0,0 +1,186 @@
+#include <occa.hpp>
+#include <occa/core/tuning.hpp>
+#include <occa/tools/env.hpp>
+#include <occa/tools/testing.hpp>
+
+void testTune();
+void testTuneSharedKernels();
+void testTuneErrors();
+
+const std::string addSource = (
+  "@kernel void add(const int N, const float *a, float *b) {"
+  "  for (int i = 0; i < N; ++i; @tile(TILESIZE, @outer, @inner)) {"
+  "    b[i] += UNROLL * a[i] + TUNE_TEST_VALUE;"
+  "  }"
+  "}"
+);
+
+int main(const int argc, const char **argv) {
+  // Keep kernels and tuning results out of the user's cache
+  occa::env::OCCA_CACHE_DIR = (
+    "/tmp/occa_kernelBuilder_" + occa::toString(occa::sys::getPID()) + "/"
+  );
+
+  testTune();
+  testTuneSharedKernels();
+  testTuneErrors();
+
+  occa::sys::rmdir(occa::env::OCCA_CACHE_DIR, true);
+
+  return 0;
+}
+
+occa::kernelBuilder makeAddBuilder(const int testValue) {
+  occa::properties props;
+  props["defines/TILESIZE"] = 32;
+  props["defines/UNROLL"] = 1;
+  props["defines/TUNE_TEST_VALUE"] = testValue;
+  return occa::kernelBuilder::fromString(addSource, "add", props);
+}
+
+void testTune() {
+  occa::device device("mode: 'Serial'");
+  const int testValue = 1;
+
+  const int entries = 1000;
+  occa::memory a = device.malloc<float>(entries);
+  occa::memory b = device.malloc<float>(entries);
+
+  std::vector<occa::kernelArg> args;
+  args.push_back(entries);
+  args.push_back(a);
+  args.push_back(b);
+
+  occa::kernelBuilder builder = makeAddBuilder(testValue);
+
+  // Untuned builds use the default properties
+  ASSERT_EQ((int) builder.tunedProperties(device)["defines/TILESIZE"],
+            32);
+
+  occa::kernel tunedKernel = builder.tune(device,
+                                          "defines: {"
+                                          "  TILESIZE: [16, 64],"
+                                          "  UNROLL: [1, 2, 3],"
+                                          "}",
+                                          args,
+                                          "warmup: 1, repeats: 2");
+  ASSERT_TRUE(tunedKernel.isInitialized());
+
+  const occa::properties &tunedProps = tunedKernel.properties();
+  const int tileSize = tunedProps["defines/TILESIZE"];
+  const int unroll = tunedProps["defines/UNROLL"];
+  ASSERT_TRUE((tileSize == 16) || (tileSize == 64));
+  ASSERT_TRUE((1 <= unroll) && (unroll <= 3));
+  ASSERT_EQ((int) tunedProps["defines/TUNE_TEST_VALUE"],
+            testValue);
+
+  // The builder now uses the tuned variant
+  ASSERT_TRUE(builder.build(device) == tunedKernel);
+
+  // Other builders of the same kernel pick up the tuned variant
+  occa::kernelBuilder builder2 = makeAddBuilder(testValue);
+  occa::kernel kernel2 = builder2.build(device);
+  ASSERT_EQ((int) kernel2.properties()["defines/TILESIZE"],
+            tileSize);
+  ASSERT_EQ((int) kernel2.properties()["defines/UNROLL"],
+            unroll);
+
+  // Results are stored in the device's tuning database
+  const std::string filename = occa::tuning::filename(device);
+  ASSERT_TRUE(occa::io::isFile(filename));
+  occa::tuning::clear();
+
+  occa::json db = occa::json::read(filename);
+  ASSERT_TRUE(db.isObject());
+
+  occa::kernelBuilder builder3 = makeAddBuilder(testValue);
+  occa::properties props3 = builder3.tunedProperties(device);
+  ASSERT_EQ((int) props3["defines/TILESIZE"],
+            tileSize);
+  ASSERT_EQ((int) props3["defines/UNROLL"],
+            unroll);
+
+  // Kernels built for other properties are not affected
+  occa::kernel kernel3 = builder3.build(device, "defines: { UNROLL: 5 }");
+  ASSERT_EQ((int) kernel3.properties()["defines/TILESIZE"],
+            32);
+
+  builder3.clearTuning(device);
+  ASSERT_EQ((int) builder3.tunedProperties(device)["defines/TILESIZE"],
+            32);
+  ASSERT_EQ((int) builder3.build(device).properties()["defines/TILESIZE"],
+            32);
+
+  occa::tuning::clear();
+  ASSERT_EQ((int) makeAddBuilder(testValue).tunedProperties(device)["defines/TILESIZE"],
+            32);
+
+  a.free();
+  b.free();
+}
+
+void testTuneSharedKernels() {
+  occa::device device("mode: 'Serial'");
+
+  const int entries = 64;
+  occa::memory a = device.malloc<float>(entries);
+  occa::memory b = device.malloc<float>(entries);
+
+  std::vector<occa::kernelArg> args;
+  args.push_back(entries);
+  args.push_back(a);
+  args.push_back(b);
+
+  // Built before tuning with the default properties inside the search space
+  occa::kernelBuilder builder = makeAddBuilder(2);
+  occa::kernel defaultKernel = builder.build(device);
+  occa::kernel otherKernel = makeAddBuilder(2).build(device,
+                                                     "defines: { TILESIZE: 16 }");
+
+  occa::kernel tunedKernel = builder.tune(device,
+                                          "defines: { TILESIZE: [16, 32] }",
+                                          args,
+                                          "warmup: 0, repeats: 1");
+  ASSERT_TRUE(tunedKernel.isInitialized());
+  ASSERT_TRUE(builder.build(device) == tunedKernel);
+  ASSERT_TRUE((tunedKernel == defaultKernel) || (tunedKernel == otherKernel));
+
+  // Handles held elsewhere stay usable, including the losing variant
+  ASSERT_TRUE(defaultKernel.isInitialized());
+  ASSERT_TRUE(otherKernel.isInitialized());
+  defaultKernel(entries, a, b);
+  otherKernel(entries, a, b);
+
+  // Default value winning the only variant
+  occa::kernel onlyDefault = builder.tune(device,
+                                          "defines: { TILESIZE: [32] }",
+                                          args,
+                                          "warmup: 0, repeats: 1");
+  ASSERT_TRUE(onlyDefault.isInitialized());
+  ASSERT_TRUE(onlyDefault == defaultKernel);
+  ASSERT_TRUE(builder.build(device) == defaultKernel);
+
+  builder.clearTuning(device);
+  ASSERT_TRUE(defaultKernel.isInitialized());
+  ASSERT_TRUE(otherKernel.isInitialized());
+  defaultKernel(entries, a, b);
+
+  a.free();
+  b.free();
+}
+
+void testTuneErrors() {
+  occa::device device("mode: 'Serial'");
+  occa::kernelBuilder builder = makeAddBuilder(0);
+  std::vector<occa::kernelArg> args;
+
+  ASSERT_THROW(
+    builder.tune(device, "defines: { TILESIZE: 16 }", args);
+  );
+  ASSERT_THROW(
+    builder.tune(device, "defines: { TILESIZE: [] }", args);
+  );
+  ASSERT_THROW(
+    builder.tune(device, "defines: { TILESIZE: [16] }", args, "repeats: 0");
+  );
+}
@@ -1,14 +1,17 @@
 #include <occa.hpp>
+#include <occa/core/memoryPool.hpp>
 #include <occa/tools/testing.hpp>
 
 void testMalloc();
 void testCpuWrapMemory();
 void testSlice();
+void testPool();
 
 int main(const int argc, const char **argv) {
   testMalloc();
   testCpuWrapMemory();
   testSlice();
+  testPool();
 
   return 0;
 }
@@ -116,3 +119,124 @@ void testSlice() {
   }
   ASSERT_SAME_SIZE(device.memoryAllocated(), 0);
 }
+
+void testPool() {
+#define ASSERT_SAME_SIZE(a, b) \
+  ASSERT_EQ((size_t) (a), (size_t) (b))
+
+  // 4 size classes per power of two
+  ASSERT_SAME_SIZE(occa::memoryPool_t::getSizeClass(0, 64), 64);
+  ASSERT_SAME_SIZE(occa::memoryPool_t::getSizeClass(1, 64), 64);
+  ASSERT_SAME_SIZE(occa::memoryPool_t::getSizeClass(65, 64), 128);
+  ASSERT_SAME_SIZE(occa::memoryPool_t::getSizeClass(1000, 64), 1024);
+  ASSERT_SAME_SIZE(occa::memoryPool_t::getSizeClass(1025, 64), 1280);
+  ASSERT_SAME_SIZE(occa::memoryPool_t::getSizeClass(1281, 64), 1536);
+  ASSERT_SAME_SIZE(occa::memoryPool_t::getSizeClass(1 << 20, 64), 1 << 20);
+  ASSERT_SAME_SIZE(occa::memoryPool_t::getSizeClass((1 << 20) + 1, 64),
+                   (1 << 20) + (1 << 18));
+
+  float *data = new float[10];
+  for (int i = 0; i < 10; ++i) {
+    data[i] = i;
+  }
+
+  const char *modes[2] = {"mode: 'Serial'", "mode: 'Emulated'"};
+  for (int m = 0; m < 2; ++m) {
+    occa::device device(modes[m]);
+    const occa::properties poolProps = "pool: true";
+
+    void *ptr;
+    {
+      occa::memory mem = device.malloc<float>(10, data, poolProps);
+      ASSERT_SAME_SIZE(device.memoryAllocated(), 10 * sizeof(float));
+      ASSERT_SAME_SIZE(device.memoryPoolReserved(), 64);
+      ASSERT_SAME_SIZE(device.memoryPoolCached(), 0);
+      ASSERT_SAME_SIZE(mem.size(), 10 * sizeof(float));
+      ptr = mem.ptr();
+
+      float values[10];
+      mem.copyTo(values);
+      for (int i = 0; i < 10; ++i) {
+        ASSERT_EQ(values[i], i);
+      }
+    }
+    // The block is cached instead of freed
+    ASSERT_SAME_SIZE(device.memoryAllocated(), 0);
+    ASSERT_SAME_SIZE(device.memoryPoolReserved(), 64);
+    ASSERT_SAME_SIZE(device.memoryPoolCached(), 64);
+
+    // Same size class reuses the block
+    {
+      occa::memory mem = device.malloc<float>(12, poolProps);
+      ASSERT_EQ(mem.ptr(), ptr);
+      ASSERT_SAME_SIZE(device.memoryPoolHits(), 1);
+      ASSERT_SAME_SIZE(device.memoryPoolMisses(), 1);
+      ASSERT_SAME_SIZE(device.memoryPoolCached(), 0);
+
+      // Live blocks aren't shared
+      occa::memory mem2 = device.malloc<float>(12, poolProps);
+      ASSERT_NEQ(mem2.ptr(), ptr);
+      ASSERT_SAME_SIZE(device.memoryPoolReserved(), 128);
+      ASSERT_SAME_SIZE(device.memoryPoolPeak(), 128);
+    }
+    ASSERT_SAME_SIZE(device.memoryPoolCached(), 128);
+
+    // Different properties don't share blocks
+    {
+      occa::memory mem = device.malloc<float>(12, occa::properties("pool: true, foo: 1"));
+      ASSERT_NEQ(mem.ptr(), ptr);
+      ASSERT_SAME_SIZE(device.memoryPoolReserved(), 192);
+    }
+
+    device.trimMemoryPool(64);
+    ASSERT_SAME_SIZE(device.memoryPoolReserved(), 64);
+    device.trimMemoryPool();
+    ASSERT_SAME_SIZE(device.memoryPoolReserved(), 0);
+    ASSERT_SAME_SIZE(device.memoryPoolCached(), 0);
+
+    // Blocks over the limit get freed
+    {
+      occa::memory mem = device.malloc<char>(1024, occa::properties("pool: true, pool_limit: 2048"));
+      occa::memory mem2 = device.malloc<char>(1024, poolProps);
+    }
+    ASSERT_SAME_SIZE(device.memoryPoolReserved(), 2048);
+    {
+      occa::memory mem = device.malloc<char>(2048, poolProps);
+      ASSERT_SAME_SIZE(device.memoryPoolReserved(), 2048);
+    }
+    device.trimMemoryPool();
+
+    // Pooled sizes and pointers follow the alignment
+    {
+      occa::memory mem = device.malloc<char>(100, occa::properties("pool: true, pool_alignment: 4096"));
+      ASSERT_SAME_SIZE(device.memoryPoolReserved(), 4096);
+      ASSERT_SAME_SIZE(((size_t) mem.ptr()) % 4096, 0);
+    }
+    ASSERT_THROW(
+      device.malloc<char>(100, occa::properties("pool: true, pool_alignment: 100"));
+    );
+
+    // Detached memory leaves the pool
+    {
+      occa::memory mem = device.malloc<char>(128, poolProps);
+      void *detachedPtr = mem.ptr();
+      const occa::udim_t reserved = device.memoryPoolReserved();
+      mem.detach();
+      ASSERT_SAME_SIZE(device.memoryPoolReserved(), reserved - 128);
+      occa::sys::free(detachedPtr);
+    }
+
+    // Host pointers aren't pooled
+    {
+      occa::memory mem = device.malloc<float>(10, data,
+                                              "pool: true, use_host_pointer: true");
+      if (m == 0) {
+        ASSERT_EQ(mem.ptr<float>(), data);
+      }
+    }
+
+    device.free();
+  }
+
+  delete [] data;
+}
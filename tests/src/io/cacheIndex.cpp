@@ -0,0 +1,142 @@
+#include <stdlib.h>
+#include <time.h>
+
+#include <occa/io.hpp>
+#include <occa/tools/env.hpp>
+#include <occa/tools/testing.hpp>
+
+void testCompletion();
+void testDependencies();
+void testRemove();
+void testPartialRecords();
+void testCompaction();
+
+int main(const int argc, const char **argv) {
+  occa::env::OCCA_CACHE_DIR = occa::io::dirname(__FILE__);
+  srand(time(NULL));
+
+  testCompletion();
+  testDependencies();
+  testRemove();
+  testPartialRecords();
+  testCompaction();
+
+  occa::sys::rmrf(occa::io::cachePath());
+  occa::sys::rmdir(occa::env::OCCA_CACHE_DIR + "locks",
+                   true);
+
+  return 0;
+}
+
+std::string randomHashDir() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+  return occa::io::hashDir(hash);
+}
+
+void testCompletion() {
+  const std::string hashDir = randomHashDir();
+
+  ASSERT_FALSE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+
+  occa::io::cacheIndex::markComplete(hashDir, "binary");
+  ASSERT_TRUE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+  ASSERT_FALSE(occa::io::cacheIndex::isComplete(hashDir, "launcher_binary"));
+
+  // Entries are persisted in the index file
+  ASSERT_TRUE(occa::io::isFile(occa::io::cacheIndex::filename()));
+  occa::io::cacheIndex::clear();
+  ASSERT_TRUE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+}
+
+void testDependencies() {
+  const std::string hashDir = randomHashDir();
+
+  occa::io::strHashMap dependencyHashes;
+  ASSERT_FALSE(occa::io::cacheIndex::getDependencyHashes(hashDir,
+                                                         dependencyHashes));
+
+  // Empty dependencies are still recorded
+  occa::io::cacheIndex::setDependencyHashes(hashDir, dependencyHashes);
+  ASSERT_TRUE(occa::io::cacheIndex::getDependencyHashes(hashDir,
+                                                        dependencyHashes));
+  ASSERT_EQ((int) dependencyHashes.size(),
+            0);
+
+  dependencyHashes["/a/b.hpp"] = occa::hash("b");
+  dependencyHashes["/a/c.hpp"] = occa::hash("c");
+  occa::io::cacheIndex::setDependencyHashes(hashDir, dependencyHashes);
+
+  occa::io::cacheIndex::clear();
+
+  occa::io::strHashMap loadedHashes;
+  ASSERT_TRUE(occa::io::cacheIndex::getDependencyHashes(hashDir,
+                                                        loadedHashes));
+  ASSERT_EQ((int) loadedHashes.size(),
+            2);
+  ASSERT_EQ(loadedHashes["/a/b.hpp"],
+            occa::hash("b"));
+  ASSERT_EQ(loadedHashes["/a/c.hpp"],
+            occa::hash("c"));
+}
+
+void testRemove() {
+  const std::string hashDir = randomHashDir();
+
+  occa::io::cacheIndex::markComplete(hashDir, "binary");
+  occa::io::cacheIndex::remove(hashDir);
+  ASSERT_FALSE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+
+  occa::io::cacheIndex::clear();
+  ASSERT_FALSE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+}
+
+void testPartialRecords() {
+  const std::string hashDir = randomHashDir();
+  const std::string &indexFile = occa::io::cacheIndex::filename();
+
+  // Records without a trailing newline are ignored
+  std::string content = occa::io::read(indexFile);
+  content += "C\t" + hashDir.substr(occa::io::cachePath().size()) + "\tbinary";
+  occa::io::write(indexFile, content);
+
+  occa::io::cacheIndex::clear();
+  ASSERT_FALSE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+
+  // The next record replaces the partial one
+  const std::string hashDir2 = randomHashDir();
+  occa::io::cacheIndex::markComplete(hashDir2, "binary");
+
+  occa::io::cacheIndex::clear();
+  ASSERT_FALSE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+  ASSERT_TRUE(occa::io::cacheIndex::isComplete(hashDir2, "binary"));
+}
+
+int countRecords() {
+  const std::string content = occa::io::read(occa::io::cacheIndex::filename());
+  int records = 0;
+  for (int i = 0; i < (int) content.size(); ++i) {
+    records += (content[i] == '\n');
+  }
+  return records;
+}
+
+void testCompaction() {
+  const std::string hashDir = randomHashDir();
+  occa::io::cacheIndex::markComplete(hashDir, "binary");
+
+  // Superseded records are eventually dropped
+  const std::string hashDir2 = randomHashDir();
+  for (int i = 0; i < 1500; ++i) {
+    occa::io::cacheIndex::markComplete(hashDir2, "binary");
+    occa::io::cacheIndex::remove(hashDir2);
+  }
+  ASSERT_LT(countRecords(),
+            1100);
+
+  ASSERT_TRUE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+  ASSERT_FALSE(occa::io::cacheIndex::isComplete(hashDir2, "binary"));
+
+  occa::io::cacheIndex::clear();
+  ASSERT_TRUE(occa::io::cacheIndex::isComplete(hashDir, "binary"));
+  ASSERT_FALSE(occa::io::cacheIndex::isComplete(hashDir2, "binary"));
+}
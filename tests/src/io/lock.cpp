@@ -1,26 +1,40 @@
 #include <stdlib.h>
 #include <time.h>
 #include <unistd.h>
+#include <sys/wait.h>
 
 #include <occa/io.hpp>
 #include <occa/tools/env.hpp>
 #include <occa/tools/testing.hpp>
 
 void testInit();
+void testFileLock();
+void testFileLockCopies();
+void testFileLockWait();
+void testFileLockHolderDies();
 void testAutoRelease();
 void testStaleRelease();
 void clearLocks();
 
 int main(const int argc, const char **argv) {
   occa::env::OCCA_CACHE_DIR = occa::io::dirname(__FILE__);
-  occa::settings()["locks/stale-warning"] = 0;
-  occa::settings()["locks/stale-age"] = 0.2;
+  occa::settings()["locks/stale_warning"] = 0;
+  occa::settings()["locks/stale_age"] = 0.2;
 
   srand(time(NULL));
 
   clearLocks();
 
   testInit();
+
+  // Advisory file locks
+  testFileLock();
+  testFileLockCopies();
+  testFileLockWait();
+  testFileLockHolderDies();
+
+  // Directory locks
+  occa::settings()["locks/file_locks"] = false;
   testAutoRelease();
   testStaleRelease();
 
@@ -34,11 +48,123 @@ void testInit() {
   ASSERT_FALSE(lock.isInitialized());
 }
 
+void testFileLock() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  occa::io::lock_t lock1(hash, "tag");
+  ASSERT_TRUE(lock1.isInitialized());
+  ASSERT_TRUE(lock1.isFileLock());
+  ASSERT_EQ(lock1.filename(),
+            occa::env::OCCA_CACHE_DIR
+            + "locks/"
+            + hash.getString()
+            + "_tag.lock");
+  ASSERT_TRUE(lock1.isMine());
+  ASSERT_TRUE(lock1.isMine());
+
+  // Holder writes its PID
+  ASSERT_EQ(occa::io::read(lock1.filename()),
+            occa::toString(occa::sys::getPID()) + "\n");
+  ASSERT_FALSE(occa::io::isDir(lock1.dir()));
+
+  // Properly released locks are empty
+  lock1.release();
+  ASSERT_EQ(occa::io::read(lock1.filename()),
+            "");
+
+  occa::io::lock_t lock2(hash, "tag");
+  ASSERT_TRUE(lock2.isMine());
+}
+
+void testFileLockCopies() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  occa::io::lock_t lock1(hash, "tag");
+  ASSERT_TRUE(lock1.isMine());
+  {
+    // Copies share the same lock
+    occa::io::lock_t lock2 = lock1;
+    ASSERT_TRUE(lock2.isMine());
+  }
+  // Lock is still held after the copy is destroyed
+  ASSERT_EQ(occa::io::read(lock1.filename()),
+            occa::toString(occa::sys::getPID()) + "\n");
+
+  occa::io::lock_t lock3;
+  lock3 = lock1;
+  lock3.release();
+  ASSERT_EQ(occa::io::read(lock1.filename()),
+            "");
+}
+
+void forkLockHolder(const occa::hash_t &hash,
+                    const bool releaseLock,
+                    pid_t &pid) {
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+
+  pid = ::fork();
+  if (pid == 0) {
+    ::close(fds[0]);
+    occa::io::lock_t lock(hash, "tag");
+    const char isMine = lock.isMine() ? 1 : 0;
+    if (::write(fds[1], &isMine, 1) != 1) {
+      ::_exit(1);
+    }
+    ::usleep(200000);
+    if (releaseLock) {
+      lock.release();
+    }
+    // Skip destructors to simulate a crash if the lock wasn't released
+    ::_exit(0);
+  }
+
+  ::close(fds[1]);
+  char childIsMine = 0;
+  ASSERT_EQ((int) ::read(fds[0], &childIsMine, 1), 1);
+  ::close(fds[0]);
+  ASSERT_EQ((int) childIsMine, 1);
+}
+
+void testFileLockWait() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  pid_t pid;
+  forkLockHolder(hash, true, pid);
+
+  // Wakes up once the holder releases, holder did the work
+  occa::io::lock_t lock(hash, "tag");
+  const double start = occa::sys::currentTime();
+  ASSERT_FALSE(lock.isMine());
+  ASSERT_LT(occa::sys::currentTime() - start,
+            0.5);
+
+  int status;
+  ::waitpid(pid, &status, 0);
+}
+
+void testFileLockHolderDies() {
+  occa::hash_t hash = occa::hash(occa::toString(rand()));
+
+  pid_t pid;
+  forkLockHolder(hash, false, pid);
+
+  // Holder exits without releasing, lock is taken over
+  occa::io::lock_t lock(hash, "tag");
+  ASSERT_TRUE(lock.isMine());
+  ASSERT_EQ(occa::io::read(lock.filename()),
+            occa::toString(occa::sys::getPID()) + "\n");
+
+  int status;
+  ::waitpid(pid, &status, 0);
+}
+
 void testAutoRelease() {
   occa::hash_t hash = occa::hash(occa::toString(rand()));
 
   occa::io::lock_t lock1(hash, "tag");
   ASSERT_TRUE(lock1.isInitialized());
+  ASSERT_FALSE(lock1.isFileLock());
   ASSERT_EQ(lock1.dir(),
             occa::env::OCCA_CACHE_DIR
             + "locks/"
@@ -115,14 +115,16 @@ void testDirMethods() {
   // Find files
   occa::strVector files = occa::io::files(ioDir);
   ASSERT_EQ((int) files.size(),
-            4);
+            5);
   ASSERT_IN(ioDir + "cache.cpp", files);
+  ASSERT_IN(ioDir + "cacheIndex.cpp", files);
   ASSERT_IN(ioDir + "fileOpener.cpp", files);
   ASSERT_IN(ioDir + "lock.cpp", files);
   ASSERT_IN(ioDir + "utils.cpp", files);
 
   // Check if files exists
   ASSERT_TRUE(occa::io::exists(ioDir + "cache.cpp"));
+  ASSERT_TRUE(occa::io::exists(ioDir + "cacheIndex.cpp"));
   ASSERT_TRUE(occa::io::exists(ioDir + "fileOpener.cpp"));
   ASSERT_TRUE(occa::io::exists(ioDir + "lock.cpp"));
   ASSERT_TRUE(occa::io::exists(ioDir + "utils.cpp"));
@@ -72,8 +72,100 @@ void testSharedAnnotation() {
 //======================================
 
 //---[ Barriers ]-----------------------
+int countBarriers(const std::string &str) {
+  parseSource(str);
+  ASSERT_TRUE(parser.success);
+
+  printer pout;
+  parser.root.print(pout);
+  const std::string deviceSource = pout.str();
+
+  int count = 0;
+  size_t pos = deviceSource.find("__syncthreads()");
+  while (pos != std::string::npos) {
+    ++count;
+    pos = deviceSource.find("__syncthreads()", pos + 1);
+  }
+  return count;
+}
+
+#define ASSERT_BARRIER_COUNT(count, innerSource)                \
+  ASSERT_EQ(count,                                              \
+            countBarriers(                                      \
+              "@kernel void foo(const int N, float *a) {\n"     \
+              "  for (int b = 0; b < N; ++b; @outer) {\n"       \
+              "    @shared float s1[16], s2[16];\n"             \
+              innerSource                                       \
+              "  }\n"                                           \
+              "}\n"                                             \
+            ))
+
 void testBarriers() {
-  // Add barriers barrier(CLK_LOCAL_MEM_FENCE)
+  // Read after write
+  ASSERT_BARRIER_COUNT(
+    1,
+    "for (int i = 0; i < 16; ++i; @inner) { s1[i] = a[i]; }\n"
+    "for (int i = 0; i < 16; ++i; @inner) { a[i] = s1[15 - i]; }\n"
+  );
+
+  // Write after read
+  ASSERT_BARRIER_COUNT(
+    2,
+    "for (int i = 0; i < 16; ++i; @inner) { s1[i] = a[i]; }\n"
+    "for (int i = 0; i < 16; ++i; @inner) { a[i] = s1[15 - i]; }\n"
+    "for (int i = 0; i < 16; ++i; @inner) { s1[i] = 0; }\n"
+  );
+
+  // Reads don't need to be synchronized
+  ASSERT_BARRIER_COUNT(
+    1,
+    "for (int i = 0; i < 16; ++i; @inner) { s1[i] = a[i]; }\n"
+    "for (int i = 0; i < 16; ++i; @inner) { a[i] = s1[15 - i]; }\n"
+    "for (int i = 0; i < 16; ++i; @inner) { a[i] += s1[i]; }\n"
+  );
+
+  // Different @shared variables
+  ASSERT_BARRIER_COUNT(
+    0,
+    "for (int i = 0; i < 16; ++i; @inner) { s1[i] = a[i]; }\n"
+    "for (int i = 0; i < 16; ++i; @inner) { s2[i] = a[i]; }\n"
+  );
+
+  // Nothing runs after the last @inner loop
+  ASSERT_BARRIER_COUNT(
+    0,
+    "for (int i = 0; i < 16; ++i; @inner) { s1[i] = a[i]; }\n"
+  );
+
+  // Barriers already in the source
+  ASSERT_BARRIER_COUNT(
+    1,
+    "for (int i = 0; i < 16; ++i; @inner) { s1[i] = a[i]; }\n"
+    "@barrier(\"local\");\n"
+    "for (int i = 0; i < 16; ++i; @inner) { a[i] = s1[15 - i]; }\n"
+  );
+
+  // Phases in a loop also follow the previous iteration
+  ASSERT_BARRIER_COUNT(
+    2,
+    "for (int t = 0; t < 4; ++t) {\n"
+    "  for (int i = 0; i < 16; ++i; @inner) { a[i] += s1[15 - i]; }\n"
+    "  for (int i = 0; i < 16; ++i; @inner) { s1[i] = a[i]; }\n"
+    "}\n"
+  );
+  ASSERT_BARRIER_COUNT(
+    0,
+    "for (int t = 0; t < 4; ++t) {\n"
+    "  for (int i = 0; i < 16; ++i; @inner) { a[i] += 1; }\n"
+    "}\n"
+  );
+
+  // Aliased @shared memory falls back to a barrier after each @inner loop
+  ASSERT_BARRIER_COUNT(
+    2,
+    "for (int i = 0; i < 16; ++i; @inner) { float *p = s1; p[i] = a[i]; }\n"
+    "for (int i = 0; i < 16; ++i; @inner) { a[i] = s2[i]; }\n"
+  );
 }
 //======================================
 
@@ -3,13 +3,25 @@
 #include <occa/lang/modes/openmp.hpp>
 #include "../parserUtils.hpp"
 
+#define ASSERT_IN_SOURCE(str_)                          \
+  ASSERT_NEQ(std::string::npos,                         \
+             parser.toString().find(str_))
+
+#define ASSERT_NOT_IN_SOURCE(str_)                      \
+  ASSERT_EQ(std::string::npos,                          \
+            parser.toString().find(str_))
+
 void testPragma();
+void testCollapse();
+void testSchedule();
 
 int main(const int argc, const char **argv) {
   parser.settings["okl/validate"] = false;
   parser.settings["serial/include_std"] = false;
 
   // testPragma();
+  testCollapse();
+  testSchedule();
 
   return 0;
 }
@@ -35,3 +47,212 @@ void testPragma() {
             ompPragma.value());
 }
 //======================================
+
+//---[ Collapse ]-----------------------
+void testCollapse() {
+  // Perfectly nested @outer loops
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer(1)) {\n"
+    "    for (int i = 0; i < N; ++i; @outer(0)) {\n"
+    "      for (int k = 0; k < 2; ++k; @inner) {\n"
+    "        a[k + 2*(i + N*j)] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp parallel for collapse(2)\n");
+
+  // Statements between @outer loops
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer(1)) {\n"
+    "    const int offset = 2*N*j;\n"
+    "    for (int i = 0; i < N; ++i; @outer(0)) {\n"
+    "      for (int k = 0; k < 2; ++k; @inner) {\n"
+    "        a[k + 2*i + offset] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp parallel for\n");
+  ASSERT_NOT_IN_SOURCE("collapse");
+
+  // Bounds depending on outer iterators
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer(1)) {\n"
+    "    for (int i = 0; i < j; ++i; @outer(0)) {\n"
+    "      for (int k = 0; k < 2; ++k; @inner) {\n"
+    "        a[k + 2*(i + N*j)] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_NOT_IN_SOURCE("collapse");
+
+  // Disabled through properties
+  parser.settings["openmp/collapse"] = false;
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer(1)) {\n"
+    "    for (int i = 0; i < N; ++i; @outer(0)) {\n"
+    "      for (int k = 0; k < 2; ++k; @inner) {\n"
+    "        a[k + 2*(i + N*j)] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_NOT_IN_SOURCE("collapse");
+  parser.settings["openmp/collapse"] = true;
+}
+//======================================
+
+//---[ Schedule ]-----------------------
+void testSchedule() {
+  // From @outer kwargs
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(schedule=\"dynamic\", chunk=4)) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp parallel for schedule(dynamic, 4)\n");
+
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer(1, schedule=\"guided\")) {\n"
+    "    for (int i = 0; i < N; ++i; @outer(0)) {\n"
+    "      for (int k = 0; k < 2; ++k; @inner) {\n"
+    "        a[k + 2*(i + N*j)] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp parallel for collapse(2) schedule(guided)\n");
+
+  // From kernel properties
+  parser.settings["openmp/schedule"] = "static";
+  parser.settings["openmp/chunk"] = 8;
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp parallel for schedule(static, 8)\n");
+
+  // @outer kwargs take precedence
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(schedule=\"dynamic\")) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp parallel for schedule(dynamic, 8)\n");
+
+  parser.settings["openmp/schedule"] = "sometimes";
+  parseBadSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+
+  // Chunk sizes from the properties can't be used with auto/runtime
+  parser.settings["openmp/schedule"] = "runtime";
+  parser.settings["openmp/chunk"] = 4;
+  parseBadSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  parseBadSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(schedule=\"auto\")) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  parser.settings["openmp/schedule"] = "";
+  parser.settings["openmp/chunk"] = 0;
+
+  // Bad kwargs
+  parseBadSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(schedule=\"runtime\", chunk=4)) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  parseBadSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(schedule=\"auto\", chunk=2)) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  parseBadSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(schedule=\"sometimes\")) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  parseBadSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(chunk=0)) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  parseBadSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int i = 0; i < N; ++i; @outer(order=2)) {\n"
+    "    for (int k = 0; k < 2; ++k; @inner) {\n"
+    "      a[k + 2*i] = 0;\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+}
+//======================================
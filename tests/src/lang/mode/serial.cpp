@@ -1,11 +1,22 @@
 #define OCCA_TEST_PARSER_TYPE okl::serialParser
 
+#include <occa.hpp>
 #include <occa/lang/modes/serial.hpp>
+#include <occa/tools/env.hpp>
 #include "../parserUtils.hpp"
 
+#define ASSERT_IN_SOURCE(str_)                          \
+  ASSERT_NEQ(std::string::npos,                         \
+             parser.toString().find(str_))
+
+#define ASSERT_NOT_IN_SOURCE(str_)                      \
+  ASSERT_EQ(std::string::npos,                          \
+            parser.toString().find(str_))
+
 void testPreprocessor();
 void testKernel();
 void testExclusives();
+void testSimd();
 
 int main(const int argc, const char **argv) {
   parser.settings["serial/include_std"] = false;
@@ -14,8 +25,9 @@ int main(const int argc, const char **argv) {
   // testPreprocessor();
   // testKernel();
 
-  // parser.settings["okl/validate"] = true;
-  // testExclusives();
+  parser.settings["okl/validate"] = true;
+  testExclusives();
+  testSimd();
 
   return 0;
 }
@@ -55,7 +67,7 @@ void testExtern() {
 }
 
 void testArgs() {
-  // @kernel args -> by reference
+  // @kernel args -> non-reference arguments stay by value
 #define func       (statement->to<functionDeclStatement>().function)
 #define arg(N)     (*(args[N]))
 #define argType(N) (arg(N).vartype)
@@ -75,8 +87,8 @@ void testArgs() {
 
   ASSERT_EQ("A",
             arg(0).name());
-  ASSERT_NEQ((void*) NULL,
-             argType(0).referenceToken);
+  ASSERT_EQ((void*) NULL,
+            argType(0).referenceToken);
 
   ASSERT_EQ("B",
             arg(1).name());
@@ -94,34 +106,357 @@ void testArgs() {
 //======================================
 
 //---[ @exclusive ]---------------------
+void testExclusivePromotion();
+void testExclusiveFusion();
+void testExclusiveArrays();
+void testExclusiveVectors();
+
 void testExclusives() {
-  // TODO:
-  //   @exclusive ->
-  //     - std::vector<value>
-  //     - vec.reserve(loopIterations)
-  //     - Add iterator index to inner-most @inner loop
-  parseAndPrintSource(
-    "const int var[10];\n"
-    "@kernel void foo(@restrict int * arg) {\n"
-    "  for (int o1 = 0; o1 < O1; ++o1; @outer) {\n"
-    "    for (int o0 = 0; o0 < O0; ++o0; @outer) {\n"
-    "      @shared int shr[3];\n"
-    "      @exclusive int excl;\n"
-    "      if (true) {\n"
-    "        for (int i1 = 0; i1 < I1; ++i1; @inner) {\n"
-    "          for (int i0 = 0; i0 < I0; ++i0; @inner) {\n"
-    "            for (;;) {\n"
-    "               excl = i0;\n"
-    "            }\n"
-    "            for (;;) {\n"
-    "               excl = i0;\n"
-    "            }\n"
-    "          }\n"
+  testExclusivePromotion();
+  testExclusiveFusion();
+  testExclusiveArrays();
+  testExclusiveVectors();
+}
+
+void testExclusivePromotion() {
+  // Only used in one @inner loop -> regular variable
+  parseSource(
+    "@kernel void foo(int *arg) {\n"
+    "  for (int o = 0; o < 10; ++o; @outer) {\n"
+    "    @exclusive int excl = 1;\n"
+    "    for (int i = 0; i < 32; ++i; @inner) {\n"
+    "      excl += i;\n"
+    "      arg[i] = excl;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("int excl = 1;");
+  ASSERT_NOT_IN_SOURCE(okl::serialParser::exclusiveIndexName);
+
+  // Regular loops around the @inner loop need the value to persist
+  const std::string accSource = (
+    "@kernel void foo(const float *a, float *b) {\n"
+    "  for (int o = 0; o < 1; ++o; @outer) {\n"
+    "    @exclusive float acc = 0;\n"
+    "    for (int k = 0; k < 4; ++k) {\n"
+    "      for (int i = 0; i < 16; ++i; @inner) {\n"
+    "        acc += a[k*16 + i];\n"
+    "        b[k*16 + i] = acc;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  parseSource(accSource);
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("float acc[16];");
+  ASSERT_IN_SOURCE("acc[" + okl::serialParser::exclusiveIndexName + "] = 0;");
+
+  occa::device device("mode: 'Serial'");
+  occa::kernel accumulate = device.buildKernelFromString(accSource, "foo");
+
+  float a[64], b[64];
+  for (int i = 0; i < 64; ++i) {
+    a[i] = 1;
+  }
+  occa::memory o_a = device.malloc(64 * sizeof(float), a);
+  occa::memory o_b = device.malloc(64 * sizeof(float));
+  accumulate(o_a, o_b);
+  o_b.copyTo(b);
+  for (int i = 0; i < 64; ++i) {
+    ASSERT_EQ((int) b[i], 1 + (i / 16));
+  }
+  o_a.free();
+  o_b.free();
+  accumulate.free();
+}
+
+void testExclusiveFusion() {
+  // Phases only writing @exclusive values and unseen @restrict
+  //   pointers are fused
+  parseSource(
+    "@kernel void foo(@restrict const int *in, @restrict int *out) {\n"
+    "  for (int o = 0; o < 10; ++o; @outer) {\n"
+    "    @exclusive int excl;\n"
+    "    for (int i = 0; i < 32; ++i; @inner) {\n"
+    "      excl = in[i];\n"
+    "    }\n"
+    "    for (int j = 0; j < 32; ++j; @inner) {\n"
+    "      out[j] = 2 * excl + j;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("int excl;");
+  ASSERT_IN_SOURCE("out[i] = 2 * excl + i;");
+  ASSERT_NOT_IN_SOURCE(okl::serialParser::exclusiveIndexName);
+
+  // @barrier statements are kept
+  parseSource(
+    "@kernel void foo(@restrict const int *in, @restrict int *out) {\n"
+    "  for (int o = 0; o < 10; ++o; @outer) {\n"
+    "    @exclusive int excl;\n"
+    "    for (int i = 0; i < 32; ++i; @inner) {\n"
+    "      excl = in[i];\n"
+    "    }\n"
+    "    @barrier(\"local\");\n"
+    "    for (int j = 0; j < 32; ++j; @inner) {\n"
+    "      out[j] = 2 * excl + j;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("int excl[32];");
+  ASSERT_IN_SOURCE("out[j] = 2 * excl[" + okl::serialParser::exclusiveIndexName + "] + j;");
+
+  // The second phase writes memory the first phase reads
+  const std::string shiftSource = (
+    "@kernel void foo(int *a) {\n"
+    "  for (int o = 0; o < 1; ++o; @outer) {\n"
+    "    @exclusive int ex;\n"
+    "    for (int i = 0; i < 8; ++i; @inner) {\n"
+    "      ex = (i > 0) ? a[i - 1] : 0;\n"
+    "    }\n"
+    "    for (int i = 0; i < 8; ++i; @inner) {\n"
+    "      a[i] = ex;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  parseSource(shiftSource);
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("int ex[8];");
+
+  // Pointers without @restrict could alias the first phase's reads
+  parseSource(
+    "@kernel void foo(const int *in, int *out) {\n"
+    "  for (int o = 0; o < 10; ++o; @outer) {\n"
+    "    @exclusive int excl;\n"
+    "    for (int i = 0; i < 32; ++i; @inner) {\n"
+    "      excl = in[i];\n"
+    "    }\n"
+    "    for (int j = 0; j < 32; ++j; @inner) {\n"
+    "      out[j] = excl;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("int excl[32];");
+
+  // Run the shifting kernel to make sure the result is unchanged
+  occa::device device("mode: 'Serial'");
+  occa::kernel shift = device.buildKernelFromString(shiftSource, "foo");
+
+  int values[8];
+  for (int i = 0; i < 8; ++i) {
+    values[i] = i + 1;
+  }
+  occa::memory o_values = device.malloc(8 * sizeof(int), values);
+  shift(o_values);
+  o_values.copyTo(values);
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_EQ(values[i], i);
+  }
+  o_values.free();
+  shift.free();
+}
+
+void testExclusiveArrays() {
+  // Phases sharing @shared memory keep one value per @inner iteration
+  parseSource(
+    "@kernel void foo(int *arg) {\n"
+    "  for (int o = 0; o < 10; ++o; @outer) {\n"
+    "    @shared int shr[32];\n"
+    "    @exclusive int excl;\n"
+    "    for (int i = 0; i < 32; ++i; @inner) {\n"
+    "      excl = arg[i];\n"
+    "      shr[i] = excl;\n"
+    "    }\n"
+    "    for (int j = 0; j < 32; ++j; @inner) {\n"
+    "      arg[j] = shr[31 - j] + excl;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("int excl[32];");
+  ASSERT_IN_SOURCE("excl[" + okl::serialParser::exclusiveIndexName + "]");
+
+  // Nested @inner loops
+  parseSource(
+    "@kernel void foo(int *arg) {\n"
+    "  for (int o = 0; o < 10; ++o; @outer) {\n"
+    "    @shared int shr[32];\n"
+    "    @exclusive int excl;\n"
+    "    for (int j = 0; j < 4; ++j; @inner) {\n"
+    "      for (int i = 0; i <= 7; ++i; @inner) {\n"
+    "        excl = arg[i];\n"
+    "        shr[i] = excl;\n"
+    "      }\n"
+    "    }\n"
+    "    for (int k = 0; k < 3; ++k; @inner) {\n"
+    "      for (int i = 31; i >= 0; i -= 2; @inner) {\n"
+    "        arg[i] = shr[31 - i] + excl;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("int excl[48];");
+}
+
+void testExclusiveVectors() {
+  // Unknown @inner bounds -> std::vector
+  parseSource(
+    "@kernel void foo(const int N, int *arg) {\n"
+    "  for (int o = 0; o < 10; ++o; @outer) {\n"
+    "    @shared int shr[32];\n"
+    "    @exclusive int excl = 3;\n"
+    "    for (int i = 0; i < N; ++i; @inner) {\n"
+    "      excl += arg[i];\n"
+    "      shr[i] = excl;\n"
+    "    }\n"
+    "    for (int j = 0; j < N; ++j; @inner) {\n"
+    "      arg[j] = shr[N - j] + excl;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("std::vector<int > excl;");
+  ASSERT_IN_SOURCE("if (excl.size() < (size_t) (N - 0)) excl.resize(N - 0, 3);");
+
+  // Arrays are stored by value
+  parseSource(
+    "@kernel void foo(const int N, float *arg) {\n"
+    "  for (int o = 0; o < 10; ++o; @outer) {\n"
+    "    @shared float shr[32];\n"
+    "    @exclusive float excl[2][3];\n"
+    "    for (int i = 0; i < N; ++i; @inner) {\n"
+    "      excl[1][2] = arg[i];\n"
+    "      shr[i] = excl[1][2];\n"
+    "    }\n"
+    "    for (int j = 0; j < N; ++j; @inner) {\n"
+    "      arg[j] = shr[N - j] + excl[1][2];\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#include <array>");
+  ASSERT_IN_SOURCE("std::vector<std::array<std::array<float, 3>, 2> > excl;");
+  ASSERT_IN_SOURCE("excl[" + okl::serialParser::exclusiveIndexName + "][1][2]");
+}
+//======================================
+
+//---[ SIMD ]---------------------------
+void testSimd() {
+  // Inner-most @inner loops
+  parseSource(
+    "@kernel void foo(const int N, @restrict float *a, @restrict const float *b) {\n"
+    "  for (int o = 0; o < N; o += 64; @outer) {\n"
+    "    for (int j = 0; j < 4; ++j; @inner) {\n"
+    "      for (int i = 0; i < 16; ++i; @inner) {\n"
+    "        const int idx = o + (16 * j) + i;\n"
+    "        if (idx < N) {\n"
+    "          a[idx] += b[idx];\n"
     "        }\n"
     "      }\n"
     "    }\n"
     "  }\n"
     "}\n"
   );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp simd\n"
+                   "      for (int i = 0; i < 16; ++i)");
+  ASSERT_NOT_IN_SOURCE("#pragma omp simd\n"
+                       "    for (int j = 0; j < 4; ++j)");
+
+  // @exclusive index
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    @shared float s[16];\n"
+    "    @exclusive float e;\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      e = a[i];\n"
+    "      s[i] = e;\n"
+    "    }\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      a[i] = s[15 - i] + e;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp simd linear("
+                   + okl::serialParser::exclusiveIndexName
+                   + ": 1)\n");
+
+  // Values shared between iterations
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    float sum = 0;\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      sum += a[i];\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_NOT_IN_SOURCE("omp simd");
+
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      if (a[i] < 0) {\n"
+    "        return;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_NOT_IN_SOURCE("omp simd");
+
+  // Aligned @restrict arguments
+  parser.settings["serial/simd_aligned"] = true;
+  parseSource(
+    "@kernel void foo(const int N, @restrict float *a, float *b, @restrict float *c) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      a[i] = b[i];\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_IN_SOURCE("#pragma omp simd aligned(a: "
+                   + occa::toString(occa::env::OCCA_MEM_BYTE_ALIGN)
+                   + ")\n");
+  parser.settings["serial/simd_aligned"] = false;
+
+  // Disabled
+  parser.settings["serial/simd"] = false;
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int o = 0; o < N; ++o; @outer) {\n"
+    "    for (int i = 0; i < 16; ++i; @inner) {\n"
+    "      a[i] = i;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  ASSERT_TRUE(parser.success);
+  ASSERT_NOT_IN_SOURCE("omp simd");
+  parser.settings["serial/simd"] = true;
 }
 //======================================
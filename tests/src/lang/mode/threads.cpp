@@ -0,0 +1,69 @@
+#define OCCA_TEST_PARSER_TYPE okl::threadsParser
+
+#include <occa/lang/modes/threads.hpp>
+#include "../parserUtils.hpp"
+
+void testOuterChunks();
+
+int main(const int argc, const char **argv) {
+  parser.settings["okl/validate"] = true;
+  parser.settings["serial/include_std"] = false;
+
+  testOuterChunks();
+
+  return 0;
+}
+
+//---[ Outer Chunks ]-------------------
+void testOuterChunks() {
+  // Nested @outer loops -> one chunked loop
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 0; i < N; ++i; @outer) {\n"
+    "      for (int k = 0; k < 2; ++k; @inner) {\n"
+    "        a[k + 2*(i + N*j)] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  const std::string source = parser.toString();
+  ASSERT_NEQ(std::string::npos,
+             source.find("#include <occa/modes/threads/pool.hpp>"));
+  ASSERT_NEQ(std::string::npos,
+             source.find("occa::threads::outerLoop(((int64_t) (N - 0)) * ((int64_t) (N - 0)), "
+                         "[&](occa::threads::outerChunk_t &_occa_outer_chunk) {"));
+  ASSERT_NEQ(std::string::npos,
+             source.find("while (occa::threads::outerLoopNext(_occa_outer_chunk))"));
+  ASSERT_NEQ(std::string::npos,
+             source.find("for (int64_t _occa_outer_index = _occa_outer_chunk.start;"));
+  ASSERT_NEQ(std::string::npos,
+             source.find("});"));
+
+  // Only one chunked loop for both @outer loops
+  ASSERT_EQ(std::string::npos,
+            source.find("outerLoop(",
+                        source.find("outerLoop(") + 1));
+
+  // Loop bounds depending on outer iterators are not collapsed
+  parseSource(
+    "@kernel void foo(const int N, float *a) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 0; i < j; ++i; @outer) {\n"
+    "      for (int k = 0; k < 2; ++k; @inner) {\n"
+    "        a[k + 2*(i + N*j)] = 0;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "}"
+  );
+  ASSERT_TRUE(parser.success);
+
+  const std::string triangularSource = parser.toString();
+  ASSERT_NEQ(std::string::npos,
+             triangularSource.find("for (int i = 0; i < j; ++i)"));
+}
+//======================================
@@ -1,11 +1,24 @@
 #include <occa/tools/testing.hpp>
 
+#include <occa.hpp>
 #include <occa/modes.hpp>
+#include <occa/modes/emulated.hpp>
+#include <occa/modes/openmp.hpp>
+#include <occa/modes/serial/stream.hpp>
+#include <occa/modes/threads/device.hpp>
 
 void testMode();
+void testThreadsMode();
+void testEmulatedMode();
+void testOpenMPNuma();
+void testHostStreams();
 
 int main(const int argc, const char **argv) {
   testMode();
+  testThreadsMode();
+  testEmulatedMode();
+  testOpenMPNuma();
+  testHostStreams();
 
   return 0;
 }
@@ -21,3 +34,415 @@ void testMode() {
   ASSERT_EQ(occa::getMode("mode: 'Foo'"),
             serialMode);
 }
+
+void testThreadsMode() {
+  occa::device device("mode: 'Threads', threads: 4, chunk_size: 3");
+  ASSERT_EQ(device.mode(),
+            "Threads");
+  ASSERT_EQ((int) device.properties()["threads"],
+            4);
+
+  // Iterations with uneven work to exercise stealing
+  const std::string source = (
+    "@kernel void irregular(const int N, int *out, int *total) {\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int i = 0; i < 4; ++i; @outer) {\n"
+    "      for (int k = 0; k < 1; ++k; @inner) {\n"
+    "        int sum = 0;\n"
+    "        for (int w = 0; w < (j * j * 100); ++w) {\n"
+    "          sum += (w & 1);\n"
+    "        }\n"
+    "        out[i + 4*j] = sum + i;\n"
+    "      }\n"
+    "    }\n"
+    "  }\n"
+    "  for (int j = 0; j < 1; ++j; @outer) {\n"
+    "    for (int k = 0; k < 1; ++k; @inner) {\n"
+    "      int sum = 0;\n"
+    "      for (int i = 0; i < (4 * N); ++i) {\n"
+    "        sum += out[i];\n"
+    "      }\n"
+    "      total[0] = sum;\n"
+    "    }\n"
+    "  }\n"
+    "}\n"
+  );
+  occa::kernel irregular = device.buildKernelFromString(source,
+                                                        "irregular");
+
+  const int N = 37;
+  int out[4 * N];
+  int total = 0;
+  occa::memory o_out = device.malloc(4 * N * sizeof(int));
+  occa::memory o_total = device.malloc(1 * sizeof(int));
+
+  for (int run = 0; run < 3; ++run) {
+    irregular(N, o_out, o_total);
+    o_out.copyTo(out);
+    o_total.copyTo(&total);
+
+    int expectedTotal = 0;
+    for (int j = 0; j < N; ++j) {
+      for (int i = 0; i < 4; ++i) {
+        const int expected = ((j * j * 100) / 2) + i;
+        ASSERT_EQ(out[i + 4*j], expected);
+        expectedTotal += expected;
+      }
+    }
+    ASSERT_EQ(total, expectedTotal);
+  }
+
+  o_out.free();
+  o_total.free();
+  irregular.free();
+
+  // Code outside of @outer loops runs once per launch
+  occa::kernel counted = device.buildKernelFromString(
+    "@kernel void counted(const int N, int *out, int *counter) {\n"
+    "  counter[0] += 1;\n"
+    "  for (int j = 0; j < N; ++j; @outer) {\n"
+    "    for (int k = 0; k < 1; ++k; @inner) {\n"
+    "      out[j] = counter[0];\n"
+    "    }\n"
+    "  }\n"
+    "}\n",
+    "counted"
+  );
+  int counter = 0;
+  o_out = device.malloc(N * sizeof(int));
+  occa::memory o_counter = device.malloc(sizeof(int), &counter);
+  for (int run = 0; run < 20; ++run) {
+    counted(N, o_out, o_counter);
+  }
+  o_counter.copyTo(&counter);
+  o_out.copyTo(out);
+  ASSERT_EQ(counter, 20);
+  for (int j = 0; j < N; ++j) {
+    ASSERT_EQ(out[j], 20);
+  }
+  o_out.free();
+  o_counter.free();
+  counted.free();
+
+  // Collapsed @outer loops can have more than 2^31 iterations
+  occa::threads::pool_t &pool = *(
+    ((occa::threads::device*) device.getModeDevice())->pool
+  );
+  const int64_t iterations = ((int64_t) 3) << 31;
+  int64_t chunkIterations[4] = {0, 0, 0, 0};
+  int64_t lastIteration = 0;
+  void *args[2] = {chunkIterations, &lastIteration};
+  pool.run(
+    [](void **args) {
+      int64_t *chunkIterations_ = (int64_t*) args[0];
+      int64_t *lastIteration_ = (int64_t*) args[1];
+      occa::threads::outerLoop(((int64_t) 3) << 31,
+                               [&](occa::threads::outerChunk_t &chunk) {
+        while (occa::threads::outerLoopNext(chunk)) {
+          chunkIterations_[chunk.member->id] += chunk.end - chunk.start;
+          if (chunk.end == (((int64_t) 3) << 31)) {
+            *lastIteration_ = chunk.end - 1;
+          }
+        }
+      });
+    },
+    args
+  );
+  ASSERT_EQ(chunkIterations[0] + chunkIterations[1]
+            + chunkIterations[2] + chunkIterations[3],
+            iterations);
+  ASSERT_EQ(lastIteration, iterations - 1);
+
+  device.free();
+}
+
+void testEmulatedMode() {
+  occa::device device("mode: 'Emulated', bandwidth: 10, latency: 5");
+  ASSERT_EQ(device.mode(),
+            "Emulated");
+  ASSERT_TRUE(device.hasSeparateMemorySpace());
+
+  occa::emulated::transferStats_t stats = occa::emulated::getTransferStats(device);
+  ASSERT_EQ(stats.transfers(),
+            (occa::udim_t) 0);
+
+  const int N = 100;
+  const occa::udim_t bytes = N * sizeof(int);
+  int values[N];
+  for (int i = 0; i < N; ++i) {
+    values[i] = i;
+  }
+
+  // Initial values are copied to the device heap
+  occa::memory o_a = device.malloc(bytes, values);
+  ASSERT_NEQ((void*) o_a.ptr(),
+             (void*) values);
+  occa::memory o_b = device.malloc(bytes);
+  o_b.copyFrom(o_a);
+
+  int copies[N];
+  o_b.copyTo(copies);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(copies[i], i);
+  }
+
+  stats = occa::emulated::getTransferStats(device);
+  ASSERT_EQ(stats.hostToDeviceTransfers, (occa::udim_t) 1);
+  ASSERT_EQ(stats.hostToDeviceBytes, bytes);
+  ASSERT_EQ(stats.deviceToDeviceTransfers, (occa::udim_t) 1);
+  ASSERT_EQ(stats.deviceToDeviceBytes, bytes);
+  ASSERT_EQ(stats.deviceToHostTransfers, (occa::udim_t) 1);
+  ASSERT_EQ(stats.deviceToHostBytes, bytes);
+  ASSERT_EQ(stats.bytes(), 3 * bytes);
+
+  // 3 * (5us + (400B / 10GB/s))
+  const double expectedTime = 3 * (5e-6 + (bytes / 1e10));
+  ASSERT_TRUE(stats.transferTime > (0.99 * expectedTime));
+  ASSERT_TRUE(stats.transferTime < (1.01 * expectedTime));
+
+  // UVA pointers are synced before and after kernels
+  occa::emulated::resetTransferStats(device);
+  occa::kernel addOne = device.buildKernelFromString(
+    "@kernel void addOne(const int N, int *a) {\n"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+    "    if (i < N) {\n"
+    "      a[i] += 1;\n"
+    "    }\n"
+    "  }\n"
+    "}\n",
+    "addOne"
+  );
+  int *uvaPtr = device.umalloc<int>(N, values);
+  ASSERT_EQ(occa::emulated::getTransferStats(device).transfers(),
+            (occa::udim_t) 0);
+
+  addOne(N, uvaPtr);
+  device.finish();
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(uvaPtr[i], i + 1);
+  }
+
+  stats = occa::emulated::getTransferStats(device);
+  ASSERT_EQ(stats.hostToDeviceTransfers, (occa::udim_t) 1);
+  ASSERT_EQ(stats.deviceToHostTransfers, (occa::udim_t) 1);
+
+  // Synced memory isn't copied again
+  device.finish();
+  ASSERT_EQ(occa::emulated::getTransferStats(device).transfers(),
+            (occa::udim_t) 2);
+
+  ASSERT_THROW(
+    occa::emulated::getTransferStats(occa::host());
+  );
+
+  occa::freeUvaPtr(uvaPtr);
+  o_a.free();
+  o_b.free();
+  addOne.free();
+  device.free();
+}
+
+void testOpenMPNuma() {
+  const occa::openmp::numaTopology_t &topology = occa::openmp::getSystemNumaTopology();
+  ASSERT_TRUE(topology.nodeCount() > 0);
+  ASSERT_TRUE(topology.hasNode(topology.nodes[0].id));
+  ASSERT_FALSE(topology.hasNode(-1));
+  ASSERT_TRUE(topology.nodes[0].cpus.size() > 0);
+  ASSERT_EQ(topology.getCpuNode(topology.nodes[0].cpus[0]),
+            topology.nodes[0].id);
+
+  ASSERT_EQ(occa::openmp::getNumaPolicy(occa::properties()),
+            occa::openmp::numaPolicy::none);
+  ASSERT_EQ(occa::openmp::getNumaPolicy("numa: 'first_touch'"),
+            occa::openmp::numaPolicy::firstTouch);
+  ASSERT_EQ(occa::openmp::getNumaPolicy("numa: 'interleave'"),
+            occa::openmp::numaPolicy::interleave);
+  ASSERT_EQ(occa::openmp::getNumaPolicy("numa: 'bind'"),
+            occa::openmp::numaPolicy::bind);
+  ASSERT_THROW(
+    occa::openmp::getNumaPolicy("numa: 'foo'");
+  );
+
+  if (!occa::modeIsEnabled("OpenMP")) {
+    return;
+  }
+
+  occa::device device("mode: 'OpenMP'");
+  ASSERT_EQ(occa::openmp::getNumaTopology(device).nodeCount(),
+            topology.nodeCount());
+  ASSERT_THROW(
+    occa::openmp::getNumaTopology(occa::host());
+  );
+
+  const int N = 3 * (1 << 12) + 5;
+  int *values = new int[N];
+  for (int i = 0; i < N; ++i) {
+    values[i] = i;
+  }
+
+  const char *policies[3] = {
+    "numa: 'first_touch'",
+    "numa: 'interleave'",
+    "numa: 'bind'",
+  };
+  for (int p = 0; p < 3; ++p) {
+    const occa::properties props = policies[p];
+
+    occa::memory mem = device.malloc<int>(N, values, props);
+    const int *ptr = (const int*) mem.ptr();
+    ASSERT_EQ(((size_t) ptr) % occa::dirtyPageTracker_t::getPageSize(),
+              (size_t) 0);
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(ptr[i], i);
+    }
+    if (topology.policiesSupported
+        && (p == 2)) {
+      ASSERT_EQ(occa::openmp::getPtrNumaNode(ptr), 0);
+    }
+    mem.free();
+
+    // Pages are zeroed without a source
+    mem = device.malloc<int>(N, props);
+    ptr = (const int*) mem.ptr();
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(ptr[i], 0);
+    }
+    mem.free();
+  }
+
+  ASSERT_THROW(
+    device.malloc<int>(N, occa::properties("numa: 'bind', numa_node: -1"));
+  );
+
+  delete [] values;
+  device.free();
+}
+
+class throwingTask_t : public occa::serial::streamTask_t {
+public:
+  virtual void run() {
+    OCCA_FORCE_ERROR("Queued work failed");
+  }
+};
+
+void testHostStreams() {
+  // Slow enough that launches return long before it ends
+  const std::string source = (
+    "@kernel void slowAddOne(const int N, const int work, int *a) {\n"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+    "    double acc = 0;\n"
+    "    for (int w = 0; w < work; ++w) {\n"
+    "      acc += sqrt(acc + w);\n"
+    "    }\n"
+    "    a[i] += 1 + (acc < 0);\n"
+    "  }\n"
+    "}\n"
+  );
+  const int N = 16;
+  const int work = 2000000;
+
+  const char *modes[2] = {"mode: 'Serial'", "mode: 'Threads', threads: 2"};
+  for (int m = 0; m < 2; ++m) {
+    occa::device device(modes[m]);
+    occa::kernel slowAddOne = device.buildKernelFromString(source, "slowAddOne");
+
+    int values[N], results[N];
+    for (int i = 0; i < N; ++i) {
+      values[i] = i;
+    }
+    occa::memory o_a = device.malloc<int>(N, values);
+
+    // The initial stream is synchronous
+    occa::stream syncStream = device.getStream();
+    slowAddOne(N, work, o_a);
+    ASSERT_EQ(((int*) o_a.ptr())[0], 1);
+
+    occa::stream asyncStream = device.createStream();
+    device.setStream(asyncStream);
+
+    occa::streamTag startTag = device.tagStream();
+    slowAddOne(N, work, o_a);
+    // Queued behind the kernel
+    o_a.copyTo(results, occa::properties("async: true"));
+    occa::streamTag endTag = device.tagStream();
+
+    ASSERT_EQ(((int*) o_a.ptr())[0], 1);
+
+    device.waitFor(endTag);
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(results[i], i + 2);
+    }
+    ASSERT_TRUE(device.timeBetween(startTag, endTag) > 0);
+
+    // Async copies from the host run in order with kernels
+    o_a.copyFrom(values, occa::properties("async: true"));
+    slowAddOne(N, work, o_a);
+    device.finish();
+    ASSERT_EQ(((int*) o_a.ptr())[N - 1], N);
+
+    // Synchronous copies wait for queued work on every stream
+    slowAddOne(N, work, o_a);
+    device.setStream(syncStream);
+    o_a.copyTo(results);
+    ASSERT_EQ(results[0], 2);
+
+    // Streams can opt out of running asynchronously
+    device.setStream(device.createStream(occa::properties("async: false")));
+    slowAddOne(N, work, o_a);
+    ASSERT_EQ(((int*) o_a.ptr())[0], 3);
+
+    // Freeing a stream runs its queued work
+    occa::stream tmpStream = device.createStream();
+    device.setStream(tmpStream);
+    slowAddOne(N, work, o_a);
+    device.setStream(syncStream);
+    tmpStream.free();
+    ASSERT_EQ(((int*) o_a.ptr())[0], 4);
+
+    // Pooled blocks are only reused once queued work is done with them
+    device.setStream(asyncStream);
+    occa::memory o_pooled = device.malloc<int>(N, values, occa::properties("pool: true"));
+    const void *pooledPtr = o_pooled.ptr();
+    slowAddOne(N, work, o_pooled);
+    o_pooled.free();
+
+    occa::memory o_reused = device.malloc<int>(N, occa::properties("pool: true"));
+    ASSERT_EQ(o_reused.ptr(), pooledPtr);
+    int *reusedPtr = (int*) o_reused.ptr();
+    for (int i = 0; i < N; ++i) {
+      reusedPtr[i] = 0;
+    }
+    device.finish();
+    for (int i = 0; i < N; ++i) {
+      ASSERT_EQ(reusedPtr[i], 0);
+    }
+    o_reused.free();
+
+    // Exceptions in queued work are rethrown on the caller's thread
+    occa::serial::stream *hostStream = (
+      (occa::serial::stream*) asyncStream.getModeStream()
+    );
+    hostStream->enqueue(new throwingTask_t());
+    occa::streamTag errorTag = device.tagStream();
+    // Later work still runs
+    slowAddOne(N, work, o_a);
+    ASSERT_THROW(device.waitFor(errorTag));
+    ASSERT_THROW(device.finish());
+    ASSERT_EQ(((int*) o_a.ptr())[0], 5);
+
+    // Errors are only reported once
+    slowAddOne(N, work, o_a);
+    device.finish();
+    ASSERT_EQ(((int*) o_a.ptr())[0], 6);
+
+    // Synchronous work reports errors from every async stream
+    hostStream->enqueue(new throwingTask_t());
+    device.setStream(syncStream);
+    ASSERT_THROW(o_a.copyTo(results));
+
+    o_a.free();
+    slowAddOne.free();
+    asyncStream.free();
+    device.free();
+  }
+}
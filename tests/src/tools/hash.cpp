@@ -0,0 +1,103 @@
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+void testInit();
+void testStreaming();
+void testDistinct();
+void testStringFormat();
+void testHashFile();
+
+int main(const int argc, const char **argv) {
+  testInit();
+  testStreaming();
+  testDistinct();
+  testStringFormat();
+  testHashFile();
+
+  return 0;
+}
+
+void testInit() {
+  occa::hash_t hash;
+  ASSERT_FALSE(hash.isInitialized());
+
+  hash = occa::hash("");
+  ASSERT_TRUE(hash.isInitialized());
+
+  ASSERT_EQ(occa::hash("foo"),
+            occa::hash(std::string("foo")));
+}
+
+void testStreaming() {
+  std::string content;
+  for (int i = 0; i < 1000; ++i) {
+    content += (char) ('a' + (i % 26));
+  }
+  const occa::hash_t fullHash = occa::hash(content);
+
+  // Split the input at every offset around the stripe size
+  for (int chunk = 1; chunk < 70; ++chunk) {
+    occa::hasher_t hasher;
+    for (size_t i = 0; i < content.size(); i += chunk) {
+      hasher.update(content.substr(i, chunk));
+    }
+    ASSERT_EQ(hasher.digest(),
+              fullHash);
+  }
+
+  // Digest doesn't modify the state
+  occa::hasher_t hasher;
+  hasher.update(content.substr(0, 17));
+  hasher.digest();
+  hasher.update(content.substr(17));
+  ASSERT_EQ(hasher.digest(),
+            fullHash);
+
+  hasher.reset();
+  ASSERT_EQ(hasher.digest(),
+            occa::hash(""));
+}
+
+void testDistinct() {
+  // Length and trailing bytes should change the hash
+  ASSERT_NEQ(occa::hash(""),
+             occa::hash(std::string(1, '\0')));
+  ASSERT_NEQ(occa::hash(std::string(32, '\0')),
+             occa::hash(std::string(64, '\0')));
+  ASSERT_NEQ(occa::hash("abc"),
+             occa::hash("acb"));
+
+  // Every word of the hash should depend on every input byte
+  const std::string base(64, 'x');
+  const occa::hash_t baseHash = occa::hash(base);
+  for (int i = 0; i < (int) base.size(); ++i) {
+    std::string flipped = base;
+    flipped[i] = 'y';
+    const occa::hash_t flippedHash = occa::hash(flipped);
+    for (int j = 0; j < 8; ++j) {
+      ASSERT_NEQ(flippedHash.h[j],
+                 baseHash.h[j]);
+    }
+  }
+}
+
+void testStringFormat() {
+  const occa::hash_t hash = occa::hash("foo");
+
+  const std::string fullString = hash.getFullString();
+  ASSERT_EQ((int) fullString.size(),
+            64);
+  ASSERT_EQ(hash.getString(),
+            fullString.substr(0, 16));
+
+  ASSERT_EQ(occa::hash_t::fromString(fullString),
+            hash);
+}
+
+void testHashFile() {
+  const std::string filename = (
+    occa::env::OCCA_DIR + "tests/files/addVectors.okl"
+  );
+  ASSERT_EQ(occa::hashFile(filename),
+            occa::hash(occa::io::read(filename)));
+}
@@ -2,6 +2,7 @@
 
 #include <occa/io.hpp>
 #include <occa/tools/json.hpp>
+#include <occa/tools/properties.hpp>
 #include <occa/tools/string.hpp>
 #include <occa/tools/testing.hpp>
 
@@ -13,6 +14,7 @@ void testArray();
 void testKeywords();
 void testSetters();
 void testMethods();
+void testCopies();
 void testSize();
 void testTruthyValues();
 void testComparisons();
@@ -28,6 +30,7 @@ int main(const int argc, const char **argv) {
   testKeywords();
   testSetters();
   testMethods();
+  testCopies();
   testSize();
   testTruthyValues();
   testComparisons();
@@ -318,6 +321,73 @@ void testMethods() {
   ASSERT_FALSE(j["hi"].isInitialized());
 }
 
+void testCopies() {
+  occa::json j = occa::json::parse(
+    "{ a: 1, b: { b1: 2, b2: [0, 1] } }"
+  );
+
+  // Modifying a copy leaves the original untouched
+  occa::json copy = j;
+  copy["a"] = 10;
+  copy["b/b1"] = 20;
+  copy["b/b2"] += 2;
+  copy["c"] = "c";
+
+  ASSERT_EQ(1, (int) j["a"]);
+  ASSERT_EQ(2, (int) j["b/b1"]);
+  ASSERT_EQ(2, j["b/b2"].size());
+  ASSERT_FALSE(j.has("c"));
+
+  ASSERT_EQ(10, (int) copy["a"]);
+  ASSERT_EQ(20, (int) copy["b/b1"]);
+  ASSERT_EQ(3, copy["b/b2"].size());
+  ASSERT_EQ("c", copy["c"].string());
+
+  // Modifying the original leaves the copy untouched
+  occa::json copy2 = j;
+  j.remove("b/b1");
+  j["b/b2"].array().clear();
+
+  ASSERT_TRUE(copy2.has("b/b1"));
+  ASSERT_EQ(2, copy2["b/b2"].size());
+
+  // References held before copying only change the original
+  occa::json p = occa::json::parse("{ k: 0, o: { k: 0 }, a: [0] }");
+  occa::json &pk = p["k"];
+  occa::json &pok = p["o/k"];
+  occa::jsonArray &pa = p["a"].array();
+  occa::json q = p;
+  pk = 1;
+  pok = 1;
+  pa.push_back(1);
+
+  ASSERT_EQ(0, (int) q["k"]);
+  ASSERT_EQ(0, (int) q["o/k"]);
+  ASSERT_EQ(1, q["a"].size());
+  ASSERT_EQ(1, (int) p["k"]);
+  ASSERT_EQ(1, (int) p["o/k"]);
+  ASSERT_EQ(2, p["a"].size());
+
+  // Merges only change the left-hand side
+  occa::properties left("a: 1, b: { b1: 2 }");
+  occa::properties right("b: { b2: 3 }");
+  occa::properties sum = left + right;
+  ASSERT_FALSE(left.has("b/b2"));
+  ASSERT_EQ(2, (int) sum["b/b1"]);
+  ASSERT_EQ(3, (int) sum["b/b2"]);
+
+  // Appending an array to itself
+  occa::json array = occa::json::parse("[1, 2]");
+  array += array;
+  ASSERT_EQ(3, array.size());
+  ASSERT_EQ(2, array[2].size());
+
+  // Assigning a child to its parent
+  j = occa::json::parse("{ a: { b: 1 } }");
+  j = j["a"];
+  ASSERT_EQ(1, (int) j["b"]);
+}
+
 void testSize() {
   occa::json j = occa::json::parse(
     "{"
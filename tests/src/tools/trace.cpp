@@ -0,0 +1,179 @@
+#include <stdlib.h>
+#include <time.h>
+
+#include <occa.hpp>
+#include <occa/tools/testing.hpp>
+
+void testDisabled();
+void testMemoryEvents();
+void testKernelEvents();
+void testChromeTrace();
+
+const std::string addOneSource = (
+  "@kernel void addOne(const int N, float *a) {"
+  "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {"
+  "    a[i] += TRACE_TEST_VALUE;"
+  "  }"
+  "}"
+);
+
+int main(const int argc, const char **argv) {
+  srand(time(NULL));
+
+  testDisabled();
+  testMemoryEvents();
+  testKernelEvents();
+  testChromeTrace();
+
+  return 0;
+}
+
+int countEvents(const std::vector<occa::trace::event_t> &events,
+                const std::string &name) {
+  int count = 0;
+  for (int i = 0; i < (int) events.size(); ++i) {
+    count += (events[i].name == name);
+  }
+  return count;
+}
+
+void testDisabled() {
+  occa::trace::disable();
+  occa::trace::clear();
+
+  occa::device device("mode: 'Serial'");
+  occa::memory mem = device.malloc<float>(10);
+  mem.free();
+
+  ASSERT_EQ((int) occa::trace::getEvents().size(),
+            0);
+}
+
+void testMemoryEvents() {
+  occa::trace::clear();
+
+  occa::device device("mode: 'Serial', trace: true");
+  ASSERT_TRUE(occa::trace::isEnabled());
+
+  float values[10];
+  for (int i = 0; i < 10; ++i) {
+    values[i] = i;
+  }
+
+  occa::memory mem = device.malloc<float>(10);
+  mem.copyFrom(values);
+  mem.copyTo(values);
+  occa::memory slice = mem + 5;
+  slice.free();
+  mem.free();
+
+  std::vector<occa::trace::event_t> mallocs = occa::trace::getEvents(occa::trace::category::malloc);
+  ASSERT_EQ((int) mallocs.size(),
+            1);
+  ASSERT_EQ(mallocs[0].bytes,
+            (occa::udim_t) (10 * sizeof(float)));
+
+  std::vector<occa::trace::event_t> copies = occa::trace::getEvents(occa::trace::category::copy);
+  ASSERT_EQ((int) copies.size(),
+            2);
+  ASSERT_EQ(copies[0].name,
+            "host to device");
+  ASSERT_EQ(copies[1].name,
+            "device to host");
+  ASSERT_EQ(copies[1].bytes,
+            (occa::udim_t) (10 * sizeof(float)));
+
+  // Freeing the slice doesn't free an allocation
+  std::vector<occa::trace::event_t> frees = occa::trace::getEvents(occa::trace::category::free);
+  ASSERT_EQ((int) frees.size(),
+            1);
+
+  for (int i = 0; i < (int) copies.size(); ++i) {
+    ASSERT_TRUE(copies[i].start >= mallocs[0].start);
+    ASSERT_TRUE(copies[i].duration >= 0);
+  }
+
+  occa::trace::clear();
+  ASSERT_EQ((int) occa::trace::getEvents().size(),
+            0);
+}
+
+void testKernelEvents() {
+  occa::trace::clear();
+
+  occa::device device("mode: 'Serial', trace: true");
+
+  // Force a fresh build to see every build phase
+  occa::properties props;
+  props["defines/TRACE_TEST_VALUE"] = 1 + (rand() % 1000000);
+
+  occa::kernel addOne = device.buildKernelFromString(addOneSource,
+                                                     "addOne",
+                                                     props);
+
+  std::vector<occa::trace::event_t> builds = occa::trace::getEvents(occa::trace::category::build);
+  ASSERT_EQ(countEvents(builds, "hash"),
+            1);
+  ASSERT_EQ(countEvents(builds, "parse"),
+            1);
+  ASSERT_EQ(countEvents(builds, "translate"),
+            1);
+  ASSERT_EQ(countEvents(builds, "compile"),
+            1);
+  ASSERT_EQ(countEvents(builds, "dlopen"),
+            1);
+  ASSERT_EQ(countEvents(builds, "addOne"),
+            1);
+
+  occa::memory mem = device.malloc<float>(40);
+  addOne(40, mem);
+  addOne(40, mem);
+
+  std::vector<occa::trace::event_t> launches = occa::trace::getEvents(occa::trace::category::launch);
+  ASSERT_EQ((int) launches.size(),
+            2);
+  ASSERT_EQ(launches[0].name,
+            "addOne");
+  ASSERT_EQ((int) launches[0].args["arguments"],
+            2);
+
+  occa::kernelArgPack pack = addOne.bind(40, mem);
+  pack.run();
+  ASSERT_EQ((int) occa::trace::getEvents(occa::trace::category::launch).size(),
+            3);
+
+  mem.free();
+  addOne.free();
+}
+
+void testChromeTrace() {
+  occa::trace::clear();
+
+  occa::device device("mode: 'Serial', trace: true");
+  occa::memory mem = device.malloc<float>(10);
+  mem.free();
+
+  occa::json trace = occa::trace::toChromeTrace();
+  occa::json &traceEvents = trace["traceEvents"];
+  ASSERT_TRUE(traceEvents.isArray());
+  ASSERT_EQ(traceEvents.size(),
+            2);
+
+  occa::json &mallocEvent = traceEvents[0];
+  ASSERT_EQ((std::string) mallocEvent["ph"],
+            "X");
+  ASSERT_EQ((std::string) mallocEvent["cat"],
+            "malloc");
+  ASSERT_EQ((int) mallocEvent["args"]["bytes"],
+            (int) (10 * sizeof(float)));
+
+  const std::string filename = "occa_trace_test.json";
+  occa::trace::writeChromeTrace(filename);
+  occa::json written = occa::json::read(filename);
+  ASSERT_EQ(written["traceEvents"].size(),
+            2);
+  occa::sys::rmrf(filename);
+
+  occa::trace::disable();
+  occa::trace::clear();
+}
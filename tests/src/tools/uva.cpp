@@ -1,15 +1,31 @@
+#include <occa/defines.hpp>
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
+
 #include <occa/tools/testing.hpp>
 
 #include <occa.hpp>
+#include <occa/modes/emulated.hpp>
 
 void testPtrRange();
+void testUvaIndex();
+void testUvaIndexThreads();
 void testUva();
 void testUvaNull();
+void testDirtyPages();
+void testDirtyPageBatches();
 
 int main(const int argc, const char **argv) {
   testPtrRange();
+  testUvaIndex();
+  testUvaIndexThreads();
   testUva();
   testUvaNull();
+  testDirtyPages();
+  testDirtyPageBatches();
 
   return 0;
 }
@@ -64,6 +80,113 @@ void testPtrRange() {
   std::cout << "Testing ptrRange output: " << range << '\n';
 }
 
+occa::modeMemory_t* fakeMemory(const size_t id) {
+  return (occa::modeMemory_t*) id;
+}
+
+void testUvaIndex() {
+  occa::uvaIndex_t index;
+  char buffer[100];
+
+  index.insert(buffer, 10, fakeMemory(1));
+  index.insert(buffer + 20, 10, fakeMemory(2));
+  // Empty ranges only match their pointer
+  index.insert(buffer + 30, 0, fakeMemory(3));
+  ASSERT_EQ(index.size(),
+            (size_t) 3);
+
+  ASSERT_EQ(index.find(buffer), fakeMemory(1));
+  ASSERT_EQ(index.find(buffer + 9), fakeMemory(1));
+  ASSERT_EQ(index.find(buffer + 10), fakeMemory(0));
+  ASSERT_EQ(index.find(buffer + 25), fakeMemory(2));
+  ASSERT_EQ(index.find(buffer + 30), fakeMemory(3));
+  ASSERT_EQ(index.find(buffer + 31), fakeMemory(0));
+
+  // Cached hits are dropped once the index changes
+  ASSERT_EQ(index.find(buffer + 5), fakeMemory(1));
+  ASSERT_TRUE(index.erase(buffer + 5));
+  ASSERT_EQ(index.find(buffer + 5), fakeMemory(0));
+  ASSERT_FALSE(index.erase(buffer + 5));
+
+  // Overlapping entries are replaced
+  index.insert(buffer + 15, 10, fakeMemory(4));
+  ASSERT_EQ(index.size(),
+            (size_t) 2);
+  ASSERT_EQ(index.find(buffer + 15), fakeMemory(4));
+  ASSERT_EQ(index.find(buffer + 27), fakeMemory(0));
+  ASSERT_EQ(index.find(buffer + 30), fakeMemory(3));
+
+  // Indices don't share cached hits
+  occa::uvaIndex_t otherIndex;
+  otherIndex.insert(buffer + 15, 10, fakeMemory(5));
+  ASSERT_EQ(index.find(buffer + 16), fakeMemory(4));
+  ASSERT_EQ(otherIndex.find(buffer + 16), fakeMemory(5));
+  ASSERT_EQ(index.find(buffer + 16), fakeMemory(4));
+}
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+const int indexThreads = 4;
+const int indexEntries = 1000;
+
+class indexThreadData_t {
+public:
+  occa::uvaIndex_t *index;
+  char *buffer;
+  int id;
+  int failures;
+};
+
+void* runIndexThread(void *dataPtr) {
+  indexThreadData_t &data = *((indexThreadData_t*) dataPtr);
+  occa::uvaIndex_t &index = *(data.index);
+
+  for (int i = 0; i < indexEntries; ++i) {
+    const int entry = (data.id * indexEntries) + i;
+    index.insert(data.buffer + (8 * entry), 8, fakeMemory(entry + 1));
+  }
+  for (int i = 0; i < indexEntries; ++i) {
+    const int entry = (data.id * indexEntries) + i;
+    if (index.find(data.buffer + (8 * entry) + 7) != fakeMemory(entry + 1)) {
+      ++data.failures;
+    }
+    // Keep odd entries
+    if (!(i % 2) && !index.erase(data.buffer + (8 * entry))) {
+      ++data.failures;
+    }
+  }
+  for (int i = 0; i < indexEntries; ++i) {
+    const int entry = (data.id * indexEntries) + i;
+    if (index.find(data.buffer + (8 * entry)) != fakeMemory((i % 2) ? (entry + 1) : 0)) {
+      ++data.failures;
+    }
+  }
+  return NULL;
+}
+#endif
+
+void testUvaIndexThreads() {
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+  occa::uvaIndex_t index;
+  std::vector<char> buffer(8 * indexThreads * indexEntries);
+
+  pthread_t threads[indexThreads];
+  indexThreadData_t data[indexThreads];
+  for (int t = 0; t < indexThreads; ++t) {
+    data[t].index = &index;
+    data[t].buffer = &(buffer[0]);
+    data[t].id = t;
+    data[t].failures = 0;
+    pthread_create(&threads[t], NULL, runIndexThread, &data[t]);
+  }
+  for (int t = 0; t < indexThreads; ++t) {
+    pthread_join(threads[t], NULL);
+    ASSERT_EQ(data[t].failures, 0);
+  }
+  ASSERT_EQ(index.size(),
+            (size_t) (indexThreads * indexEntries / 2));
+#endif
+}
+
 void testUva() {
   int *ptr = occa::umalloc<int>(10);
 
@@ -140,3 +263,212 @@ void testUvaNull() {
 
   delete [] ptr;
 }
+
+void testDirtyPages() {
+  occa::device device("mode: 'Emulated'");
+
+  const int pageEntries = (int) (occa::dirtyPageTracker_t::getPageSize() / sizeof(int));
+  const int pages = 8;
+  const int N = pages * pageEntries;
+
+  occa::kernel addOne = device.buildKernelFromString(
+    "@kernel void addOne(const int N, int *a) {\n"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+    "    if (i < N) {\n"
+    "      a[i] += 1;\n"
+    "    }\n"
+    "  }\n"
+    "}\n",
+    "addOne"
+  );
+
+  int *ptr = device.umalloc<int>(N, occa::properties("dirty_pages: true,"
+                                                     "dirty_page_method: 'write_faults'"));
+  occa::modeMemory_t *modeMemory = occa::uvaToMemory(ptr);
+  occa::dirtyPageTracker_t *tracker = modeMemory->dirtyPages;
+
+  ASSERT_NEQ(tracker,
+             (occa::dirtyPageTracker_t*) NULL);
+  ASSERT_EQ(((occa::udim_t) ptr) % tracker->pageSize,
+            (occa::udim_t) 0);
+  ASSERT_FALSE(tracker->isTracking());
+
+  for (int i = 0; i < N; ++i) {
+    ptr[i] = i;
+  }
+
+  // The first launch copies the whole buffer
+  occa::resetDirtyPageStats();
+  occa::emulated::resetTransferStats(device);
+
+  addOne(N, ptr);
+  device.finish();
+
+  occa::dirtyPageStats_t stats = occa::getDirtyPageStats();
+  ASSERT_EQ(stats.fullSyncs, (occa::udim_t) 1);
+  ASSERT_EQ(stats.partialSyncs, (occa::udim_t) 0);
+  ASSERT_EQ(occa::emulated::getTransferStats(device).hostToDeviceBytes,
+            (occa::udim_t) (N * sizeof(int)));
+  ASSERT_TRUE(tracker->isTracking());
+
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(ptr[i], i + 1);
+  }
+  ASSERT_EQ(tracker->dirtyPageCount(),
+            (occa::udim_t) 0);
+
+  // Touch pages 2, 3 and 6
+  ptr[2 * pageEntries] = 0;
+  ptr[3 * pageEntries + 1] = 0;
+  ptr[4 * pageEntries - 1] = 0;
+  ptr[6 * pageEntries + 5] = 0;
+  ASSERT_EQ(tracker->dirtyPageCount(),
+            (occa::udim_t) 3);
+  ASSERT_TRUE(tracker->isDirty(2));
+  ASSERT_FALSE(tracker->isDirty(4));
+
+  std::vector<occa::udim_t> offsets, rangeBytes;
+  tracker->getDirtyRanges(offsets, rangeBytes);
+  ASSERT_EQ((int) offsets.size(), 2);
+  ASSERT_EQ(offsets[0], 2 * tracker->pageSize);
+  ASSERT_EQ(rangeBytes[0], 2 * tracker->pageSize);
+  ASSERT_EQ(offsets[1], 6 * tracker->pageSize);
+  ASSERT_EQ(rangeBytes[1], tracker->pageSize);
+
+  // Only the dirty pages are copied
+  occa::emulated::resetTransferStats(device);
+  addOne(N, ptr);
+  device.finish();
+
+  stats = occa::getDirtyPageStats();
+  ASSERT_EQ(stats.faults, (occa::udim_t) 3);
+  ASSERT_EQ(stats.partialSyncs, (occa::udim_t) 1);
+  ASSERT_EQ(stats.pagesSynced, (occa::udim_t) 3);
+  ASSERT_EQ(stats.bytesSkipped, 5 * tracker->pageSize);
+  ASSERT_EQ(occa::emulated::getTransferStats(device).hostToDeviceBytes,
+            3 * tracker->pageSize);
+
+  for (int i = 0; i < N; ++i) {
+    if ((i == 2 * pageEntries)
+        || (i == 3 * pageEntries + 1)
+        || (i == 4 * pageEntries - 1)
+        || (i == 6 * pageEntries + 5)) {
+      ASSERT_EQ(ptr[i], 1);
+    } else {
+      ASSERT_EQ(ptr[i], i + 2);
+    }
+  }
+
+  // Explicit partial syncs fall back to copying the whole buffer
+  occa::syncToHost(ptr, sizeof(int));
+  ASSERT_FALSE(tracker->isTracking());
+  ptr[0] = 0;
+
+  occa::resetDirtyPageStats();
+  addOne(N, ptr);
+  device.finish();
+  ASSERT_EQ(occa::getDirtyPageStats().fullSyncs, (occa::udim_t) 1);
+  ASSERT_EQ(ptr[0], 1);
+
+  occa::freeUvaPtr(ptr);
+
+  // Untracked memory keeps whole-buffer syncs
+  ptr = device.umalloc<int>(N);
+  ASSERT_EQ(occa::uvaToMemory(ptr)->dirtyPages,
+            (occa::dirtyPageTracker_t*) NULL);
+  occa::freeUvaPtr(ptr);
+
+  addOne.free();
+  device.free();
+}
+
+void testDirtyPageBatches() {
+  occa::device device("mode: 'Emulated'");
+
+  const int pageEntries = (int) (occa::dirtyPageTracker_t::getPageSize() / sizeof(int));
+  const int N = 4 * pageEntries;
+
+  occa::kernel addOne = device.buildKernelFromString(
+    "@kernel void addOne(const int N, int *a, int *b) {\n"
+    "  for (int i = 0; i < N; ++i; @tile(16, @outer, @inner)) {\n"
+    "    if (i < N) {\n"
+    "      a[i] += 1;\n"
+    "      b[i] += 1;\n"
+    "    }\n"
+    "  }\n"
+    "}\n",
+    "addOne"
+  );
+
+  // Soft-dirty bits are the default, write faults break system calls
+  //   writing into tracked buffers
+  const bool hasSoftDirty = occa::dirtyPageTracker_t::isSupported(
+    occa::dirtyPageMethod::softDirty
+  );
+  const int method = (hasSoftDirty
+                      ? occa::dirtyPageMethod::softDirty
+                      : occa::dirtyPageMethod::writeFaults);
+
+  int *a = device.umalloc<int>(N, occa::properties("dirty_pages: true"));
+  int *b = device.umalloc<int>(N, occa::properties("dirty_pages: true"));
+  int *c = device.umalloc<int>(N, occa::properties("dirty_pages: true"));
+  occa::dirtyPageTracker_t *aPages = occa::uvaToMemory(a)->dirtyPages;
+  occa::dirtyPageTracker_t *bPages = occa::uvaToMemory(b)->dirtyPages;
+  occa::dirtyPageTracker_t *cPages = occa::uvaToMemory(c)->dirtyPages;
+  ASSERT_EQ(aPages->method, method);
+
+  for (int i = 0; i < N; ++i) {
+    a[i] = b[i] = c[i] = i;
+  }
+
+  // Buffers synced by the same launch are restarted together
+  addOne(N, a, c);
+  device.finish();
+  ASSERT_TRUE(aPages->isTracking());
+  ASSERT_TRUE(cPages->isTracking());
+
+  occa::resetDirtyPageStats();
+  a[pageEntries] = 0;
+  c[pageEntries] = 0;
+  addOne(N, a, c);
+  device.finish();
+
+  occa::dirtyPageStats_t stats = occa::getDirtyPageStats();
+  ASSERT_EQ(stats.fullSyncs, (occa::udim_t) 0);
+  ASSERT_EQ(stats.partialSyncs, (occa::udim_t) 2);
+  ASSERT_EQ(stats.pagesSynced, (occa::udim_t) 2);
+  ASSERT_EQ(a[pageEntries], 1);
+  ASSERT_EQ(c[pageEntries], 1);
+  ASSERT_EQ(a[0], 2);
+
+  if (hasSoftDirty) {
+    // Restarting [b] clears the soft-dirty bits of [a] and [c],
+    //   so they go back to a full sync
+    addOne(N, b, b);
+    device.finish();
+    ASSERT_TRUE(bPages->isTracking());
+    ASSERT_FALSE(aPages->isTracking());
+    ASSERT_FALSE(cPages->isTracking());
+
+#if (OCCA_OS & (OCCA_LINUX_OS | OCCA_MACOS_OS))
+    // System calls can write into tracked buffers
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+    const int value = 42;
+    ASSERT_EQ((int) ::write(fds[1], &value, sizeof(int)), (int) sizeof(int));
+    ASSERT_EQ((int) ::read(fds[0], b + pageEntries, sizeof(int)), (int) sizeof(int));
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    ASSERT_TRUE(bPages->isDirty(1));
+    ASSERT_EQ(bPages->dirtyPageCount(), (occa::udim_t) 1);
+#endif
+  }
+
+  occa::freeUvaPtr(a);
+  occa::freeUvaPtr(b);
+  occa::freeUvaPtr(c);
+
+  addOne.free();
+  device.free();
+}